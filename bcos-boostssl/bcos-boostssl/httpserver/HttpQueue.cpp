@@ -1,4 +1,24 @@
 #include "HttpQueue.h"
+#include <bcos-utilities/Common.h>
+
+void bcos::boostssl::http::HttpMetrics::record(Stage _stage, uint64_t _us)
+{
+    auto& counter = m_counters[_stage];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.totalUs.fetch_add(_us, std::memory_order_relaxed);
+    auto maxUs = counter.maxUs.load(std::memory_order_relaxed);
+    while (_us > maxUs &&
+           !counter.maxUs.compare_exchange_weak(maxUs, _us, std::memory_order_relaxed))
+    {
+    }
+}
+bcos::boostssl::http::HttpMetrics::Stat bcos::boostssl::http::HttpMetrics::flush(Stage _stage)
+{
+    auto& counter = m_counters[_stage];
+    return Stat{.count = counter.count.exchange(0, std::memory_order_relaxed),
+        .totalUs = counter.totalUs.exchange(0, std::memory_order_relaxed),
+        .maxUs = counter.maxUs.exchange(0, std::memory_order_relaxed)};
+}
 
 bcos::boostssl::http::Queue::Queue(std::size_t _limit) : m_limit(_limit) {}
 void bcos::boostssl::http::Queue::setSender(std::function<void(HttpResponsePtr)> _sender)
@@ -20,25 +40,67 @@ void bcos::boostssl::http::Queue::setLimit(std::size_t _limit)
 }
 bool bcos::boostssl::http::Queue::isFull() const
 {
-    return m_allResp.size() >= m_limit;
+    return m_slots.size() >= m_limit;
+}
+void bcos::boostssl::http::Queue::sendFront()
+{
+    if (m_writing || m_slots.empty() || !m_slots.front().resp)
+    {
+        return;
+    }
+    m_writing = true;
+    m_writeTime = utcSteadyTimeUs();
+    if (m_metrics)
+    {
+        m_metrics->record(HttpMetrics::QueueWait, m_writeTime - m_slots.front().readyTime);
+    }
+    m_sender(m_slots.front().resp);
 }
 bool bcos::boostssl::http::Queue::onWrite()
 {
-    BOOST_ASSERT(!m_allResp.empty());
-    auto was_full = isFull();
-    m_allResp.pop_front();
-    if (!m_allResp.empty())
+    BOOST_ASSERT(!m_slots.empty());
+    if (m_metrics)
     {
-        m_sender(m_allResp.front());
+        m_metrics->record(HttpMetrics::Write, utcSteadyTimeUs() - m_writeTime);
     }
+    auto was_full = isFull();
+    m_slots.pop_front();
+    ++m_frontSeq;
+    m_writing = false;
+    sendFront();
     return was_full;
 }
-void bcos::boostssl::http::Queue::enqueue(HttpResponsePtr _msg)
+uint64_t bcos::boostssl::http::Queue::reserve()
+{
+    m_slots.emplace_back(Slot{.requestTime = utcSteadyTimeUs()});
+    return m_frontSeq + m_slots.size() - 1;
+}
+void bcos::boostssl::http::Queue::fill(uint64_t _seq, HttpResponsePtr _msg)
 {
-    m_allResp.push_back(std::move(_msg));
+    // the slot has been dropped, e.g. the queue is replaced
+    if (_seq < m_frontSeq || _seq >= m_frontSeq + m_slots.size())
+    {
+        return;
+    }
+    auto& slot = m_slots[_seq - m_frontSeq];
+    // the slot has been answered, e.g. by the timeout of the handler
+    if (slot.resp)
+    {
+        return;
+    }
+    slot.resp = std::move(_msg);
+    slot.readyTime = utcSteadyTimeUs();
+    if (m_metrics)
+    {
+        m_metrics->record(HttpMetrics::Handler, slot.readyTime - slot.requestTime);
+    }
     // there was no previous work, start this one
-    if (m_allResp.size() == 1)
+    if (_seq == m_frontSeq)
     {
-        m_sender(m_allResp.front());
+        sendFront();
     }
 }
+void bcos::boostssl::http::Queue::enqueue(HttpResponsePtr _msg)
+{
+    fill(reserve(), std::move(_msg));
+}
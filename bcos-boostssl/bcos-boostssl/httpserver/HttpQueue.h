@@ -19,19 +19,77 @@
  */
 #pragma once
 #include <bcos-boostssl/httpserver/Common.h>
+#include <array>
+#include <atomic>
+#include <deque>
 
 namespace bcos::boostssl::http
 {
-// The queue for http request pipeline
+// The request-level timing of the http server, shared by all the sessions
+class HttpMetrics
+{
+public:
+    using Ptr = std::shared_ptr<HttpMetrics>;
+
+    enum Stage : uint8_t
+    {
+        // the response is ready and waits for the earlier pipelined responses to be sent
+        QueueWait = 0,
+        // the request is dispatched to the handler until the response is ready
+        Handler = 1,
+        // the response is written to the socket
+        Write = 2,
+        STAGE_COUNT = 3
+    };
+
+    struct Stat
+    {
+        uint64_t count = 0;
+        uint64_t totalUs = 0;
+        uint64_t maxUs = 0;
+        uint64_t avgUs() const { return count == 0 ? 0 : totalUs / count; }
+    };
+
+    void record(Stage _stage, uint64_t _us);
+    // the stat of the stage since the last flush
+    Stat flush(Stage _stage);
+
+private:
+    struct Counter
+    {
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> totalUs = 0;
+        std::atomic<uint64_t> maxUs = 0;
+    };
+    std::array<Counter, STAGE_COUNT> m_counters;
+};
+
+// The queue for http request pipeline: a slot is reserved when the request is read and the
+// responses are sent strictly in the request order, all the methods must be called on the
+// executor of the session stream
 class Queue
 {
 private:
+    struct Slot
+    {
+        HttpResponsePtr resp;
+        uint64_t requestTime = 0;
+        uint64_t readyTime = 0;
+    };
+
     // the maximum number size of queue
     std::size_t m_limit;
-    // messages to be send
-    std::deque<HttpResponsePtr> m_allResp;
+    // the reserved slots, the front one is being sent or waiting for the handler
+    std::deque<Slot> m_slots;
+    // the sequence of the front slot
+    uint64_t m_frontSeq = 0;
+    bool m_writing = false;
+    uint64_t m_writeTime = 0;
     // send handler
     std::function<void(HttpResponsePtr)> m_sender;
+    HttpMetrics::Ptr m_metrics;
+
+    void sendFront();
 
 public:
     explicit Queue(std::size_t _limit = 16);
@@ -42,13 +100,22 @@ public:
     std::size_t limit() const;
     void setLimit(std::size_t _limit);
 
+    HttpMetrics::Ptr metrics() const { return m_metrics; }
+    void setMetrics(HttpMetrics::Ptr _metrics) { m_metrics = std::move(_metrics); }
+
     // if the queue reached the m_limit
     bool isFull() const;
+    std::size_t size() const { return m_slots.size(); }
 
     // called when a message finishes sending
     // returns `true` if the caller should initiate a read
     bool onWrite();
 
+    // reserve the slot of a request, return the sequence to fill the response
+    uint64_t reserve();
+    // fill the response of the reserved slot, the ready responses at the front are sent
+    void fill(uint64_t _seq, HttpResponsePtr _msg);
+
     // enqueue and waiting called by the HTTP handler to send a response.
     void enqueue(HttpResponsePtr _msg);
 };
@@ -44,8 +44,35 @@ void HttpServer::start()
     auto address = boost::asio::ip::make_address(m_listenIP);
     auto endpoint = boost::asio::ip::tcp::endpoint{address, m_listenPort};
 
+    auto reusePort = m_acceptorCount > 1 && m_ioservicePool;
+    listen(*m_acceptor, endpoint, reusePort);
+    // start accept
+    accept(m_acceptor);
+
+    if (reusePort)
+    {
+        m_reusePortAcceptors.clear();
+        for (std::size_t i = 1; i < m_acceptorCount; ++i)
+        {
+            auto acceptor =
+                std::make_shared<boost::asio::ip::tcp::acceptor>(*m_ioservicePool->getIOService());
+            listen(*acceptor, endpoint, reusePort);
+            m_reusePortAcceptors.emplace_back(acceptor);
+            accept(std::move(acceptor));
+        }
+    }
+
+    HTTP_SERVER(INFO) << LOG_BADGE("startListen") << LOG_KV("ip", endpoint.address().to_string())
+                      << LOG_KV("port", endpoint.port())
+                      << LOG_KV("acceptors", m_reusePortAcceptors.size() + 1)
+                      << LOG_KV("pipelineLimit", m_pipelineLimit);
+}
+
+void HttpServer::listen(boost::asio::ip::tcp::acceptor& _acceptor,
+    boost::asio::ip::tcp::endpoint const& _endpoint, bool _reusePort)
+{
     boost::beast::error_code ec;
-    m_acceptor->open(endpoint.protocol(), ec);
+    _acceptor.open(_endpoint.protocol(), ec);
     if (ec)
     {
         HTTP_SERVER(WARNING) << LOG_BADGE("open") << LOG_KV("failed", ec)
@@ -54,7 +81,7 @@ void HttpServer::start()
     }
 
     // allow address reuse
-    m_acceptor->set_option(boost::asio::socket_base::reuse_address(true), ec);
+    _acceptor.set_option(boost::asio::socket_base::reuse_address(true), ec);
     if (ec)
     {
         HTTP_SERVER(WARNING) << LOG_BADGE("set_option") << LOG_KV("failed", ec)
@@ -63,7 +90,27 @@ void HttpServer::start()
         BOOST_THROW_EXCEPTION(std::runtime_error("acceptor set_option failed"));
     }
 
-    m_acceptor->bind(endpoint, ec);
+#if defined(SO_REUSEPORT)
+    if (_reusePort)
+    {
+        // all the acceptors bind the same port, the kernel balances the connections among them
+        _acceptor.set_option(
+            boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true), ec);
+        if (ec)
+        {
+            HTTP_SERVER(WARNING) << LOG_BADGE("set_option") << LOG_DESC("SO_REUSEPORT")
+                                 << LOG_KV("failed", ec) << LOG_KV("message", ec.message());
+            BOOST_THROW_EXCEPTION(std::runtime_error("acceptor set_option reuse port failed"));
+        }
+    }
+#else
+    if (_reusePort)
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error("SO_REUSEPORT is not supported"));
+    }
+#endif
+
+    _acceptor.bind(_endpoint, ec);
     if (ec)
     {
         HTTP_SERVER(WARNING) << LOG_BADGE("bind") << LOG_KV("failed", ec)
@@ -71,19 +118,13 @@ void HttpServer::start()
         BOOST_THROW_EXCEPTION(std::runtime_error("acceptor bind failed"));
     }
 
-    m_acceptor->listen(boost::asio::socket_base::max_listen_connections, ec);
+    _acceptor.listen(boost::asio::socket_base::max_listen_connections, ec);
     if (ec)
     {
         HTTP_SERVER(WARNING) << LOG_BADGE("listen") << LOG_KV("failed", ec)
                              << LOG_KV("message", ec.message());
         BOOST_THROW_EXCEPTION(std::runtime_error("acceptor listen failed"));
     }
-
-    // start accept
-    accept();
-
-    HTTP_SERVER(INFO) << LOG_BADGE("startListen") << LOG_KV("ip", endpoint.address().to_string())
-                      << LOG_KV("port", endpoint.port());
 }
 
 void HttpServer::stop()
@@ -92,25 +133,40 @@ void HttpServer::stop()
     {
         m_acceptor->close();
     }
+    for (auto& acceptor : m_reusePortAcceptors)
+    {
+        if (acceptor->is_open())
+        {
+            acceptor->close();
+        }
+    }
 
 
     HTTP_SERVER(INFO) << LOG_BADGE("stop") << LOG_DESC("http server");
 }
 
-void HttpServer::accept()
+void HttpServer::accept(std::shared_ptr<boost::asio::ip::tcp::acceptor> _acceptor)
 {
     // The new connection gets its own strand
-    m_acceptor->async_accept(*(m_ioservicePool->getIOService()),
-        boost::beast::bind_front_handler(&HttpServer::onAccept, shared_from_this()));
+    auto& acceptor = *_acceptor;
+    acceptor.async_accept(*(m_ioservicePool->getIOService()),
+        boost::beast::bind_front_handler(
+            &HttpServer::onAccept, shared_from_this(), std::move(_acceptor)));
 }
 
-void HttpServer::onAccept(boost::beast::error_code ec, boost::asio::ip::tcp::socket socket)
+void HttpServer::onAccept(std::shared_ptr<boost::asio::ip::tcp::acceptor> _acceptor,
+    boost::beast::error_code ec, boost::asio::ip::tcp::socket socket)
 {
     if (ec)
     {
         HTTP_SERVER(WARNING) << LOG_BADGE("accept") << LOG_KV("failed", ec)
                              << LOG_KV("message", ec.message());
-        accept();
+        // the acceptor has been closed by stop
+        if (!_acceptor->is_open())
+        {
+            return;
+        }
+        accept(std::move(_acceptor));
         return;
     }
 
@@ -121,7 +177,7 @@ void HttpServer::onAccept(boost::beast::error_code ec, boost::asio::ip::tcp::soc
         HTTP_SERVER(WARNING) << LOG_BADGE("accept") << LOG_KV("local_endpoint failed", sec)
                              << LOG_KV("message", sec.message());
         ws::WsTools::close(socket);
-        accept();
+        accept(std::move(_acceptor));
         return;
     }
     auto remoteEndpoint = socket.remote_endpoint(sec);
@@ -130,7 +186,7 @@ void HttpServer::onAccept(boost::beast::error_code ec, boost::asio::ip::tcp::soc
         HTTP_SERVER(WARNING) << LOG_BADGE("accept") << LOG_KV("remote_endpoint failed", sec)
                              << LOG_KV("message", sec.message());
         ws::WsTools::close(socket);
-        accept();
+        accept(std::move(_acceptor));
         return;
     }
     socket.set_option(boost::asio::ip::tcp::no_delay(true));
@@ -145,7 +201,7 @@ void HttpServer::onAccept(boost::beast::error_code ec, boost::asio::ip::tcp::soc
             std::make_shared<boost::beast::tcp_stream>(std::move(socket)));
         buildHttpSession(httpStream, nullptr)->run();
 
-        accept();
+        accept(std::move(_acceptor));
         return;
     }
 
@@ -177,7 +233,7 @@ void HttpServer::onAccept(boost::beast::error_code ec, boost::asio::ip::tcp::soc
             }
         });
 
-    accept();
+    accept(std::move(_acceptor));
 }
 
 
@@ -185,8 +241,10 @@ HttpSession::Ptr HttpServer::buildHttpSession(
     HttpStream::Ptr _httpStream, std::shared_ptr<std::string> _nodeId)
 {
     auto session = std::make_shared<HttpSession>(m_httpBodySizeLimit, m_corsConfig);
+    session->setHandlerTimeout(m_handlerTimeout);
 
-    Queue queue;
+    Queue queue(m_pipelineLimit);
+    queue.setMetrics(m_metrics);
     queue.setSender([self = std::weak_ptr<HttpSession>(session)](HttpResponsePtr _httpResp) {
         auto session = self.lock();
         if (!session)
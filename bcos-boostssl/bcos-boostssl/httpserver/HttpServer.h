@@ -21,7 +21,9 @@
 
 #include <bcos-boostssl/httpserver/HttpSession.h>
 #include <bcos-utilities/IOServicePool.h>
+#include <algorithm>
 #include <utility>
+#include <vector>
 namespace bcos::boostssl::http
 {
 // The http server impl
@@ -45,9 +47,10 @@ public:
     void stop();
 
     // accept connection
-    void accept();
+    void accept(std::shared_ptr<boost::asio::ip::tcp::acceptor> _acceptor);
     // handle connection
-    void onAccept(boost::beast::error_code ec, boost::asio::ip::tcp::socket socket);
+    void onAccept(std::shared_ptr<boost::asio::ip::tcp::acceptor> _acceptor,
+        boost::beast::error_code ec, boost::asio::ip::tcp::socket socket);
 
     HttpSession::Ptr buildHttpSession(
         HttpStream::Ptr _stream, std::shared_ptr<std::string> _nodeId);
@@ -96,7 +99,32 @@ public:
     CorsConfig corsConfig() const { return m_corsConfig; }
     void setCorsConfig(CorsConfig _corsConfig) { m_corsConfig = std::move(_corsConfig); }
 
+    // the number of the acceptors listening on the same port with SO_REUSEPORT, the kernel
+    // spreads the incoming connections over the acceptors running on different io_contexts
+    std::size_t acceptorCount() const { return m_acceptorCount; }
+    void setAcceptorCount(std::size_t _acceptorCount)
+    {
+        m_acceptorCount = std::max<std::size_t>(_acceptorCount, 1);
+    }
+
+    // the maximum pipelined requests of a connection waiting for the responses
+    std::size_t pipelineLimit() const { return m_pipelineLimit; }
+    void setPipelineLimit(std::size_t _pipelineLimit)
+    {
+        m_pipelineLimit = std::max<std::size_t>(_pipelineLimit, 1);
+    }
+
+    // the milliseconds a handler has to answer before the request is responded with 504,
+    // 0 means the request waits for the handler without limit
+    uint32_t handlerTimeout() const { return m_handlerTimeout; }
+    void setHandlerTimeout(uint32_t _handlerTimeout) { m_handlerTimeout = _handlerTimeout; }
+
+    HttpMetrics::Ptr metrics() const { return m_metrics; }
+
 private:
+    void listen(boost::asio::ip::tcp::acceptor& _acceptor,
+        boost::asio::ip::tcp::endpoint const& _endpoint, bool _reusePort);
+
     std::string m_listenIP;
     uint16_t m_listenPort;
     bool m_disableSsl = false;
@@ -105,6 +133,12 @@ private:
     WsUpgradeHandler m_wsUpgradeHandler;
 
     std::shared_ptr<boost::asio::ip::tcp::acceptor> m_acceptor;
+    // the extra acceptors of the multi-acceptor mode
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::acceptor>> m_reusePortAcceptors;
+    std::size_t m_acceptorCount = 1;
+    std::size_t m_pipelineLimit = 16;
+    uint32_t m_handlerTimeout = HttpSession::DEFAULT_HANDLER_TIMEOUT_MS;
+    HttpMetrics::Ptr m_metrics = std::make_shared<HttpMetrics>();
     std::shared_ptr<boost::asio::ssl::context> m_ctx;
 
     std::shared_ptr<HttpStreamFactory> m_httpStreamFactory;
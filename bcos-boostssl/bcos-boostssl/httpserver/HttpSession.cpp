@@ -153,19 +153,65 @@ void bcos::boostssl::http::HttpSession::handleRequest(const HttpRequest& _httpRe
     if (m_httpReqHandler)
     {
         const std::string& request = _httpRequest.body();
-        m_httpReqHandler(request, [session = shared_from_this(), version, startT,
-                                      keepAlive = _httpRequest.keep_alive()](bcos::bytes _content) {
-            auto resp = session->buildHttpResp(boost::beast::http::status::ok, keepAlive, version,
-                std::move(_content), session->corsConfig());
-            // put the response into the queue and waiting to be send
-            BCOS_LOG(TRACE) << LOG_BADGE("handleRequest") << LOG_DESC("response")
-                            << LOG_KV("body", std::string_view((const char*)resp->body().data(),
-                                                  resp->body().size()))
-                            << LOG_KV("keep_alive", resp->keep_alive())
-                            << LOG_KV("need_eof", resp->need_eof())
-                            << LOG_KV("timecost", (utcTime() - startT));
-            session->queue().enqueue(std::move(resp));
-        });
+        auto keepAlive = _httpRequest.keep_alive();
+        // reserve the slot in the request order, the pipelined responses may be ready out of order
+        // the slot must always be filled, otherwise the later responses wait behind it forever
+        auto seq = m_queue.reserve();
+        std::shared_ptr<boost::asio::steady_timer> timer;
+        if (m_handlerTimeout > 0)
+        {
+            timer = std::make_shared<boost::asio::steady_timer>(
+                m_httpStream->stream().get_executor(), std::chrono::milliseconds(m_handlerTimeout));
+            timer->async_wait([self = weak_from_this(), seq, keepAlive, version](
+                                  boost::system::error_code _ec) {
+                auto session = self.lock();
+                if (_ec || !session)
+                {
+                    return;
+                }
+                HTTP_SESSION(WARNING) << LOG_BADGE("handleRequest")
+                                      << LOG_DESC("the handler does not respond in time")
+                                      << LOG_KV("timeout", session->handlerTimeout());
+                session->queue().fill(seq,
+                    session->buildHttpResp(boost::beast::http::status::gateway_timeout, keepAlive,
+                        version, {}, session->corsConfig()));
+            });
+        }
+        try
+        {
+            m_httpReqHandler(request, [session = shared_from_this(), version, startT, seq, timer,
+                                          keepAlive](bcos::bytes _content) {
+                auto resp = session->buildHttpResp(boost::beast::http::status::ok, keepAlive,
+                    version, std::move(_content), session->corsConfig());
+                BCOS_LOG(TRACE) << LOG_BADGE("handleRequest") << LOG_DESC("response")
+                                << LOG_KV("body", std::string_view((const char*)resp->body().data(),
+                                                      resp->body().size()))
+                                << LOG_KV("keep_alive", resp->keep_alive())
+                                << LOG_KV("need_eof", resp->need_eof())
+                                << LOG_KV("timecost", (utcTime() - startT));
+                // the handler responds on any thread, fill the slot on the executor of the stream
+                auto& stream = session->httpStream()->stream();
+                boost::asio::post(stream.get_executor(), [session = std::move(session), seq, timer,
+                                                             resp = std::move(resp)]() mutable {
+                    if (timer)
+                    {
+                        timer->cancel();
+                    }
+                    session->queue().fill(seq, std::move(resp));
+                });
+            });
+        }
+        catch (std::exception const& e)
+        {
+            HTTP_SESSION(WARNING) << LOG_BADGE("handleRequest") << LOG_DESC("handler exception")
+                                  << LOG_KV("message", boost::diagnostic_information(e));
+            if (timer)
+            {
+                timer->cancel();
+            }
+            m_queue.fill(seq, buildHttpResp(boost::beast::http::status::internal_server_error,
+                                  keepAlive, version, {}, m_corsConfig));
+        }
     }
     else
     {
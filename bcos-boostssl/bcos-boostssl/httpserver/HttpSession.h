@@ -24,6 +24,8 @@
 #include <bcos-utilities/BoostLog.h>
 #include <bcos-utilities/ThreadPool.h>
 #include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/beast/websocket.hpp>
@@ -36,6 +38,7 @@ class HttpSession : public std::enable_shared_from_this<HttpSession>
 public:
     using Ptr = std::shared_ptr<HttpSession>;
     using ConstPtr = std::shared_ptr<const HttpSession>;
+    constexpr static uint32_t DEFAULT_HANDLER_TIMEOUT_MS = 0;
 
     HttpSession(uint32_t _httpBodySizeLimit, CorsConfig _corsConfig);
     HttpSession(const HttpSession&) = delete;
@@ -93,6 +96,10 @@ public:
     CorsConfig corsConfig() const { return m_corsConfig; }
     void setCorsConfig(CorsConfig _corsConfig) { m_corsConfig = std::move(_corsConfig); }
 
+    // the request not answered by the handler in time is responded with 504, 0 to disable
+    uint32_t handlerTimeout() const { return m_handlerTimeout; }
+    void setHandlerTimeout(uint32_t _handlerTimeout) { m_handlerTimeout = _handlerTimeout; }
+
 private:
     HttpStream::Ptr m_httpStream;
     boost::beast::flat_buffer m_buffer;
@@ -107,6 +114,7 @@ private:
 
     uint32_t m_httpBodySizeLimit;
     CorsConfig m_corsConfig;
+    uint32_t m_handlerTimeout = DEFAULT_HANDLER_TIMEOUT_MS;
 };
 
 }  // namespace bcos::boostssl::http
@@ -32,6 +32,7 @@
 #define MIN_RECONNECT_PERIOD_MS (10000)
 #define DEFAULT_MESSAGE_TIMEOUT_MS (-1)
 #define DEFAULT_MAX_MESSAGE_SIZE (32 * 1024 * 1024)
+#define DEFAULT_MAX_WRITE_QUEUE_BYTES (256 * 1024 * 1024)
 #define MIN_THREAD_POOL_SIZE (1)
 
 namespace bcos::boostssl::ws
@@ -48,6 +49,15 @@ enum WsModel : uint16_t
     Mixed = Client | Server
 };
 
+// what to do with the message sent to the session whose write queue is full
+enum class WriteQueueOverflowPolicy : uint8_t
+{
+    // reject the message, the sender is notified by WsError::WriteQueueOverflow
+    Reject = 0,
+    // the peer is a slow consumer, disconnect the session
+    Disconnect = 1
+};
+
 class WsConfig
 {
 public:
@@ -89,6 +99,17 @@ private:
     // the max message to be send or read
     uint32_t m_maxMsgSize{DEFAULT_MAX_MESSAGE_SIZE};
 
+    // the max bytes waiting in the write queue of one session, 0 means unlimited
+    uint64_t m_maxWriteQueueBytes{DEFAULT_MAX_WRITE_QUEUE_BYTES};
+    WriteQueueOverflowPolicy m_writeQueueOverflowPolicy{WriteQueueOverflowPolicy::Reject};
+
+    // the http acceptors listening on the same port with SO_REUSEPORT
+    std::size_t m_httpAcceptorCount{1};
+    // the max pipelined http requests of one connection
+    std::size_t m_httpPipelineLimit{16};
+    // the milliseconds an http handler has to respond, 0 means unlimited
+    uint32_t m_httpHandlerTimeout{0};
+
     // cors config
     http::CorsConfig m_corsConfig;
 
@@ -111,6 +132,39 @@ public:
     void setMaxMsgSize(uint32_t _maxMsgSize) { m_maxMsgSize = _maxMsgSize; }
     uint32_t maxMsgSize() const { return m_maxMsgSize; }
 
+    void setMaxWriteQueueBytes(uint64_t _maxWriteQueueBytes)
+    {
+        m_maxWriteQueueBytes = _maxWriteQueueBytes;
+    }
+    uint64_t maxWriteQueueBytes() const { return m_maxWriteQueueBytes; }
+
+    void setWriteQueueOverflowPolicy(WriteQueueOverflowPolicy _policy)
+    {
+        m_writeQueueOverflowPolicy = _policy;
+    }
+    WriteQueueOverflowPolicy writeQueueOverflowPolicy() const
+    {
+        return m_writeQueueOverflowPolicy;
+    }
+
+    void setHttpAcceptorCount(std::size_t _httpAcceptorCount)
+    {
+        m_httpAcceptorCount = _httpAcceptorCount;
+    }
+    std::size_t httpAcceptorCount() const { return m_httpAcceptorCount; }
+
+    void setHttpPipelineLimit(std::size_t _httpPipelineLimit)
+    {
+        m_httpPipelineLimit = _httpPipelineLimit;
+    }
+    std::size_t httpPipelineLimit() const { return m_httpPipelineLimit; }
+
+    void setHttpHandlerTimeout(uint32_t _httpHandlerTimeout)
+    {
+        m_httpHandlerTimeout = _httpHandlerTimeout;
+    }
+    uint32_t httpHandlerTimeout() const { return m_httpHandlerTimeout; }
+
     uint32_t reconnectPeriod() const
     {
         return m_reconnectPeriod > MIN_RECONNECT_PERIOD_MS ? m_reconnectPeriod :
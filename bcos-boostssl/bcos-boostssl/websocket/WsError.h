@@ -37,7 +37,8 @@ enum WsError
     EndPointNotExist = -4010,
     MessageOverflow = -4011,
     UndefinedException = -4012,
-    MessageEncodeError = -4013
+    MessageEncodeError = -4013,
+    WriteQueueOverflow = -4014
 };
 
 inline bool notRetryAgain(int _wsError)
@@ -102,6 +102,9 @@ void WsInitializer::initWsService(WsService::Ptr _wsService)
 
         httpServer->setIOServicePool(ioServicePool);
         httpServer->setDisableSsl(_config->disableSsl());
+        httpServer->setAcceptorCount(_config->httpAcceptorCount());
+        httpServer->setPipelineLimit(_config->httpPipelineLimit());
+        httpServer->setHandlerTimeout(_config->httpHandlerTimeout());
         httpServer->setWsUpgradeHandler(
             [wsServiceWeakPtr](std::shared_ptr<HttpStream> _httpStream, HttpRequest&& _httpRequest,
                 std::shared_ptr<std::string> _nodeId) {
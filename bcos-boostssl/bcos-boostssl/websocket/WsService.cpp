@@ -180,23 +180,51 @@ void WsService::reportConnectedNodes()
     auto ss = sessions();
     WEBSOCKET_SERVICE(INFO) << LOG_DESC("connected nodes") << LOG_KV("count", ss.size());
 
+    if (m_httpServer)
+    {
+        // the http request timing since the last report
+        auto metrics = m_httpServer->metrics();
+        auto queueWait = metrics->flush(boostssl::http::HttpMetrics::QueueWait);
+        auto handler = metrics->flush(boostssl::http::HttpMetrics::Handler);
+        auto write = metrics->flush(boostssl::http::HttpMetrics::Write);
+        WEBSOCKET_SERVICE(INFO) << LOG_BADGE("stat") << LOG_DESC("http request timing")
+                                << LOG_KV("requests", handler.count)
+                                << LOG_KV("avgQueueWaitUs", queueWait.avgUs())
+                                << LOG_KV("maxQueueWaitUs", queueWait.maxUs)
+                                << LOG_KV("avgHandlerUs", handler.avgUs())
+                                << LOG_KV("maxHandlerUs", handler.maxUs)
+                                << LOG_KV("avgWriteUs", write.avgUs())
+                                << LOG_KV("maxWriteUs", write.maxUs);
+    }
+
     for (auto const& session : ss)
     {
         auto writeQueueSize = session->writeQueueSize();
         auto callbackQueueSize = session->callbackQueueSize();
-        if (writeQueueSize > 0 || callbackQueueSize > 0)
+        auto metrics = session->writeMetrics();
+        if (writeQueueSize > 0 || callbackQueueSize > 0 || metrics.rejectedMsgs > 0)
         {
             WEBSOCKET_SERVICE(INFO) << LOG_BADGE("stat") << LOG_DESC("session write queue status")
                                     << LOG_KV("endpoint", session->endPoint())
                                     << LOG_KV("writeQueueSize", writeQueueSize)
-                                    << LOG_KV("callbackQueueSize", callbackQueueSize);
+                                    << LOG_KV("callbackQueueSize", callbackQueueSize)
+                                    << LOG_KV("queuedBytes", metrics.queuedBytes)
+                                    << LOG_KV("peakQueuedBytes", metrics.peakQueuedBytes)
+                                    << LOG_KV("sentMsgs", metrics.sentMsgs)
+                                    << LOG_KV("sentBytes", metrics.sentBytes)
+                                    << LOG_KV("writeBatches", metrics.writeBatches)
+                                    << LOG_KV("rejectedMsgs", metrics.rejectedMsgs);
         }
         else
         {
             WEBSOCKET_SERVICE(DEBUG) << LOG_BADGE("stat") << LOG_DESC("session write queue status")
                                      << LOG_KV("endpoint", session->endPoint())
                                      << LOG_KV("writeQueueSize", writeQueueSize)
-                                     << LOG_KV("callbackQueueSize", callbackQueueSize);
+                                     << LOG_KV("callbackQueueSize", callbackQueueSize)
+                                     << LOG_KV("peakQueuedBytes", metrics.peakQueuedBytes)
+                                     << LOG_KV("sentMsgs", metrics.sentMsgs)
+                                     << LOG_KV("sentBytes", metrics.sentBytes)
+                                     << LOG_KV("writeBatches", metrics.writeBatches);
         }
     }
 }
@@ -406,6 +434,8 @@ std::shared_ptr<WsSession> WsService::newSession(
     session->setEndPoint(endPoint);
     session->setMaxWriteMsgSize(m_config->maxMsgSize());
     session->setSendMsgTimeout(m_config->sendMsgTimeout());
+    session->setMaxWriteQueueBytes(m_config->maxWriteQueueBytes());
+    session->setWriteQueueOverflowPolicy(m_config->writeQueueOverflowPolicy());
     session->setNodeId(_nodeId);
 
     auto self = std::weak_ptr<WsService>(shared_from_this());
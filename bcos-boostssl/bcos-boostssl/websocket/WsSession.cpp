@@ -35,6 +35,10 @@
 #include <string>
 #include <utility>
 
+#if defined(__linux__)
+#include <netinet/tcp.h>
+#endif
+
 #define MESSAGE_SEND_DELAY_REPORT_MS (5000)
 #define MAX_MESSAGE_SEND_DELAY_MS (5000)
 
@@ -285,9 +289,58 @@ void WsSession::onWritePacket()
         return;
     }
     m_writing = true;
-    auto msg = m_writeQueue.top();
-    m_writeQueue.pop();
-    asyncWrite(msg->buffer);
+    // take the queued messages in one go, the batch is written back to back without the lock
+    std::size_t batchBytes = 0;
+    while (!m_writeQueue.empty() && m_writings.size() < MAX_WRITE_BATCH_MSGS &&
+           batchBytes < MAX_WRITE_BATCH_BYTES)
+    {
+        batchBytes += m_writeQueue.front()->buffer->size();
+        m_writings.emplace_back(std::move(m_writeQueue.front()));
+        m_writeQueue.pop_front();
+    }
+    m_writingIndex = 0;
+    m_writeBatches++;
+    if (m_writings.size() > 1)
+    {
+        setCork(true);
+    }
+    asyncWrite(m_writings.front()->buffer);
+}
+
+void WsSession::onWriteCompleted(std::size_t _size)
+{
+    m_sentMsgs++;
+    m_sentBytes += _size;
+    if (m_writingIndex < m_writings.size())
+    {
+        m_writeQueueBytes -= m_writings[m_writingIndex]->buffer->size();
+        if (++m_writingIndex < m_writings.size())
+        {
+            asyncWrite(m_writings[m_writingIndex]->buffer);
+            return;
+        }
+    }
+    if (m_writings.size() > 1)
+    {
+        setCork(false);
+    }
+    m_writings.clear();
+    m_writingIndex = 0;
+    m_writing = false;
+    onWritePacket();
+}
+
+void WsSession::setCork(bool _cork)
+{
+    // each websocket message is framed by beast and written by its own write operation, the
+    // cork makes the kernel pack the small frames of a batch into full segments instead
+#ifdef TCP_CORK
+    boost::system::error_code ec;
+    m_wsStreamDelegate->tcpStream().socket().set_option(
+        boost::asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_CORK>(_cork), ec);
+#else
+    boost::ignore_unused(_cork);
+#endif
 }
 
 void WsSession::asyncWrite(std::shared_ptr<bcos::bytes> _buffer)
@@ -306,7 +359,7 @@ void WsSession::asyncWrite(std::shared_ptr<bcos::bytes> _buffer)
         // Note: add one simple way to monitor message sending latency
         // Note: the lambda[] should not include session directly, this will cause memory leak
         m_wsStreamDelegate->asyncWrite(
-            *_buffer, [self, _buffer](boost::beast::error_code _ec, std::size_t) {
+            *_buffer, [self, _buffer](boost::beast::error_code _ec, std::size_t _size) {
                 auto session = self.lock();
                 if (!session)
                 {
@@ -319,11 +372,7 @@ void WsSession::asyncWrite(std::shared_ptr<bcos::bytes> _buffer)
                                       << LOG_KV("endpoint", session->endPoint());
                     return session->drop(WsError::WriteError);
                 }
-                if (session->m_writing)
-                {
-                    session->m_writing = false;
-                }
-                session->onWritePacket();
+                session->onWriteCompleted(_size);
             });
     }
     catch (const std::exception& _e)
@@ -343,11 +392,38 @@ void WsSession::send(std::shared_ptr<bytes> buffer)
     {
         Guard lock(x_writeQueue);
         // data to be sent is always enqueue first
-        m_writeQueue.push(msg);
+        m_writeQueue.push_back(std::move(msg));
     }
     onWritePacket();
 }
 
+bool WsSession::tryReserveWriteQueue(std::size_t _size)
+{
+    auto queuedBytes = m_writeQueueBytes.fetch_add(_size) + _size;
+    // one message larger than the limit is still accepted by the empty queue
+    if (m_maxWriteQueueBytes > 0 && queuedBytes > m_maxWriteQueueBytes && queuedBytes > _size)
+    {
+        m_writeQueueBytes -= _size;
+        m_rejectedMsgs++;
+        return false;
+    }
+    auto peak = m_peakWriteQueueBytes.load();
+    while (queuedBytes > peak && !m_peakWriteQueueBytes.compare_exchange_weak(peak, queuedBytes))
+    {
+    }
+    return true;
+}
+
+WsSession::WriteMetrics WsSession::writeMetrics() const
+{
+    return WriteMetrics{.sentMsgs = m_sentMsgs.load(),
+        .sentBytes = m_sentBytes.load(),
+        .writeBatches = m_writeBatches.load(),
+        .rejectedMsgs = m_rejectedMsgs.load(),
+        .queuedBytes = m_writeQueueBytes.load(),
+        .peakQueuedBytes = m_peakWriteQueueBytes.load()};
+}
+
 /**
  * @brief: send message with callback
  * @param _msg: message to be send
@@ -412,6 +488,27 @@ void WsSession::asyncSendMessage(
         return;
     }
 
+    if (!tryReserveWriteQueue(buffer->size()))
+    {
+        WEBSOCKET_SESSION(WARNING)
+            << LOG_BADGE("asyncSendMessage") << LOG_DESC("write queue overflow")
+            << LOG_KV("endpoint", endPoint()) << LOG_KV("seq", seq)
+            << LOG_KV("msgSize", buffer->size()) << LOG_KV("queuedBytes", m_writeQueueBytes.load())
+            << LOG_KV("maxWriteQueueBytes", m_maxWriteQueueBytes)
+            << LOG_KV("policy", static_cast<int>(m_writeQueueOverflowPolicy));
+        if (_respFunc)
+        {
+            auto error = BCOS_ERROR_PTR(WsError::WriteQueueOverflow, "Write queue overflow");
+            _respFunc(error, nullptr, nullptr);
+        }
+        // the peer can not keep up with the messages, evict it
+        if (m_writeQueueOverflowPolicy == WriteQueueOverflowPolicy::Disconnect)
+        {
+            drop(WsError::WriteQueueOverflow);
+        }
+        return;
+    }
+
     if (_respFunc)
     {  // callback
         auto callback = std::make_shared<CallBack>();
@@ -19,6 +19,7 @@
  */
 #pragma once
 #include "bcos-boostssl/interfaces/MessageFace.h"
+#include "bcos-boostssl/websocket/WsConfig.h"
 #include "bcos-boostssl/websocket/WsError.h"
 #include "bcos-utilities/ObjectCounter.h"
 #include <bcos-boostssl/httpserver/Common.h>
@@ -36,9 +37,9 @@
 #include <boost/beast/websocket.hpp>
 #include <boost/thread/thread.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <shared_mutex>
 #include <unordered_map>
 #include <utility>
@@ -132,12 +133,40 @@ public:
     int32_t maxWriteMsgSize() const { return m_maxWriteMsgSize; }
     void setMaxWriteMsgSize(int32_t _maxWriteMsgSize) { m_maxWriteMsgSize = _maxWriteMsgSize; }
 
+    uint64_t maxWriteQueueBytes() const { return m_maxWriteQueueBytes; }
+    void setMaxWriteQueueBytes(uint64_t _maxWriteQueueBytes)
+    {
+        m_maxWriteQueueBytes = _maxWriteQueueBytes;
+    }
+
+    WriteQueueOverflowPolicy writeQueueOverflowPolicy() const
+    {
+        return m_writeQueueOverflowPolicy;
+    }
+    void setWriteQueueOverflowPolicy(WriteQueueOverflowPolicy _policy)
+    {
+        m_writeQueueOverflowPolicy = _policy;
+    }
+
     std::size_t writeQueueSize()
     {
         bcos::Guard lockGuard(x_writeQueue);
         return m_writeQueue.size();
     }
 
+    // the statistics of the write path of the session
+    struct WriteMetrics
+    {
+        uint64_t sentMsgs = 0;
+        uint64_t sentBytes = 0;
+        // the number of write batches, sentMsgs / writeBatches is the average batch size
+        uint64_t writeBatches = 0;
+        uint64_t rejectedMsgs = 0;
+        uint64_t queuedBytes = 0;
+        uint64_t peakQueuedBytes = 0;
+    };
+    WriteMetrics writeMetrics() const;
+
     std::size_t callbackQueueSize()
     {
         bcos::Guard lockGuard(x_callback);
@@ -175,6 +204,7 @@ public:
     // async read
     virtual void onReadPacket();
     void onWritePacket();
+    void onWriteCompleted(std::size_t _size);
 
     struct Message : public bcos::ObjectCounter<Message>
     {
@@ -182,6 +212,15 @@ public:
     };
 
 protected:
+    // the queued messages are taken by one write batch at most
+    constexpr static size_t MAX_WRITE_BATCH_MSGS = 64;
+    constexpr static size_t MAX_WRITE_BATCH_BYTES = 1024 * 1024;
+
+    // account the message into the write queue, false if the queue is full
+    bool tryReserveWriteQueue(std::size_t _size);
+    // hold the small frames of one write batch in the kernel until the batch is written
+    virtual void setCork(bool _cork);
+
     tbb::task_arena& m_taskArena;
     tbb::task_group& m_taskGroup;
 
@@ -219,10 +258,23 @@ protected:
 
     // ioc
     std::shared_ptr<boost::asio::io_context> m_ioc;
-    // send message queue
+    // send message queue, the messages are written in the order they are sent
     mutable bcos::Mutex x_writeQueue;
-    std::priority_queue<std::shared_ptr<Message>> m_writeQueue;
+    std::deque<std::shared_ptr<Message>> m_writeQueue;
     std::atomic_bool m_writing = {false};
+    // the write batch in flight, only accessed by the writer holding m_writing
+    std::vector<std::shared_ptr<Message>> m_writings;
+    std::size_t m_writingIndex = 0;
+
+    uint64_t m_maxWriteQueueBytes = 0;
+    WriteQueueOverflowPolicy m_writeQueueOverflowPolicy = WriteQueueOverflowPolicy::Reject;
+    // the bytes of the messages sent but not written yet
+    std::atomic<uint64_t> m_writeQueueBytes = 0;
+    std::atomic<uint64_t> m_peakWriteQueueBytes = 0;
+    std::atomic<uint64_t> m_sentMsgs = 0;
+    std::atomic<uint64_t> m_sentBytes = 0;
+    std::atomic<uint64_t> m_writeBatches = 0;
+    std::atomic<uint64_t> m_rejectedMsgs = 0;
 };
 
 class WsSessionFactory
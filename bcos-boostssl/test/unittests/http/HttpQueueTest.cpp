@@ -0,0 +1,86 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the http pipeline queue
+ * @file HttpQueueTest.cpp
+ * @date 2026-10-19
+ */
+
+#include <bcos-boostssl/httpserver/HttpQueue.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::boostssl;
+using namespace bcos::boostssl::http;
+
+namespace bcos::test
+{
+// the body size of the response identifies the request
+static HttpResponsePtr makeResp(size_t _id)
+{
+    auto resp = std::make_shared<HttpResponse>(boost::beast::http::status::ok, 11);
+    resp->body().resize(_id);
+    return resp;
+}
+
+BOOST_AUTO_TEST_SUITE(HttpQueueTest)
+
+BOOST_AUTO_TEST_CASE(pipelineOrder)
+{
+    std::vector<size_t> sent;
+    Queue queue(3);
+    auto metrics = std::make_shared<HttpMetrics>();
+    queue.setMetrics(metrics);
+    queue.setSender([&](HttpResponsePtr _resp) { sent.emplace_back(_resp->body().size()); });
+
+    auto seq0 = queue.reserve();
+    auto seq1 = queue.reserve();
+    auto seq2 = queue.reserve();
+    BOOST_CHECK(queue.isFull());
+
+    // the later responses are ready first, they wait for the first one
+    queue.fill(seq2, makeResp(2));
+    queue.fill(seq1, makeResp(1));
+    BOOST_CHECK(sent.empty());
+
+    queue.fill(seq0, makeResp(0));
+    BOOST_REQUIRE_EQUAL(sent.size(), 1U);
+    // one response is written at a time
+    BOOST_CHECK(queue.onWrite());
+    BOOST_CHECK(!queue.onWrite());
+    BOOST_CHECK(!queue.onWrite());
+    BOOST_REQUIRE_EQUAL(sent.size(), 3U);
+    BOOST_CHECK_EQUAL(sent[0], 0U);
+    BOOST_CHECK_EQUAL(sent[1], 1U);
+    BOOST_CHECK_EQUAL(sent[2], 2U);
+    BOOST_CHECK_EQUAL(queue.size(), 0U);
+
+    // the slot of a sent response can not be filled again
+    queue.fill(seq1, makeResp(1));
+    BOOST_CHECK_EQUAL(queue.size(), 0U);
+    queue.enqueue(makeResp(3));
+    BOOST_REQUIRE_EQUAL(sent.size(), 4U);
+    BOOST_CHECK_EQUAL(sent[3], 3U);
+    queue.onWrite();
+
+    BOOST_CHECK_EQUAL(metrics->flush(HttpMetrics::Handler).count, 4U);
+    BOOST_CHECK_EQUAL(metrics->flush(HttpMetrics::QueueWait).count, 4U);
+    BOOST_CHECK_EQUAL(metrics->flush(HttpMetrics::Write).count, 4U);
+    // the stat is reset after flush
+    BOOST_CHECK_EQUAL(metrics->flush(HttpMetrics::Write).count, 0U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
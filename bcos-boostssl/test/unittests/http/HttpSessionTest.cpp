@@ -21,6 +21,7 @@
 
 #include <bcos-boostssl/httpserver/HttpSession.h>
 #include <bcos-rpc/RpcFactory.h>
+#include <boost/asio/io_context.hpp>
 #include <sstream>
 
 #include <boost/test/unit_test.hpp>
@@ -311,4 +312,66 @@ BOOST_AUTO_TEST_CASE(test_corsDisabledTest)
 
 BOOST_AUTO_TEST_CASE(test_httpOptionsMethodTest) {}
 
+BOOST_AUTO_TEST_CASE(test_handlerFailureTest)
+{
+    boost::asio::io_context ioc;
+    auto httpSession = std::make_shared<HttpSession>(10240000, CorsConfig{});
+    httpSession->setHttpStream(
+        std::make_shared<HttpStreamImpl>(std::make_shared<boost::beast::tcp_stream>(ioc)));
+    httpSession->setHandlerTimeout(50);
+    std::vector<HttpResponsePtr> sent;
+    Queue queue;
+    queue.setSender([&sent](HttpResponsePtr _resp) { sent.emplace_back(std::move(_resp)); });
+    httpSession->setQueue(std::move(queue));
+
+    std::function<void(bcos::bytes)> pending;
+    httpSession->setRequestHandler(
+        [&pending](std::string_view _request, std::function<void(bcos::bytes)> _callback) {
+            if (_request == "throw")
+            {
+                BOOST_THROW_EXCEPTION(std::runtime_error("handler error"));
+            }
+            if (_request == "pending")
+            {
+                pending = std::move(_callback);
+                return;
+            }
+            _callback(bcos::bytes(_request.begin(), _request.end()));
+        });
+
+    HttpRequest request;
+    request.version(11);
+    request.keep_alive(true);
+    request.method(boost::beast::http::verb::post);
+
+    // the throwing handler is answered with 500 at once
+    request.body() = "throw";
+    httpSession->handleRequest(request);
+    BOOST_REQUIRE_EQUAL(sent.size(), 1U);
+    BOOST_CHECK_EQUAL(sent[0]->result(), boost::beast::http::status::internal_server_error);
+    httpSession->queue().onWrite();
+
+    // the handler never calling back is answered with 504, the pipelined response is not blocked
+    request.body() = "pending";
+    httpSession->handleRequest(request);
+    request.body() = "ok";
+    httpSession->handleRequest(request);
+    ioc.run();
+    BOOST_REQUIRE_EQUAL(sent.size(), 2U);
+    BOOST_CHECK_EQUAL(sent[1]->result(), boost::beast::http::status::gateway_timeout);
+    httpSession->queue().onWrite();
+    BOOST_REQUIRE_EQUAL(sent.size(), 3U);
+    BOOST_CHECK_EQUAL(sent[2]->result(), boost::beast::http::status::ok);
+    BOOST_CHECK_EQUAL(bytesToString(sent[2]->body()), "ok");
+    httpSession->queue().onWrite();
+
+    // the late response of the timed out request is dropped
+    BOOST_REQUIRE(pending);
+    pending(stringToBytes("late"));
+    ioc.restart();
+    ioc.run();
+    BOOST_CHECK_EQUAL(sent.size(), 3U);
+    BOOST_CHECK_EQUAL(httpSession->queue().size(), 0U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -73,6 +73,17 @@ BOOST_AUTO_TEST_CASE(test_WsConfigTest)
         config->setConnectPeers(peers);
         BOOST_CHECK_EQUAL(config->connectPeers()->size(), 0);
     }
+
+    {
+        auto config = std::make_shared<WsConfig>();
+        BOOST_CHECK_EQUAL(config->maxWriteQueueBytes(), DEFAULT_MAX_WRITE_QUEUE_BYTES);
+        BOOST_CHECK(config->writeQueueOverflowPolicy() == WriteQueueOverflowPolicy::Reject);
+
+        config->setMaxWriteQueueBytes(0);
+        config->setWriteQueueOverflowPolicy(WriteQueueOverflowPolicy::Disconnect);
+        BOOST_CHECK_EQUAL(config->maxWriteQueueBytes(), 0);
+        BOOST_CHECK(config->writeQueueOverflowPolicy() == WriteQueueOverflowPolicy::Disconnect);
+    }
 }
 
 BOOST_AUTO_TEST_CASE(test_WsToolsTest)
@@ -0,0 +1,184 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the write queue of WsSession
+ * @file WsSessionTest.cpp
+ * @date 2026-10-19
+ */
+
+#include <bcos-boostssl/websocket/WsMessage.h>
+#include <bcos-boostssl/websocket/WsSession.h>
+#include <oneapi/tbb/task_arena.h>
+#include <oneapi/tbb/task_group.h>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace bcos;
+using namespace bcos::boostssl;
+using namespace bcos::boostssl::ws;
+
+namespace
+{
+// the session writing into memory, the writes are completed by the test one by one
+class FakeWsSession : public WsSession
+{
+public:
+    using WsSession::tryReserveWriteQueue;
+    using WsSession::WsSession;
+
+    bool isConnected() override { return !m_isDrop; }
+    void asyncWrite(std::shared_ptr<bcos::bytes> _buffer) override
+    {
+        m_written.push_back(std::move(_buffer));
+    }
+    void completeWrite() { onWriteCompleted(m_written.back()->size()); }
+
+    void queueMessage(size_t _size, uint8_t _tag)
+    {
+        auto buffer = std::make_shared<bcos::bytes>(_size, _tag);
+        BOOST_REQUIRE(tryReserveWriteQueue(buffer->size()));
+        send(std::move(buffer));
+    }
+
+    std::vector<std::shared_ptr<bcos::bytes>> m_written;
+    bool m_cork = false;
+    bool m_corked = false;
+
+protected:
+    void setCork(bool _cork) override
+    {
+        m_cork = _cork;
+        m_corked = m_corked || _cork;
+    }
+};
+
+struct WsSessionFixture
+{
+    WsSessionFixture()
+    {
+        session = std::make_shared<FakeWsSession>(taskArena, taskGroup);
+        session->setMaxWriteMsgSize(1024 * 1024);
+        session->setDisconnectHandler(
+            [this](bcos::Error::Ptr, std::shared_ptr<WsSession>) { ++disconnected; });
+    }
+    ~WsSessionFixture() { taskGroup.wait(); }
+
+    std::shared_ptr<WsMessage> buildMessage()
+    {
+        auto msg = std::dynamic_pointer_cast<WsMessage>(factory.buildMessage());
+        msg->setPayload(std::make_shared<bytes>(16, 'a'));
+        return msg;
+    }
+
+    tbb::task_arena taskArena;
+    tbb::task_group taskGroup;
+    WsMessageFactory factory;
+    std::shared_ptr<FakeWsSession> session;
+    std::atomic<int> disconnected = 0;
+};
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(WsSessionTest, WsSessionFixture)
+
+BOOST_AUTO_TEST_CASE(writeBatchInOrder)
+{
+    // the first message is written at once, the others queue behind it
+    session->queueMessage(10, 0);
+    BOOST_REQUIRE_EQUAL(session->m_written.size(), 1U);
+    session->queueMessage(20, 1);
+    session->queueMessage(30, 2);
+    session->queueMessage(40, 3);
+    BOOST_CHECK_EQUAL(session->m_written.size(), 1U);
+    BOOST_CHECK_EQUAL(session->writeQueueSize(), 3U);
+    BOOST_CHECK_EQUAL(session->writeMetrics().queuedBytes, 100U);
+    BOOST_CHECK_EQUAL(session->writeMetrics().peakQueuedBytes, 100U);
+
+    // the queued messages are taken as one batch and written back to back in order
+    session->completeWrite();
+    BOOST_CHECK_EQUAL(session->writeMetrics().queuedBytes, 90U);
+    BOOST_CHECK_EQUAL(session->writeQueueSize(), 0U);
+    BOOST_CHECK(session->m_cork);
+    session->completeWrite();
+    session->completeWrite();
+    BOOST_CHECK_EQUAL(session->writeMetrics().queuedBytes, 40U);
+    session->completeWrite();
+    BOOST_REQUIRE_EQUAL(session->m_written.size(), 4U);
+    for (size_t i = 0; i < session->m_written.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(session->m_written[i]->size(), (i + 1) * 10);
+        BOOST_CHECK_EQUAL(static_cast<size_t>(session->m_written[i]->front()), i);
+    }
+    BOOST_CHECK(session->m_corked);
+    BOOST_CHECK(!session->m_cork);
+
+    auto metrics = session->writeMetrics();
+    BOOST_CHECK_EQUAL(metrics.sentMsgs, 4U);
+    BOOST_CHECK_EQUAL(metrics.sentBytes, 100U);
+    BOOST_CHECK_EQUAL(metrics.writeBatches, 2U);
+    BOOST_CHECK_EQUAL(metrics.queuedBytes, 0U);
+    BOOST_CHECK_EQUAL(metrics.peakQueuedBytes, 100U);
+    BOOST_CHECK_EQUAL(metrics.rejectedMsgs, 0U);
+
+    // the idle session writes the next message at once
+    session->queueMessage(50, 4);
+    BOOST_CHECK_EQUAL(session->m_written.size(), 5U);
+}
+
+BOOST_AUTO_TEST_CASE(overflowReject)
+{
+    session->setMaxWriteQueueBytes(100);
+    // one message larger than the limit is still accepted by the empty queue
+    BOOST_CHECK(session->tryReserveWriteQueue(150));
+    BOOST_CHECK(!session->tryReserveWriteQueue(1));
+    BOOST_CHECK_EQUAL(session->writeMetrics().queuedBytes, 150U);
+    BOOST_CHECK_EQUAL(session->writeMetrics().rejectedMsgs, 1U);
+
+    Error::Ptr error;
+    session->asyncSendMessage(buildMessage(), Options(),
+        [&error](Error::Ptr _error, std::shared_ptr<MessageFace>, std::shared_ptr<WsSession>) {
+            error = std::move(_error);
+        });
+    BOOST_REQUIRE(error);
+    BOOST_CHECK_EQUAL(error->errorCode(), WsError::WriteQueueOverflow);
+    BOOST_CHECK_EQUAL(session->writeMetrics().rejectedMsgs, 2U);
+    BOOST_CHECK_EQUAL(session->writeMetrics().queuedBytes, 150U);
+    // the rejected messages are dropped, the session is kept
+    BOOST_CHECK(session->isConnected());
+    taskGroup.wait();
+    BOOST_CHECK_EQUAL(disconnected.load(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(overflowDisconnect)
+{
+    session->setMaxWriteQueueBytes(100);
+    session->setWriteQueueOverflowPolicy(WriteQueueOverflowPolicy::Disconnect);
+    BOOST_CHECK(session->tryReserveWriteQueue(100));
+
+    Error::Ptr error;
+    session->asyncSendMessage(buildMessage(), Options(),
+        [&error](Error::Ptr _error, std::shared_ptr<MessageFace>, std::shared_ptr<WsSession>) {
+            error = std::move(_error);
+        });
+    BOOST_REQUIRE(error);
+    BOOST_CHECK_EQUAL(error->errorCode(), WsError::WriteQueueOverflow);
+    // the peer can not keep up with the messages, it is evicted
+    BOOST_CHECK(!session->isConnected());
+    taskGroup.wait();
+    BOOST_CHECK_EQUAL(disconnected.load(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
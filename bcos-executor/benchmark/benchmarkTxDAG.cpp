@@ -0,0 +1,79 @@
+#include "../src/dag/CompactTxDAG.h"
+#include "../src/dag/CriticalFields.h"
+#include "../src/dag/TxDAG2.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <random>
+
+using namespace bcos;
+using namespace bcos::executor;
+using namespace bcos::executor::critical;
+
+// every tx touches 2 of the _keys critical fields, the fewer keys the more conflicts
+static CriticalFieldsInterface::Ptr makeCriticals(size_t _txs, size_t _keys)
+{
+    std::mt19937 random(_txs * _keys);
+    std::uniform_int_distribution<uint32_t> distribution(0, _keys - 1);
+    auto criticals = std::make_shared<CriticalFields>(_txs);
+    for (size_t i = 0; i < _txs; ++i)
+    {
+        auto field = std::make_shared<CriticalFields::CriticalField>();
+        for (auto j = 0; j < 2; ++j)
+        {
+            auto key = distribution(random);
+            field->emplace_back(reinterpret_cast<uint8_t*>(&key),
+                reinterpret_cast<uint8_t*>(&key) + sizeof(key));
+        }
+        criticals->put(i, std::move(field));
+    }
+    return criticals;
+}
+
+template <class DAG>
+static void buildDAG(benchmark::State& state)
+{
+    auto criticals = makeCriticals(state.range(0), state.range(1));
+    for (auto _ : state)
+    {
+        DAG dag;
+        dag.setExecuteTxFunc([](critical::ID) {});
+        dag.init(criticals);
+        benchmark::DoNotOptimize(dag);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class DAG>
+static void buildAndRunDAG(benchmark::State& state)
+{
+    auto criticals = makeCriticals(state.range(0), state.range(1));
+    std::atomic<uint64_t> executed = 0;
+    for (auto _ : state)
+    {
+        DAG dag;
+        dag.setExecuteTxFunc(
+            [&executed](critical::ID id) { executed.fetch_add(id, std::memory_order_relaxed); });
+        dag.init(criticals);
+        dag.run(8);
+    }
+    benchmark::DoNotOptimize(executed.load());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void dagArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"txs", "keys"});
+    for (auto txs : {1000, 20000})
+    {
+        for (auto keys : {16, 1024, 65536})
+        {
+            benchmark->Args({txs, keys});
+        }
+    }
+    benchmark->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(buildDAG<TxDAG2>)->Apply(dagArguments);
+BENCHMARK(buildDAG<CompactTxDAG>)->Apply(dagArguments);
+BENCHMARK(buildAndRunDAG<TxDAG2>)->Apply(dagArguments);
+BENCHMARK(buildAndRunDAG<CompactTxDAG>)->Apply(dagArguments);
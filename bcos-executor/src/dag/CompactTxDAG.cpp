@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/**
+ * @brief : Transaction DAG on compact adjacency arrays
+ * @date: 2026-10-19
+ */
+
+
+#include "CompactTxDAG.h"
+#include "CriticalFields.h"
+#include <tbb/task_arena.h>
+
+using namespace std;
+using namespace bcos;
+using namespace bcos::executor;
+using namespace bcos::executor::critical;
+
+#define DAG_LOG(LEVEL) BCOS_LOG(LEVEL) << LOG_BADGE("DAG")
+
+void CompactTxDAG::init(critical::CriticalFieldsInterface::Ptr _txsCriticals)
+{
+    // must setExecuteTxFunc beforehand
+    assert(f_executeTx);
+
+    auto txsSize = _txsCriticals->size();
+    DAG_LOG(INFO) << LOG_DESC("Begin init compact transaction DAG")
+                  << LOG_KV("transactionNum", txsSize);
+
+    // collect the edges in traverse order, then lay them out by the source tx
+    std::vector<std::pair<ID, ID>> edges;
+    edges.reserve(txsSize);
+    m_roots.clear();
+    m_dependentSize = 0;
+    m_inDegrees = std::vector<std::atomic<ID>>(txsSize);
+
+    auto onConflictHandler = [&](ID pId, ID id) {
+        edges.emplace_back(pId, id);
+        if (m_inDegrees[id].fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            ++m_dependentSize;
+        }
+    };
+    auto onRootHandler = [&](ID id) { m_roots.push_back(id); };
+    auto onAllConflictHandler = [&](ID id) {
+        // ignore normal tx, only handle DAG tx, normal tx has been sent back to be executed by DMC
+        (void)id;
+    };
+    _txsCriticals->traverseDag(
+        onConflictHandler, onRootHandler, onRootHandler, onAllConflictHandler);
+
+    m_offsets.assign(txsSize + 1, 0);
+    for (auto const& edge : edges)
+    {
+        ++m_offsets[edge.first + 1];
+    }
+    for (size_t i = 0; i < txsSize; ++i)
+    {
+        m_offsets[i + 1] += m_offsets[i];
+    }
+    m_edges.resize(edges.size());
+    // the edges are generated in ascending order of the target, keep it in every adjacency list
+    std::vector<ID> cursor(m_offsets.begin(), m_offsets.end() - 1);
+    for (auto const& edge : edges)
+    {
+        m_edges[cursor[edge.first]++] = edge.second;
+    }
+
+    DAG_LOG(TRACE) << LOG_DESC("End init compact transaction DAG")
+                   << LOG_KV("roots", m_roots.size()) << LOG_KV("edges", m_edges.size());
+}
+
+void CompactTxDAG::execute(ID _id, tbb::task_group& _group)
+{
+    auto id = _id;
+    while (id != critical::INVALID_ID)
+    {
+        f_executeTx(id);
+        ID next = critical::INVALID_ID;
+        for (auto i = m_offsets[id]; i < m_offsets[id + 1]; ++i)
+        {
+            auto to = m_edges[i];
+            if (m_inDegrees[to].fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                continue;
+            }
+            if (next == critical::INVALID_ID)
+            {
+                next = to;
+            }
+            else
+            {
+                _group.run([this, to, &_group]() { execute(to, _group); });
+            }
+        }
+        id = next;
+    }
+}
+
+void CompactTxDAG::run(unsigned int threadNum)
+{
+    auto runAll = [this]() {
+        tbb::task_group group;
+        for (auto root : m_roots)
+        {
+            group.run([this, root, &group]() { execute(root, group); });
+        }
+        group.wait();
+    };
+    if (threadNum == 0)
+    {
+        runAll();
+        return;
+    }
+    tbb::task_arena arena(static_cast<int>(threadNum));
+    arena.execute(runAll);
+}
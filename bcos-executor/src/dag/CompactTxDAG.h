@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/**
+ * @brief : Transaction DAG on compact adjacency arrays
+ * @date: 2026-10-19
+ */
+
+
+#pragma once
+#include "./TxDAGInterface.h"
+#include <tbb/task_group.h>
+#include <atomic>
+#include <vector>
+
+
+namespace bcos
+{
+namespace executor
+{
+/**
+ * The lightweight replacement of TxDAG2:
+ * - the edges are kept in a CSR layout (m_offsets/m_edges) instead of one flow graph node per tx
+ * - a tx becomes ready when its atomic in-degree reaches zero
+ * - the ready txs are spawned into a tbb::task_group, the tbb workers steal from each other, the
+ *   worker that releases a tx keeps the first released successor to run it without a spawn
+ */
+class CompactTxDAG : public virtual TxDAGInterface
+{
+public:
+    CompactTxDAG() = default;
+    virtual ~CompactTxDAG() = default;
+
+    void setExecuteTxFunc(ExecuteTxFunc const& _f) override { f_executeTx = _f; };
+
+    void init(critical::CriticalFieldsInterface::Ptr _txsCriticals) override;
+
+    // threadNum = 0 means all the tbb workers
+    void run(unsigned int threadNum) override;
+
+    size_t vertexSize() const { return m_roots.size() + m_dependentSize; }
+    size_t edgeSize() const { return m_edges.size(); }
+
+private:
+    void execute(critical::ID _id, tbb::task_group& _group);
+
+    ExecuteTxFunc f_executeTx;
+    // the out edges of tx i are m_edges[m_offsets[i], m_offsets[i + 1])
+    std::vector<critical::ID> m_offsets;
+    std::vector<critical::ID> m_edges;
+    std::vector<std::atomic<critical::ID>> m_inDegrees;
+    std::vector<critical::ID> m_roots;
+    size_t m_dependentSize = 0;
+};
+
+}  // namespace executor
+}  // namespace bcos
@@ -25,6 +25,7 @@
 #include "../dag/ClockCache.h"
 #include "../dag/CriticalFields.h"
 #include "../dag/ScaleUtils.h"
+#include "../dag/CompactTxDAG.h"
 #include "../dag/TxDAG2.h"
 #include "../executive/BlockContext.h"
 #include "../executive/ExecutiveFactory.h"
@@ -2862,7 +2863,7 @@ void TransactionExecutor::executeTransactionsWithCriticals(
     vector<protocol::ExecutionMessage::UniquePtr>& executionResults)
 {
     // DAG run
-    shared_ptr<TxDAGInterface> txDag = make_shared<TxDAG2>();
+    shared_ptr<TxDAGInterface> txDag = make_shared<CompactTxDAG>();
     txDag->setExecuteTxFunc([this, &inputs, &executionResults](ID id) {
         if (!m_isRunning)
         {
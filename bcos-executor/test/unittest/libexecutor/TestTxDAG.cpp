@@ -19,6 +19,7 @@
  * @date: 2022-01-19
  */
 
+#include "../../../src/dag/CompactTxDAG.h"
 #include "../../../src/dag/TxDAG2.h"
 #include "../../../src/dag/TxDAGFlow.h"
 #include "TxDAG.h"
@@ -267,6 +268,34 @@ BOOST_AUTO_TEST_CASE(TestRun5)
     txDagTest(txDag);
 }
 
+BOOST_AUTO_TEST_CASE(TestCompactRun)
+{
+    auto txDag = make_shared<CompactTxDAG>();
+    txDagTest(txDag);
+    // 17 of the 100 txs are left to DMC, the others are 5 chains on the critical fields
+    BOOST_CHECK_EQUAL(txDag->vertexSize(), 83U);
+    BOOST_CHECK_EQUAL(txDag->edgeSize(), 78U);
+
+    // txs without critical fields are left to DMC
+    std::atomic<size_t> executed = 0;
+    auto criticals = makeCriticals(10, [](ID id) -> vector<bytes> {
+        if (id % 2 == 0)
+        {
+            return {};
+        }
+        return {bytes{1}};
+    });
+    auto chained = make_shared<CompactTxDAG>();
+    chained->setExecuteTxFunc([&](ID id) {
+        BOOST_CHECK_EQUAL(id % 2, 1U);
+        ++executed;
+    });
+    chained->init(criticals);
+    chained->run(2);
+    BOOST_CHECK_EQUAL(executed, 5U);
+    BOOST_CHECK_EQUAL(chained->edgeSize(), 4U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
@@ -49,6 +49,11 @@ enum GatewayMessageType : uint16_t
     RouterTableResponse = 0xb,
     RouterTableRequest = 0xc,
     ForwardMessage = 0xd,
+    // exchange the trained zstd dictionaries after the handshake
+    CompressDictionary = 0xe,
+    CompressDictionaryAck = 0xf,
+    // advertise p2p.connections_per_peer after the handshake
+    ConnectionsPerPeer = 0x10,
     All = 0xff
 };
 /**
@@ -68,6 +68,7 @@ public:
         feature_raw_address,
         feature_rpbft_vrf_type_secp256k1,
         feature_balance_policy2,  // 转账白名单 Transfer whitelist
+        feature_checkpoint_qc,
     };
 
 private:
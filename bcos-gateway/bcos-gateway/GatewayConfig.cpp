@@ -7,6 +7,7 @@
 #include "bcos-crypto/hash/Keccak256.h"
 #include "bcos-framework/protocol/Protocol.h"
 #include "bcos-gateway/Common.h"
+#include "bcos-gateway/libnetwork/Message.h"
 #include "bcos-security/bcos-security/BcosKms.h"
 #include "bcos-utilities/BoostLog.h"
 #include "bcos-utilities/Common.h"
@@ -278,6 +279,11 @@ void GatewayConfig::initP2PConfig(const boost::property_tree::ptree& _pt, bool _
       session_max_read_data_size=
       session_max_send_data_size=
       session_max_send_msg_count=
+      ; unit: KB
+      consensus_write_budget=512
+      txs_sync_write_budget=256
+      block_sync_write_budget=256
+      amop_write_budget=128
       thread_count=
       */
     m_uuid = _pt.get<std::string>("p2p.uuid", "");
@@ -317,6 +323,8 @@ void GatewayConfig::initP2PConfig(const boost::property_tree::ptree& _pt, bool _
     m_enableRIPProtocol = _pt.get<bool>("p2p.enable_rip_protocol", true);
 
     m_enableCompress = _pt.get<bool>("p2p.enable_compression", true);
+    // unit: KB
+    m_compressDictionarySize = _pt.get<uint32_t>("p2p.compression_dictionary_size", 0) * 1024;
 
     constexpr static uint32_t defaultAllowMaxMsgSize = MAX_MESSAGE_LENGTH;
     m_allowMaxMsgSize = _pt.get<uint32_t>("p2p.allow_max_msg_size", defaultAllowMaxMsgSize);
@@ -343,6 +351,32 @@ void GatewayConfig::initP2PConfig(const boost::property_tree::ptree& _pt, bool _
     constexpr static uint32_t defaultMaxSendMsgCount = 10;
     m_maxSendMsgCount = _pt.get<uint32_t>("p2p.session_max_send_msg_count", defaultMaxSendMsgCount);
 
+    m_connectionsPerPeer = _pt.get<uint32_t>("p2p.connections_per_peer", 1);
+    if (m_connectionsPerPeer < 1 || m_connectionsPerPeer > TRAFFIC_CLASS_COUNT)
+    {
+        BOOST_THROW_EXCEPTION(InvalidParameter() << errinfo_comment(
+                                  "initP2PConfig: invalid p2p.connections_per_peer, the value "
+                                  "must be in [1, " +
+                                  std::to_string(TRAFFIC_CLASS_COUNT) + "]"));
+    }
+
+    // unit: KB, the bytes each traffic class writes to a session in one round before the next
+    // class is served
+    constexpr static std::array<const char*, TRAFFIC_CLASS_COUNT> budgetKeys = {
+        "p2p.consensus_write_budget", "p2p.txs_sync_write_budget", "p2p.block_sync_write_budget",
+        "p2p.amop_write_budget"};
+    for (size_t i = 0; i < TRAFFIC_CLASS_COUNT; ++i)
+    {
+        auto budget = _pt.get<uint32_t>(budgetKeys[i], DEFAULT_TRAFFIC_CLASS_BUDGETS[i] / 1024);
+        if (budget == 0)
+        {
+            BOOST_THROW_EXCEPTION(InvalidParameter() << errinfo_comment(
+                                      std::string("initP2PConfig: invalid ") + budgetKeys[i] +
+                                      ", the value must be greater than 0"));
+        }
+        m_trafficClassBudgets[i] = static_cast<size_t>(budget) * 1024;
+    }
+
     constexpr static uint32_t defaultThreadPoolSize = 8;
     m_threadPoolSize = _pt.get<uint32_t>("p2p.thread_count", defaultThreadPoolSize);
 
@@ -359,6 +393,12 @@ void GatewayConfig::initP2PConfig(const boost::property_tree::ptree& _pt, bool _
                              << LOG_KV("p2p.session_max_read_data_size", m_maxReadDataSize)
                              << LOG_KV("p2p.session_max_send_data_size", m_maxSendDataSize)
                              << LOG_KV("p2p.session_max_send_msg_count", m_maxSendMsgCount)
+                             << LOG_KV("p2p.connections_per_peer", m_connectionsPerPeer)
+                             << LOG_KV("p2p.consensus_write_budget", m_trafficClassBudgets[0])
+                             << LOG_KV("p2p.txs_sync_write_budget", m_trafficClassBudgets[1])
+                             << LOG_KV("p2p.block_sync_write_budget", m_trafficClassBudgets[2])
+                             << LOG_KV("p2p.amop_write_budget", m_trafficClassBudgets[3])
+                             << LOG_KV("p2p.compression_dictionary_size", m_compressDictionarySize)
                              << LOG_KV("p2p.thread_count", m_threadPoolSize)
                              << LOG_KV("p2p.nodes_path", m_nodePath)
                              << LOG_KV("p2p.nodes_file", m_nodeFileName)
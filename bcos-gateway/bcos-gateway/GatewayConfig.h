@@ -8,6 +8,7 @@
 #include "bcos-crypto/interfaces/crypto/Hash.h"
 #include "bcos-framework/gateway/GatewayTypeDef.h"
 #include "bcos-gateway/Common.h"
+#include "bcos-gateway/libnetwork/Message.h"
 #include "bcos-utilities/ObjectCounter.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/asio/ssl/context.hpp>
@@ -277,6 +278,27 @@ public:
 
     uint32_t maxMsgCountSendOneTime() const { return m_maxSendMsgCount; }
     void setMaxSendMsgCount(uint32_t _maxSendMsgCount) { m_maxSendMsgCount = _maxSendMsgCount; }
+
+    uint32_t compressDictionarySize() const { return m_compressDictionarySize; }
+    void setCompressDictionarySize(uint32_t _compressDictionarySize)
+    {
+        m_compressDictionarySize = _compressDictionarySize;
+    }
+
+    uint32_t connectionsPerPeer() const { return m_connectionsPerPeer; }
+    void setConnectionsPerPeer(uint32_t _connectionsPerPeer)
+    {
+        m_connectionsPerPeer = _connectionsPerPeer;
+    }
+
+    std::array<std::size_t, TRAFFIC_CLASS_COUNT> const& trafficClassBudgets() const
+    {
+        return m_trafficClassBudgets;
+    }
+    void setTrafficClassBudgets(std::array<std::size_t, TRAFFIC_CLASS_COUNT> _budgets)
+    {
+        m_trafficClassBudgets = _budgets;
+    }
     // NodeIDType:
     // h512(true == m_smSSL)
     // h2048(false == m_smSSL)
@@ -327,6 +349,13 @@ private:
     uint32_t m_maxReadDataSize = 40 * 1024;
     uint32_t m_maxSendDataSize = 1024 * 1024;
     uint32_t m_maxSendMsgCount = 10;
+    // the number of the parallel connections to each peer, the traffic classes are spread over them
+    uint32_t m_connectionsPerPeer = 1;
+    // the bytes each traffic class writes per round of the session write loop
+    std::array<std::size_t, TRAFFIC_CLASS_COUNT> m_trafficClassBudgets =
+        DEFAULT_TRAFFIC_CLASS_BUDGETS;
+    // the capacity in bytes of the zstd dictionaries trained from the traffic, 0 means disabled
+    uint32_t m_compressDictionarySize = 0;
     //
     std::string m_uuid;
     // if SM SSL connection or not
@@ -23,6 +23,7 @@
 #include "bcos-gateway/libp2p/P2PMessageV2.h"
 #include "bcos-gateway/libp2p/Service.h"
 #include "bcos-gateway/libp2p/ServiceV2.h"
+#include "bcos-gateway/libp2p/ZstdDictionaryManager.h"
 #include "bcos-gateway/libp2p/router/RouterTableImpl.h"
 #include "bcos-gateway/libratelimit/GatewayRateLimiter.h"
 #include "bcos-gateway/libratelimit/RateLimiterManager.h"
@@ -628,6 +629,7 @@ std::shared_ptr<Service> GatewayFactory::buildService(const GatewayConfig::Ptr&
     auto sessionFactory = std::make_shared<SessionFactory>(selfInfo,
         _config->sessionRecvBufferSize(), _config->allowMaxMsgSize(), _config->maxReadDataSize(),
         _config->maxSendDataSize(), _config->maxMsgCountSendOneTime(), _config->enableCompress());
+    sessionFactory->setTrafficClassBudgets(_config->trafficClassBudgets());
     // KeyFactory
     auto keyFactory = std::make_shared<bcos::crypto::KeyFactoryImpl>();
     // Session Callback manager
@@ -665,6 +667,13 @@ std::shared_ptr<Service> GatewayFactory::buildService(const GatewayConfig::Ptr&
 
     service->setHost(host);
     service->setStaticNodes(_config->connectedNodes());
+    service->setConnectionsPerPeer(_config->connectionsPerPeer());
+    if (_config->enableCompress() && _config->compressDictionarySize() > 0)
+    {
+        auto dictionaryManager = std::make_shared<ZstdDictionaryManager>(
+            _config->compressDictionarySize(), static_cast<int>(c_zstdCompressLevel));
+        service->setDictionaryManager(dictionaryManager);
+    }
 
     GatewayP2PReloadHandler::config = _config;
     GatewayP2PReloadHandler::service = service;
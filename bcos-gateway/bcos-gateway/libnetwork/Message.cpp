@@ -10,7 +10,7 @@ std::size_t bcos::gateway::EncodedMessage::headerSize() const
 }
 std::size_t bcos::gateway::EncodedMessage::payloadSize() const
 {
-    return payload.size();
+    return payload ? payload->size() : 0;
 }
 uint32_t bcos::gateway::MessageFactory::newSeq()
 {
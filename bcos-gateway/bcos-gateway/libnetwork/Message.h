@@ -21,18 +21,40 @@
 #pragma once
 
 #include "bcos-utilities/Common.h"
+#include "bcos-utilities/ZstdCompress.h"
 #include <boost/asio/buffer.hpp>
 #include <any>
+#include <array>
 
 
 namespace bcos::gateway
 {
 
+class ZstdPeerDictionaries;
+
+// the traffic classes of the session write queues, see Session::tryPopSomeEncodedMsgs
+enum class TrafficClass : uint8_t
+{
+    // consensus messages and the small gateway control messages, first in every round
+    Consensus = 0,
+    TxsSync,
+    BlockSync,
+    AMOP,
+};
+constexpr static size_t TRAFFIC_CLASS_COUNT = 4;
+// the bytes each traffic class writes per round of Session::tryPopSomeEncodedMsgs
+constexpr static std::array<std::size_t, TRAFFIC_CLASS_COUNT> DEFAULT_TRAFFIC_CLASS_BUDGETS = {
+    512 * 1024UL, 256 * 1024UL, 256 * 1024UL, 128 * 1024UL};
+
 struct EncodedMessage
 {
     bcos::bytes header;
-    bcos::bytes payload;
+    // the (compressed) payload is encoded once and shared by all the sessions it is sent to, only
+    // the header is encoded for each session
+    std::shared_ptr<const bcos::bytes> payload;
     bool compress = true;
+    // the dictionary acknowledged by the peer for the traffic class of the message, nullptr if none
+    ZstdDictionary::Ptr dictionary;
 
     std::size_t dataSize() const;
     std::size_t headerSize() const;
@@ -67,6 +89,10 @@ public:
     virtual bool encode(EncodedMessage& _buffer) const = 0;
     virtual bool encodeHeader(bytes& _buffer) const = 0;
     virtual const std::any& extAttributes() const = 0;
+    // the write queue of the session the message is put into
+    virtual TrafficClass trafficClass() const = 0;
+    // the dictionaries installed by the peer of the session the message is received from
+    virtual void setPeerDictionaries(std::shared_ptr<const ZstdPeerDictionaries> /*unused*/) {}
 
     // TODO: move the follow interfaces to P2PMessage
     virtual std::string const& srcP2PNodeID() const = 0;
@@ -81,19 +81,27 @@ bool Session::active(Host& server) const
     return m_active && server.haveNetwork() && m_socket && m_socket->isConnected();
 }
 
-static void send(Session& session, EncodedMessage encodedMsg)
+static void pushWriteQueue(Session& session, TrafficClass trafficClass, Payload payload)
+{
+    auto index = static_cast<size_t>(trafficClass);
+    session.m_writeQueueMsgs[index] += 1;
+    session.m_writeQueueBytes[index] += payload.size();
+    session.m_writeQueues[index].push(std::move(payload));
+}
+
+static void send(Session& session, TrafficClass trafficClass, EncodedMessage encodedMsg)
 {
     if (!session.active() || !session.m_socket->isConnected())
     {
         return;
     }
 
-    session.m_writeQueue.push({.m_data = std::move(encodedMsg), .m_callback = {}});
+    pushWriteQueue(session, trafficClass, {.m_data = std::move(encodedMsg), .m_callback = {}});
     session.write();
 }
 
-static void send(Session& session, ::ranges::input_range auto payloads,
-    std::function<void(boost::system::error_code)> callback)
+static void send(Session& session, TrafficClass trafficClass,
+    ::ranges::input_range auto payloads, std::function<void(boost::system::error_code)> callback)
 {
     if (!session.active() || !session.m_socket->isConnected())
     {
@@ -111,7 +119,7 @@ static void send(Session& session, ::ranges::input_range auto payloads,
         vec.emplace_back(data.data(), data.size());
     }
 
-    session.m_writeQueue.push(std::move(payload));
+    pushWriteQueue(session, trafficClass, std::move(payload));
     session.write();
 }
 
@@ -197,6 +205,10 @@ void Session::asyncSendMessage(Message::Ptr message, Options options, SessionCal
 
     EncodedMessage encodedMessage;
     encodedMessage.compress = m_enableCompress;
+    if (m_enableCompress)
+    {
+        encodedMessage.dictionary = compressDictionary(message->trafficClass());
+    }
     message->encode(encodedMessage);
 
     if (c_fileLogLevel <= LogLevel::TRACE)
@@ -210,12 +222,33 @@ void Session::asyncSendMessage(Message::Ptr message, Options options, SessionCal
                            << LOG_KV("this", this);
     }
 
-    send(*this, encodedMessage);
+    send(*this, message->trafficClass(), std::move(encodedMessage));
 }
 
 std::size_t Session::writeQueueSize()
 {
-    return static_cast<std::size_t>(!m_writeQueue.empty());
+    return ::ranges::accumulate(m_writeQueueMsgs, std::size_t(0),
+        [](std::size_t sum, const std::atomic<std::size_t>& msgs) { return sum + msgs.load(); });
+}
+
+std::array<std::size_t, TRAFFIC_CLASS_COUNT> Session::writeQueueBytes()
+{
+    std::array<std::size_t, TRAFFIC_CLASS_COUNT> bytes{};
+    for (size_t i = 0; i < TRAFFIC_CLASS_COUNT; ++i)
+    {
+        bytes[i] = m_writeQueueBytes[i].load();
+    }
+    return bytes;
+}
+
+void Session::setTrafficClassBudget(TrafficClass _trafficClass, std::size_t _budget)
+{
+    m_trafficClassBudgets[static_cast<size_t>(_trafficClass)] = _budget;
+}
+
+std::size_t Session::trafficClassBudget(TrafficClass _trafficClass) const
+{
+    return m_trafficClassBudgets[static_cast<size_t>(_trafficClass)];
 }
 
 void Session::onWrite(boost::system::error_code ec, std::size_t /*unused*/)
@@ -254,11 +287,36 @@ bool Session::tryPopSomeEncodedMsgs(
     // data
     size_t totalDataSize = 0;
     Payload payload;
-    // while (totalDataSize < _maxSendDataSize && m_writeQueue.try_pop(payload))
-    while (m_writeQueue.try_pop(payload))
-    {
-        totalDataSize += payload.size();
+    auto popPayload = [&](size_t index) {
+        if (!m_writeQueues[index].try_pop(payload))
+        {
+            return false;
+        }
+        auto size = payload.size();
+        m_writeQueueMsgs[index] -= 1;
+        m_writeQueueBytes[index] -= size;
+        totalDataSize += size;
         encodedMsgs.emplace_back(std::move(payload));
+        return true;
+    };
+
+    // weighted round-robin over the classes, each class writes at most its budget per round, the
+    // consensus class goes first with the largest budget, but a multi-MB proposal can not hold the
+    // other classes back for longer than one round
+    bool popped = true;
+    while (popped && totalDataSize < _maxSendDataSize)
+    {
+        popped = false;
+        for (size_t index = 0; index < TRAFFIC_CLASS_COUNT; ++index)
+        {
+            auto classStart = totalDataSize;
+            auto budget = std::max<size_t>(m_trafficClassBudgets[index], 1);
+            while ((totalDataSize - classStart) < budget &&
+                   totalDataSize < _maxSendDataSize && popPayload(index))
+            {
+                popped = true;
+            }
+        }
     }
 
     return totalDataSize > 0;
@@ -491,6 +549,7 @@ void Session::doRead()
                 while (true)
                 {
                     Message::Ptr message = session->m_messageFactory->buildMessage();
+                    message->setPeerDictionaries(session->m_peerDictionaries);
                     try
                     {
                         auto writeBuffer = recvBuffer.asWriteBuffer();
@@ -780,7 +839,8 @@ task::Task<Message::Ptr> fastSendMessageWithResponse(
                 handler->startTime = utcSteadyTime();
             }
             m_sessionCallbackManager.get().addCallback(seq, std::move(handler));
-            ::send(*m_self.lock(), ::ranges::views::all(m_view.get()), {});
+            ::send(*m_self.lock(), m_message.get().trafficClass(),
+                ::ranges::views::all(m_view.get()), {});
         }
         Message::Ptr await_resume()
         {
@@ -805,18 +865,20 @@ task::Task<Message::Ptr> fastSendMessageWithResponse(
 }
 
 template <typename View>
-task::Task<void> fastSendMessageWithoutResponse(Session& session, View view)
+task::Task<void> fastSendMessageWithoutResponse(
+    Session& session, TrafficClass trafficClass, View view)
 {
     struct Awaitable
     {
         std::reference_wrapper<Session> m_self;
+        TrafficClass m_trafficClass;
         std::reference_wrapper<View> m_view;
         NetworkException m_exception;
 
         constexpr static bool await_ready() noexcept { return false; }
         void await_suspend(std::coroutine_handle<> handle)
         {
-            ::send(m_self, ::ranges::views::all(m_view.get()),
+            ::send(m_self, m_trafficClass, ::ranges::views::all(m_view.get()),
                 [this, handle](boost::system::error_code errorCode) {
                     if (errorCode.failed())
                     {
@@ -832,7 +894,7 @@ task::Task<void> fastSendMessageWithoutResponse(Session& session, View view)
                 BOOST_THROW_EXCEPTION(m_exception);
             }
         }
-    } awaitable{session, view, {}};
+    } awaitable{session, trafficClass, view, {}};
     co_await awaitable;
 }
 
@@ -871,7 +933,7 @@ bcos::task::Task<Message::Ptr> bcos::gateway::Session::fastSendMessage(
     }
     else
     {
-        co_await fastSendMessageWithoutResponse(*this, std::move(view));
+        co_await fastSendMessageWithoutResponse(*this, message.trafficClass(), std::move(view));
         co_return {};
     }
 }
@@ -881,7 +943,7 @@ size_t bcos::gateway::Payload::size() const
     return std::visit(
         bcos::overloaded(
             [](const EncodedMessage& encodedMessage) -> size_t {
-                return encodedMessage.header.size() + encodedMessage.payload.size();
+                return encodedMessage.dataSize();
             },
             [](const boost::container::small_vector<bytesConstRef, 3>& refs) {
                 return ::ranges::accumulate(refs, size_t(0),
@@ -1047,6 +1109,23 @@ bool bcos::gateway::Session::enableCompress() const
 {
     return m_enableCompress;
 }
+void bcos::gateway::Session::setCompressDictionary(
+    TrafficClass _trafficClass, ZstdDictionary::Ptr _dictionary)
+{
+    std::lock_guard lock(x_compressDictionaries);
+    m_compressDictionaries[static_cast<size_t>(_trafficClass)] = std::move(_dictionary);
+}
+void bcos::gateway::Session::setPeerDictionaries(
+    std::shared_ptr<const ZstdPeerDictionaries> _dictionaries)
+{
+    m_peerDictionaries = std::move(_dictionaries);
+}
+bcos::ZstdDictionary::Ptr bcos::gateway::Session::compressDictionary(
+    TrafficClass _trafficClass) const
+{
+    std::lock_guard lock(x_compressDictionaries);
+    return m_compressDictionaries[static_cast<size_t>(_trafficClass)];
+}
 bcos::gateway::SessionRecvBuffer& bcos::gateway::Session::recvBuffer()
 {
     return m_recvBuffer;
@@ -1069,12 +1148,20 @@ std::shared_ptr<SessionFace> bcos::gateway::SessionFactory::createSession(Host&
     session->setMaxSendDataSize(m_maxSendDataSize);
     session->setMaxSendMsgCountS(m_maxSendMsgCountS);
     session->setEnableCompress(m_enableCompress);
+    for (size_t i = 0; i < TRAFFIC_CLASS_COUNT; ++i)
+    {
+        session->setTrafficClassBudget(static_cast<TrafficClass>(i), m_trafficClassBudgets[i]);
+    }
     BCOS_LOG(INFO) << LOG_BADGE("SessionFactory") << LOG_DESC("create new session")
                    << LOG_KV("sessionRecvBufferSize", m_sessionRecvBufferSize)
                    << LOG_KV("allowMaxMsgSize", m_allowMaxMsgSize)
                    << LOG_KV("maxReadDataSize", m_maxReadDataSize)
                    << LOG_KV("maxSendDataSize", m_maxSendDataSize)
                    << LOG_KV("maxSendMsgCountS", m_maxSendMsgCountS)
-                   << LOG_KV("enableCompress", m_enableCompress);
+                   << LOG_KV("enableCompress", m_enableCompress)
+                   << LOG_KV("consensusBudget", m_trafficClassBudgets[0])
+                   << LOG_KV("txsSyncBudget", m_trafficClassBudgets[1])
+                   << LOG_KV("blockSyncBudget", m_trafficClassBudgets[2])
+                   << LOG_KV("amopBudget", m_trafficClassBudgets[3]);
     return session;
 }
@@ -18,6 +18,7 @@
 #include <boost/asio/buffer.hpp>
 #include <boost/container/small_vector.hpp>
 #include <boost/heap/priority_queue.hpp>
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -83,7 +84,11 @@ struct Payload
         std::visit(bcos::overloaded(
                        [&](const EncodedMessage& encodedMessage) {
                            *output = {encodedMessage.header.data(), encodedMessage.header.size()};
-                           *output = {encodedMessage.payload.data(), encodedMessage.payload.size()};
+                           if (encodedMessage.payload)
+                           {
+                               *output = {encodedMessage.payload->data(),
+                                   encodedMessage.payload->size()};
+                           }
                        },
                        [&](const MessageList& refs) {
                            for (const auto& ref : refs)
@@ -127,6 +132,16 @@ public:
     bool active(Host& server) const;
 
     std::size_t writeQueueSize() override;
+    std::array<std::size_t, TRAFFIC_CLASS_COUNT> writeQueueBytes() override;
+
+    // the bytes of the traffic class written in one round of tryPopSomeEncodedMsgs
+    void setTrafficClassBudget(TrafficClass _trafficClass, std::size_t _budget);
+    std::size_t trafficClassBudget(TrafficClass _trafficClass) const;
+
+    void setCompressDictionary(
+        TrafficClass _trafficClass, ZstdDictionary::Ptr _dictionary) override;
+    ZstdDictionary::Ptr compressDictionary(TrafficClass _trafficClass) const;
+    void setPeerDictionaries(std::shared_ptr<const ZstdPeerDictionaries> _dictionaries) override;
 
     virtual Host& host();
 
@@ -173,6 +188,10 @@ public:
     /**
      * @brief The packets that can be sent are obtained based on the configured policy
      *
+     * The traffic classes are drained in weighted round-robin by their byte budgets until
+     * _maxSendDataSize is reached, the consensus class goes first in every round, so that no
+     * class waits behind more than one budget of another class
+     *
      * @param encodedMsgs
      * @param _maxSendDataSize
      * @param _maxSendMsgCount
@@ -199,6 +218,10 @@ public:
     uint32_t m_allowMaxMsgSize = 32 * 1024 * 1024;
     //
     bool m_enableCompress = true;
+    // the dictionaries acknowledged by the peer, indexed by TrafficClass
+    std::array<ZstdDictionary::Ptr, TRAFFIC_CLASS_COUNT> m_compressDictionaries;
+    mutable std::mutex x_compressDictionaries;
+    std::shared_ptr<const ZstdPeerDictionaries> m_peerDictionaries;
     // ------ for optimize send message parameters  end ---------------
 
     /// Drop the connection for the reason @a _reason.
@@ -221,7 +244,12 @@ public:
     std::shared_ptr<SocketFace> m_socket;   ///< Socket of peer's connection.
 
     MessageFactory::Ptr m_messageFactory;
-    tbb::concurrent_queue<Payload> m_writeQueue;
+    // one write queue for each traffic class, indexed by TrafficClass
+    std::array<tbb::concurrent_queue<Payload>, TRAFFIC_CLASS_COUNT> m_writeQueues;
+    std::array<std::atomic<std::size_t>, TRAFFIC_CLASS_COUNT> m_writeQueueMsgs;
+    std::array<std::atomic<std::size_t>, TRAFFIC_CLASS_COUNT> m_writeQueueBytes;
+    std::array<std::size_t, TRAFFIC_CLASS_COUNT> m_trafficClassBudgets =
+        DEFAULT_TRAFFIC_CLASS_BUDGETS;
     std::mutex m_writingQueueMutex;
     bool m_active = false;
 
@@ -271,6 +299,12 @@ public:
         std::shared_ptr<SocketFace> const& _socket, MessageFactory::Ptr& _messageFactory,
         SessionCallbackManagerInterface::Ptr& _sessionCallbackManager);
 
+    // the bytes each traffic class writes per round, indexed by TrafficClass
+    void setTrafficClassBudgets(std::array<std::size_t, TRAFFIC_CLASS_COUNT> _budgets)
+    {
+        m_trafficClassBudgets = _budgets;
+    }
+
 private:
     P2PInfo m_hostInfo;
     uint32_t m_sessionRecvBufferSize;
@@ -279,6 +313,8 @@ private:
     uint32_t m_maxSendDataSize{0};
     uint32_t m_maxSendMsgCountS{0};
     bool m_enableCompress = true;
+    std::array<std::size_t, TRAFFIC_CLASS_COUNT> m_trafficClassBudgets =
+        DEFAULT_TRAFFIC_CLASS_BUDGETS;
 };
 
 }  // namespace bcos::gateway
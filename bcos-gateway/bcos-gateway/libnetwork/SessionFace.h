@@ -19,6 +19,7 @@
 #include "bcos-task/Task.h"
 #include "bcos-utilities/Error.h"
 #include <boost/asio.hpp>
+#include <array>
 #include <optional>
 #include <range/v3/view/any_view.hpp>
 
@@ -60,6 +61,18 @@ public:
 
     virtual bool active() const = 0;
 
+    // the number of the messages waiting to be written
     virtual std::size_t writeQueueSize() = 0;
+    // the bytes waiting to be written of each traffic class, indexed by TrafficClass
+    virtual std::array<std::size_t, TRAFFIC_CLASS_COUNT> writeQueueBytes() = 0;
+
+    // compress the messages of the traffic class with the dictionary the peer has installed
+    virtual void setCompressDictionary(
+        TrafficClass /*_trafficClass*/, ZstdDictionary::Ptr /*_dictionary*/)
+    {}
+    // decompress the received messages with the dictionaries the peer has sent, must be set
+    // before start
+    virtual void setPeerDictionaries(std::shared_ptr<const ZstdPeerDictionaries> /*_dictionaries*/)
+    {}
 };
 }  // namespace bcos::gateway
@@ -17,11 +17,14 @@ namespace gateway
 #define SERVICE_LOG(LEVEL) BCOS_LOG(LEVEL) << "[P2PService][Service]"
 #define SERVICE2_LOG(LEVEL) BCOS_LOG(LEVEL) << "[P2PService][Service2]"
 #define SERVICE_ROUTER_LOG(LEVEL) BCOS_LOG(LEVEL) << "[P2PService][Router]"
+#define COMPRESS_DICT_LOG(LEVEL) BCOS_LOG(LEVEL) << "[P2PService][CompressDictionary]"
 
 /// default compress threshold: 1KB
 const uint64_t c_compressThreshold = 1024;
 /// default zstd compress level:
 const uint64_t c_zstdCompressLevel = 1;
+/// the payloads compressed with the trained dictionary can be much smaller, default: 128B
+const uint64_t c_dictCompressThreshold = 128;
 
 }  // namespace gateway
 }  // namespace bcos
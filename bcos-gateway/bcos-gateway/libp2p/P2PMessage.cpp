@@ -22,6 +22,7 @@
 #include "bcos-framework/gateway/GatewayTypeDef.h"
 #include "bcos-gateway/Common.h"
 #include "bcos-gateway/libp2p/Common.h"
+#include "bcos-gateway/libp2p/ZstdDictionaryManager.h"
 #include "bcos-utilities/ZstdCompress.h"
 #include <boost/asio/detail/socket_ops.hpp>
 
@@ -204,22 +205,27 @@ bool bcos::gateway::P2PMessage::encodeHeaderImpl(bytes& _buffer) const
 
 bool P2PMessage::encode(EncodedMessage& _buffer) const
 {
-    bool isCompressSuccess = false;
-    if (_buffer.compress)
+    // the message may be encoded for several sessions concurrently when broadcast
+    std::lock_guard lock(x_encode);
+    std::shared_ptr<const bytes> compressData;
+    if (_buffer.compress && _buffer.dictionary)
     {
-        bcos::bytes compressData;
-        if (tryToCompressPayload(compressData))
-        {
-            isCompressSuccess = true;
-            // set compress flag
-            m_ext |= bcos::protocol::MessageExtFieldFlag::COMPRESS;
-            _buffer.payload = std::move(compressData);
-        }
+        compressData = compressedPayload(*_buffer.dictionary);
     }
-
-    // No data compression is performed
-    if (!isCompressSuccess)
+    if (_buffer.compress && !compressData)
+    {
+        compressData = compressedPayload();
+    }
+    if (compressData)
+    {
+        // set compress flag
+        m_ext |= bcos::protocol::MessageExtFieldFlag::COMPRESS;
+        _buffer.payload = std::move(compressData);
+    }
+    else
     {
+        // No data compression is performed, the flag may be set by the former session
+        m_ext &= (~bcos::protocol::MessageExtFieldFlag::COMPRESS);
         _buffer.payload = m_payload;
     }
 
@@ -231,7 +237,7 @@ bool P2PMessage::encode(EncodedMessage& _buffer) const
     }
 
     *(uint32_t*)headerBuffer.data() = boost::asio::detail::socket_ops::host_to_network_long(
-        headerBuffer.size() + _buffer.payload.size());
+        headerBuffer.size() + _buffer.payloadSize());
 
     _buffer.header = std::move(headerBuffer);
     return true;
@@ -243,9 +249,11 @@ bool P2PMessage::encode(bcos::bytes& _buffer)
     _buffer.swap(emptyBuffer);
 
     // compress payload
-    bcos::bytes compressData;
+    std::unique_lock lock(x_encode);
+    auto compressData = compressedPayload();
+    lock.unlock();
     bool isCompressSuccess = false;
-    if (tryToCompressPayload(compressData))
+    if (compressData)
     {
         isCompressSuccess = true;
         // set compress flag
@@ -261,14 +269,15 @@ bool P2PMessage::encode(bcos::bytes& _buffer)
     if (isCompressSuccess)
     {
         P2PMSG_LOG(TRACE) << LOG_DESC("compress payload success")
-                          << LOG_KV("compressedData", (char*)compressData.data())
+                          << LOG_KV("compressedSize", compressData->size())
                           << LOG_KV("packageType", m_packetType) << LOG_KV("ext", m_ext)
                           << LOG_KV("seq", m_seq);
-        _buffer.insert(_buffer.end(), compressData.begin(), compressData.end());
+        _buffer.insert(_buffer.end(), compressData->begin(), compressData->end());
     }
     else
     {
-        _buffer.insert(_buffer.end(), m_payload.begin(), m_payload.end());
+        auto data = payload();
+        _buffer.insert(_buffer.end(), data.begin(), data.end());
     }
     *(uint32_t*)_buffer.data() =
         boost::asio::detail::socket_ops::host_to_network_long(_buffer.size());
@@ -280,7 +289,7 @@ bool P2PMessage::encode(bcos::bytes& _buffer)
 /// compress the payload data to be sended
 bool P2PMessage::tryToCompressPayload(bytes& compressData) const
 {
-    if (m_payload.size() <= bcos::gateway::c_compressThreshold)
+    if (payload().size() <= bcos::gateway::c_compressThreshold)
     {
         return false;
     }
@@ -291,10 +300,54 @@ bool P2PMessage::tryToCompressPayload(bytes& compressData) const
     }
 
     bool isCompressSuccess =
-        ZstdCompress::compress(ref(m_payload), compressData, bcos::gateway::c_zstdCompressLevel);
+        ZstdCompress::compress(payload(), compressData, bcos::gateway::c_zstdCompressLevel);
     return isCompressSuccess;
 }
 
+// Note: must be called with x_encode held
+std::shared_ptr<const bytes> P2PMessage::compressedPayload() const
+{
+    // the version is set per session, the sessions with the old protocol never receive compressed
+    // payloads
+    if (m_version < (uint16_t)(bcos::protocol::ProtocolVersion::V2))
+    {
+        return nullptr;
+    }
+    if (!m_compressAttempted)
+    {
+        m_compressAttempted = true;
+        bcos::bytes compressData;
+        if (tryToCompressPayload(compressData))
+        {
+            m_compressedPayload = std::make_shared<const bytes>(std::move(compressData));
+        }
+    }
+    return m_compressedPayload;
+}
+
+// Note: must be called with x_encode held
+std::shared_ptr<const bytes> P2PMessage::compressedPayload(const ZstdDictionary& _dictionary) const
+{
+    if (m_version < (uint16_t)(bcos::protocol::ProtocolVersion::V2) ||
+        payload().size() <= bcos::gateway::c_dictCompressThreshold)
+    {
+        return nullptr;
+    }
+    // the sessions of a broadcast share the dictionary unless one of the peers lags a version
+    if (m_dictCompressedID != _dictionary.id())
+    {
+        m_dictCompressedID = _dictionary.id();
+        m_dictCompressedPayload.reset();
+        bcos::bytes compressData;
+        if (ZstdCompress::compress(payload(), compressData, _dictionary) &&
+            compressData.size() < payload().size())
+        {
+            m_dictCompressedPayload = std::make_shared<const bytes>(std::move(compressData));
+        }
+    }
+    return m_dictCompressedPayload;
+}
+
 int32_t P2PMessage::decodeHeader(const bytesConstRef& _buffer)
 {
     int32_t offset = 0;
@@ -365,13 +418,38 @@ int32_t P2PMessage::decode(const bytesConstRef& _buffer)
     checkOffset(offset, m_length);
     auto data = _buffer.getCroppedData(offset, m_length - offset);
     // raw data cropped from buffer, maybe be compressed or not
+    m_compressedPayload.reset();
+    m_compressAttempted = false;
+    m_dictCompressedPayload.reset();
+    m_dictCompressedID = 0;
 
     // uncompress payload
     // payload has been compressed
     if ((m_ext & bcos::protocol::MessageExtFieldFlag::COMPRESS) ==
         bcos::protocol::MessageExtFieldFlag::COMPRESS)
     {
-        bool isUncompressSuccess = ZstdCompress::uncompress(data, m_payload);
+        bytes payloadData;
+        bool isUncompressSuccess = false;
+        // the payload compressed with the dictionary the peer trained and sent to us
+        if (auto dictionaryID = ZstdCompress::dictionaryID(data); dictionaryID != 0)
+        {
+            auto dictionary = m_peerDictionaries ?
+                                  m_peerDictionaries->find(trafficClass(), dictionaryID) :
+                                  nullptr;
+            if (!dictionary)
+            {
+                P2PMSG_LOG(ERROR) << LOG_DESC("decode message error, unknown zstd dictionary")
+                                  << LOG_KV("dictionary", dictionaryID)
+                                  << LOG_KV("trafficClass", static_cast<uint32_t>(trafficClass()))
+                                  << LOG_KV("packageType", m_packetType) << LOG_KV("seq", m_seq);
+                return MessageDecodeStatus::MESSAGE_ERROR;
+            }
+            isUncompressSuccess = ZstdCompress::uncompress(data, payloadData, *dictionary);
+        }
+        else
+        {
+            isUncompressSuccess = ZstdCompress::uncompress(data, payloadData);
+        }
         if (!isUncompressSuccess)
         {
             P2PMSG_LOG(ERROR) << LOG_DESC("ZstdCompress decode message error, uncompress failed")
@@ -388,10 +466,11 @@ int32_t P2PMessage::decode(const bytesConstRef& _buffer)
         }
         // reset ext
         m_ext &= (~bcos::protocol::MessageExtFieldFlag::COMPRESS);
+        m_payload = std::make_shared<const bytes>(std::move(payloadData));
     }
     else
     {
-        m_payload.assign(data.begin(), data.end());
+        m_payload = std::make_shared<const bytes>(data.begin(), data.end());
     }
 
     return (int32_t)m_length;
@@ -495,11 +574,16 @@ void bcos::gateway::P2PMessage::setOptions(P2PMessageOptions _options)
 }
 bcos::bytesConstRef bcos::gateway::P2PMessage::payload() const
 {
-    return bcos::ref(m_payload);
+    return m_payload ? bcos::ref(*m_payload) : bcos::bytesConstRef();
 }
 void bcos::gateway::P2PMessage::setPayload(bytes _payload)
 {
-    m_payload = std::move(_payload);
+    std::lock_guard lock(x_encode);
+    m_payload = std::make_shared<const bytes>(std::move(_payload));
+    m_compressedPayload.reset();
+    m_compressAttempted = false;
+    m_dictCompressedPayload.reset();
+    m_dictCompressedID = 0;
 }
 void bcos::gateway::P2PMessage::setRespPacket()
 {
@@ -509,6 +593,36 @@ bool bcos::gateway::P2PMessage::isRespPacket() const
 {
     return (m_ext & bcos::protocol::MessageExtFieldFlag::RESPONSE) != 0;
 }
+bcos::gateway::TrafficClass bcos::gateway::P2PMessage::trafficClass() const
+{
+    if (m_packetType == GatewayMessageType::AMOPMessageType)
+    {
+        return TrafficClass::AMOP;
+    }
+    // heartbeat, handshake, router table and the response messages of the gateway
+    if (!hasOptions())
+    {
+        return TrafficClass::Consensus;
+    }
+    switch (m_options.moduleID())
+    {
+    case bcos::protocol::ModuleID::PBFT:
+    case bcos::protocol::ModuleID::Raft:
+    case bcos::protocol::ModuleID::ConsTxsSync:
+        return TrafficClass::Consensus;
+    case bcos::protocol::ModuleID::TxsSync:
+    case bcos::protocol::ModuleID::SYNC_PUSH_TRANSACTION:
+    case bcos::protocol::ModuleID::SYNC_GET_TRANSACTIONS:
+    case bcos::protocol::ModuleID::TREE_PUSH_TRANSACTION:
+    case bcos::protocol::ModuleID::LIGHTNODE_SEND_TRANSACTION:
+        return TrafficClass::TxsSync;
+    case bcos::protocol::ModuleID::AMOP:
+        return TrafficClass::AMOP;
+    default:
+        return TrafficClass::BlockSync;
+    }
+}
+
 bool bcos::gateway::P2PMessage::hasOptions() const
 {
     return (m_packetType == GatewayMessageType::PeerToPeerMessage) ||
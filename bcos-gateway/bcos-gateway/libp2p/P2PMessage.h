@@ -25,6 +25,7 @@
 #include "bcos-utilities/Common.h"
 #include "bcos-utilities/Exceptions.h"
 #include <boost/throw_exception.hpp>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,7 @@ void checkOffset(auto offset, auto length)
 
 namespace bcos::gateway
 {
+class ZstdPeerDictionaries;
 /// Options format definition
 ///   options(default version):
 ///       groupID length    :1 bytes
@@ -124,8 +126,11 @@ public:
     constexpr static size_t RSA_PUBLIC_KEY_TRUNC_LENGTH = 26;
 
     P2PMessage() = default;
-
-    // ~P2PMessage() override = default;
+    P2PMessage(const P2PMessage&) = delete;
+    P2PMessage(P2PMessage&&) = delete;
+    P2PMessage& operator=(const P2PMessage&) = delete;
+    P2PMessage& operator=(P2PMessage&&) = delete;
+    ~P2PMessage() override = default;
 
     uint32_t lengthDirect() const override;
     uint32_t length() const override;
@@ -157,6 +162,17 @@ public:
 
     // compress payload if payload need to be compressed
     bool tryToCompressPayload(bytes& compressData) const;
+    // the compressed payload, compressed at most once and shared by all the encoded messages,
+    // nullptr if the payload need not or can not be compressed
+    std::shared_ptr<const bytes> compressedPayload() const;
+    // the payload compressed with the dictionary, cached for the latest dictionary
+    std::shared_ptr<const bytes> compressedPayload(const ZstdDictionary& _dictionary) const;
+
+    // lookup the dictionaries of the peer when decoding the dictionary compressed payload
+    void setPeerDictionaries(std::shared_ptr<const ZstdPeerDictionaries> _dictionaries) override
+    {
+        m_peerDictionaries = std::move(_dictionaries);
+    }
 
     bool hasOptions() const;
 
@@ -174,6 +190,8 @@ public:
     virtual void setExtAttributes(std::any _extAttr);
     const std::any& extAttributes() const override;
 
+    TrafficClass trafficClass() const override;
+
     bool encodeHeader(bytes& _buffer) const override;
 
 protected:
@@ -191,8 +209,16 @@ protected:
     // the dst p2pNodeID, for message forward, only encode into the P2PMessageV2
     std::string m_dstP2PNodeID;
 
-    P2PMessageOptions m_options;  ///< options fields
-    bytes m_payload;              ///< payload data
+    P2PMessageOptions m_options;             ///< options fields
+    std::shared_ptr<const bytes> m_payload;  ///< payload data
+
+    // the message is encoded once for every session when broadcast, cache the compressed payload
+    mutable std::mutex x_encode;
+    mutable std::shared_ptr<const bytes> m_compressedPayload;
+    mutable bool m_compressAttempted = false;
+    mutable std::shared_ptr<const bytes> m_dictCompressedPayload;
+    mutable uint32_t m_dictCompressedID = 0;
+    std::shared_ptr<const ZstdPeerDictionaries> m_peerDictionaries;
 
     std::any m_extAttr = nullptr;  ///< message additional attributes
 };
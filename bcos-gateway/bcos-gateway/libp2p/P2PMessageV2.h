@@ -40,7 +40,7 @@ protected:
     int16_t m_ttl = 10;
 };
 
-class P2PMessageFactoryV2 : public MessageFactory
+class P2PMessageFactoryV2 : public P2PMessageFactory
 {
 public:
     using Ptr = std::shared_ptr<P2PMessageFactoryV2>;
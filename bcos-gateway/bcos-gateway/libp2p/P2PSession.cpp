@@ -10,6 +10,7 @@
 #include "bcos-gateway/libp2p/Service.h"
 #include "bcos-utilities/Common.h"
 #include <boost/algorithm/string.hpp>
+#include <algorithm>
 
 using namespace bcos;
 using namespace bcos::gateway;
@@ -50,7 +51,81 @@ void P2PSession::stop(DisconnectReason reason)
         {
             m_session->disconnect(reason);
         }
+        for (auto const& session : extraSessions())
+        {
+            if (session->active())
+            {
+                session->disconnect(reason);
+            }
+        }
+    }
+}
+
+void P2PSession::addExtraSession(SessionFace::Ptr _session)
+{
+    WriteGuard l(x_extraSessions);
+    for (size_t i = 0; i < TRAFFIC_CLASS_COUNT; ++i)
+    {
+        if (m_compressDictionaries[i])
+        {
+            _session->setCompressDictionary(
+                static_cast<TrafficClass>(i), m_compressDictionaries[i]);
+        }
+    }
+    m_extraSessions.emplace_back(std::move(_session));
+}
+
+void P2PSession::setCompressDictionary(TrafficClass _trafficClass, ZstdDictionary::Ptr _dictionary)
+{
+    WriteGuard l(x_extraSessions);
+    m_compressDictionaries[static_cast<size_t>(_trafficClass)] = _dictionary;
+    m_session->setCompressDictionary(_trafficClass, _dictionary);
+    for (auto const& session : m_extraSessions)
+    {
+        session->setCompressDictionary(_trafficClass, _dictionary);
+    }
+}
+
+bool P2PSession::removeExtraSession(const SessionFace::Ptr& _session)
+{
+    WriteGuard l(x_extraSessions);
+    auto it = std::find(m_extraSessions.begin(), m_extraSessions.end(), _session);
+    if (it == m_extraSessions.end())
+    {
+        return false;
+    }
+    m_extraSessions.erase(it);
+    return true;
+}
+
+size_t P2PSession::connectionsSize() const
+{
+    ReadGuard l(x_extraSessions);
+    return m_extraSessions.size() + 1;
+}
+
+std::vector<SessionFace::Ptr> P2PSession::extraSessions() const
+{
+    ReadGuard l(x_extraSessions);
+    return m_extraSessions;
+}
+
+SessionFace::Ptr P2PSession::selectSession(TrafficClass _trafficClass) const
+{
+    // the consensus messages and the control messages always use the main connection
+    if (_trafficClass == TrafficClass::Consensus)
+    {
+        return m_session;
     }
+    ReadGuard l(x_extraSessions);
+    if (m_extraSessions.empty())
+    {
+        return m_session;
+    }
+    // a traffic class is always mapped to the same connection to keep its messages in order
+    auto index = (static_cast<size_t>(_trafficClass) - 1) % m_extraSessions.size();
+    auto const& session = m_extraSessions[index];
+    return session->active() ? session : m_session;
 }
 
 void P2PSession::heartBeat()
@@ -70,6 +145,14 @@ void P2PSession::heartBeat()
                                       << LOG_KV("endpoint", m_session->nodeIPEndpoint());
             }
             asyncSendP2PMessage(message, Options());
+            // keep the idle extra connections alive
+            for (auto const& session : extraSessions())
+            {
+                if (session->active())
+                {
+                    session->asyncSendMessage(message, Options());
+                }
+            }
         }
 
         auto self = std::weak_ptr<P2PSession>(shared_from_this());
@@ -108,7 +191,7 @@ void P2PSession::asyncSendP2PMessage(
     // reset message using original long nodeID or short nodeID according to the protocol version
     // Note: m_protocolInfo be setted when create P2PSession
     service->resetP2pID(*message, (ProtocolVersion)m_protocolInfo->version());
-    m_session->asyncSendMessage(message, options, callback);
+    selectSession(message->trafficClass())->asyncSendMessage(message, options, callback);
 }
 
 bcos::task::Task<Message::Ptr> P2PSession::fastSendP2PMessage(
@@ -129,5 +212,6 @@ bcos::task::Task<Message::Ptr> P2PSession::fastSendP2PMessage(
     // reset message using original long nodeID or short nodeID according to the protocol version
     // Note: m_protocolInfo be setted when create P2PSession
     service->resetP2pID(message, (ProtocolVersion)m_protocolInfo->version());
-    co_return co_await m_session->fastSendMessage(message, std::move(payloads), options);
+    co_return co_await selectSession(message.trafficClass())
+        ->fastSendMessage(message, std::move(payloads), options);
 }
\ No newline at end of file
@@ -9,8 +9,12 @@
 #include "bcos-gateway/libnetwork/Common.h"
 #include "bcos-gateway/libnetwork/SessionFace.h"
 #include "bcos-gateway/libp2p/P2PMessage.h"
+#include "bcos-gateway/libp2p/ZstdDictionaryManager.h"
+#include <array>
+#include <atomic>
 #include <memory>
 #include <utility>
+#include <vector>
 
 
 namespace bcos::gateway
@@ -38,6 +42,27 @@ public:
         m_session = std::move(session);
     }
 
+    // the extra connections to the same peer, the traffic classes are spread over the connections
+    virtual void addExtraSession(SessionFace::Ptr _session);
+    // return true if _session is an extra connection of the P2PSession and has been removed
+    virtual bool removeExtraSession(const SessionFace::Ptr& _session);
+    // the number of all the connections, including the main connection
+    virtual size_t connectionsSize() const;
+    virtual std::vector<SessionFace::Ptr> extraSessions() const;
+    // the connection the message of the traffic class is written to
+    virtual SessionFace::Ptr selectSession(TrafficClass _trafficClass) const;
+    // the connections per peer advertised by the peer, 1 before the advertisement is received
+    virtual uint32_t peerConnectionsPerPeer() const { return m_peerConnectionsPerPeer; }
+    virtual void setPeerConnectionsPerPeer(uint32_t _connectionsPerPeer)
+    {
+        m_peerConnectionsPerPeer = _connectionsPerPeer;
+    }
+    // the dictionary installed by the peer, applied to all the connections
+    virtual void setCompressDictionary(TrafficClass _trafficClass, ZstdDictionary::Ptr _dictionary);
+    // the dictionaries the peer has sent, the messages received from all the connections are
+    // decompressed with them
+    virtual ZstdPeerDictionaries::Ptr peerDictionaries() const { return m_peerDictionaries; }
+
     virtual P2pID p2pID() { return m_p2pInfo->rawP2pID; }
     virtual std::string printP2pID() { return printShortP2pID(m_p2pInfo->rawP2pID); }
     // Note: the p2pInfo must be setted after session setted
@@ -72,6 +97,11 @@ public:
 
 private:
     SessionFace::Ptr m_session;
+    std::vector<SessionFace::Ptr> m_extraSessions;
+    std::array<ZstdDictionary::Ptr, TRAFFIC_CLASS_COUNT> m_compressDictionaries;
+    ZstdPeerDictionaries::Ptr m_peerDictionaries = std::make_shared<ZstdPeerDictionaries>();
+    mutable bcos::SharedMutex x_extraSessions;
+    std::atomic<uint32_t> m_peerConnectionsPerPeer = 1;
     /// gateway p2p info
     std::shared_ptr<P2PInfo> m_p2pInfo;
     std::weak_ptr<Service> m_service;
@@ -14,6 +14,7 @@
 #include "bcos-gateway/libp2p/P2PSession.h"  // for P2PSession
 #include "bcos-utilities/BoostLog.h"
 #include "bcos-utilities/Common.h"
+#include <boost/endian/conversion.hpp>
 #include <boost/random.hpp>
 #include <boost/throw_exception.hpp>
 #include <shared_mutex>
@@ -51,6 +52,25 @@ Service::Service(P2PInfo const& _p2pInfo) : m_selfInfo(_p2pInfo), m_nodeID(m_sel
             P2PMessage::Ptr message) {
             onReceiveHeartbeat(std::move(exception), std::move(session), std::move(message));
         });
+
+    registerHandlerByMsgType(GatewayMessageType::CompressDictionary,
+        [this](NetworkException exception, std::shared_ptr<P2PSession> session,
+            P2PMessage::Ptr message) {
+            onReceiveCompressDictionaries(
+                std::move(exception), std::move(session), std::move(message));
+        });
+    registerHandlerByMsgType(GatewayMessageType::CompressDictionaryAck,
+        [this](NetworkException exception, std::shared_ptr<P2PSession> session,
+            P2PMessage::Ptr message) {
+            onReceiveCompressDictionaryAck(
+                std::move(exception), std::move(session), std::move(message));
+        });
+    registerHandlerByMsgType(GatewayMessageType::ConnectionsPerPeer,
+        [this](NetworkException exception, std::shared_ptr<P2PSession> session,
+            P2PMessage::Ptr message) {
+            onReceiveConnectionsPerPeer(
+                std::move(exception), std::move(session), std::move(message));
+        });
 }
 
 void Service::start()
@@ -115,9 +135,24 @@ void Service::heartBeat()
         }
         if (!it.second.empty() && isConnected(it.second))
         {
-            SERVICE_LOG(TRACE) << LOG_DESC("heartBeat ignore connected")
+            auto p2pSession = getP2PSessionByNodeId(it.second);
+            if (!p2pSession || !isExtraConnectionDialer(it.second) ||
+                p2pSession->connectionsSize() >= connectionsLimit(*p2pSession))
+            {
+                SERVICE_LOG(TRACE) << LOG_DESC("heartBeat ignore connected")
+                                   << LOG_KV("endpoint", it.first)
+                                   << LOG_KV("nodeid", printShortP2pID(it.second));
+                continue;
+            }
+            // open one more connection to the peer until the connection pool is full
+            SERVICE_LOG(DEBUG) << LOG_DESC("heartBeat try to add connection")
                                << LOG_KV("endpoint", it.first)
-                               << LOG_KV("nodeid", printShortP2pID(it.second));
+                               << LOG_KV("connections", p2pSession->connectionsSize())
+                               << LOG_KV("connectionsLimit", connectionsLimit(*p2pSession));
+            m_host->asyncConnect(it.first,
+                [service = shared_from_this()](auto error, const P2PInfo& p2pInfo, auto session) {
+                    service->onConnect(std::move(error), p2pInfo, std::move(session));
+                });
             continue;
         }
         SERVICE_LOG(DEBUG) << LOG_DESC("heartBeat try to reconnect")
@@ -138,19 +173,47 @@ void Service::heartBeat()
         auto queueSize = session->session()->writeQueueSize();
         if (queueSize > 0)
         {
+            auto queueBytes = session->session()->writeQueueBytes();
             SERVICE_LOG(INFO) << METRIC << LOG_DESC("heartBeat")
                               << LOG_KV("endpoint", session->session()->nodeIPEndpoint())
-                              << LOG_KV("write queue size", queueSize);
+                              << LOG_KV("connections", session->connectionsSize())
+                              << LOG_KV("write queue size", queueSize)
+                              << LOG_KV("consensus bytes",
+                                     queueBytes[static_cast<size_t>(TrafficClass::Consensus)])
+                              << LOG_KV("txsSync bytes",
+                                     queueBytes[static_cast<size_t>(TrafficClass::TxsSync)])
+                              << LOG_KV("blockSync bytes",
+                                     queueBytes[static_cast<size_t>(TrafficClass::BlockSync)])
+                              << LOG_KV("amop bytes",
+                                     queueBytes[static_cast<size_t>(TrafficClass::AMOP)]);
         }
         else
         {
             SERVICE_LOG(DEBUG) << METRIC << LOG_DESC("heartBeat")
                                << LOG_KV("endpoint", session->session()->nodeIPEndpoint())
+                               << LOG_KV("connections", session->connectionsSize())
                                << LOG_KV("write queue size", queueSize);
         }
+        for (auto const& extraSession : session->extraSessions())
+        {
+            SERVICE_LOG(DEBUG) << METRIC << LOG_DESC("heartBeat extra connection")
+                               << LOG_KV("endpoint", extraSession->nodeIPEndpoint())
+                               << LOG_KV("write queue size", extraSession->writeQueueSize());
+        }
     }
     sessionLock.unlock();
 
+    if (m_dictionaryManager)
+    {
+        m_dictionaryManager->asyncTrain(
+            [self = std::weak_ptr<Service>(shared_from_this())](auto&& /*trainedClasses*/) {
+                if (auto service = self.lock())
+                {
+                    service->broadcastCompressDictionaries();
+                }
+            });
+    }
+
     auto self = std::weak_ptr<Service>(shared_from_this());
     m_timer.emplace(m_host->asioInterface()->newTimer(CHECK_INTERVAL));
     m_timer->async_wait([self](const boost::system::error_code& error) {
@@ -225,6 +288,7 @@ void Service::onConnect(
     p2pSession->setP2PInfo(p2pInfo);
     p2pSession->setService(weak_from_this());
     p2pSession->setProtocolInfo(m_localProtocol);
+    session->setPeerDictionaries(p2pSession->peerDictionaries());
 
     auto p2pSessionWeakPtr = std::weak_ptr<P2PSession>(p2pSession);
     p2pSession->session()->setMessageHandler([self = shared_from_this(), p2pSessionWeakPtr](
@@ -242,6 +306,29 @@ void Service::onConnect(
     // which will cause coredump
     std::unique_lock lock(x_sessions);
     auto existedSession = getP2PSessionByNodeIdWithoutLock(p2pID);
+    if (existedSession && acceptExtraConnection(*existedSession))
+    {
+        // the connection joins the connection pool of the peer, the messages received from it are
+        // dispatched as if they were received from the main connection
+        auto existedSessionWeakPtr = std::weak_ptr<P2PSession>(existedSession);
+        session->setMessageHandler([self = shared_from_this(), existedSessionWeakPtr](
+                                       auto&& exception, auto&& session, auto&& message) {
+            self->onMessage(std::forward<decltype(exception)>(exception),
+                std::forward<decltype(session)>(session), std::forward<decltype(message)>(message),
+                existedSessionWeakPtr);
+        });
+        session->setBeforeMessageHandler([this](SessionFace& session, Message& message) {
+            return onBeforeMessage(session, message);
+        });
+        session->setPeerDictionaries(existedSession->peerDictionaries());
+        session->start();
+        existedSession->addExtraSession(session);
+        updateStaticNodes(session->socket(), p2pID);
+        SERVICE_LOG(INFO) << LOG_DESC("Extra connection established")
+                          << LOG_KV("p2pid", printShortP2pID(p2pID)) << LOG_KV("endpoint", peer)
+                          << LOG_KV("connections", existedSession->connectionsSize());
+        return;
+    }
     if (existedSession && existedSession->active())
     {
         SERVICE_LOG(INFO) << "Disconnect duplicate peer" << LOG_KV("p2pid", printShortP2pID(p2pID))
@@ -382,6 +469,15 @@ void Service::onMessage(NetworkException e, SessionFace::Ptr session, Message::P
 
         if (e.errorCode())
         {
+            // losing an extra connection only shrinks the connection pool of the peer
+            if (session && p2pSession->removeExtraSession(session))
+            {
+                SERVICE_LOG(INFO) << LOG_DESC("extra connection disconnected")
+                                  << LOG_KV("p2pid", printShortP2pID(p2pID))
+                                  << LOG_KV("endpoint", nodeIPEndpoint)
+                                  << LOG_KV("code", e.errorCode()) << LOG_KV("message", e.what());
+                return;
+            }
             SERVICE_LOG(INFO) << LOG_DESC("disconnect failed in P2PSession")
                               << LOG_KV("p2pid", printShortP2pID(p2pID))
                               << LOG_KV("endpoint", nodeIPEndpoint) << LOG_KV("code", e.errorCode())
@@ -421,6 +517,12 @@ void Service::onMessage(NetworkException e, SessionFace::Ptr session, Message::P
                                << LOG_KV("packetType", p2pMessage->packetType());
         }
 
+        // only the module payloads share the structure the dictionaries are trained for
+        if (m_dictionaryManager && p2pMessage->hasOptions())
+        {
+            m_dictionaryManager->sample(p2pMessage->trafficClass(), p2pMessage->payload());
+        }
+
         auto packetType = p2pMessage->packetType();
         auto ext = p2pMessage->ext();
         auto version = p2pMessage->version();
@@ -516,6 +618,7 @@ void Service::asyncBroadcastMessage(P2PMessage::Ptr message, Options options)
     try
     {
         std::shared_lock lock(x_sessions);
+        // the payload is compressed once and shared by all the sessions, see P2PMessage::encode
         for (auto const& session : m_sessions)
         {
             asyncSendMessageByNodeID(session.first, message, {}, options);
@@ -684,6 +787,16 @@ void Service::onReceiveProtocol(
                           << LOG_KV("supportMinVersion", m_localProtocol->minVersion())
                           << LOG_KV("supportMaxVersion", m_localProtocol->maxVersion())
                           << LOG_KV("negotiatedVersion", version);
+        // the peers with the default never receive the advertisement, they keep one connection
+        if (m_connectionsPerPeer > 1)
+        {
+            asyncSendConnectionsPerPeer(_session);
+        }
+        // the peers with the old protocol never receive compressed payloads
+        if (m_dictionaryManager && version >= (uint32_t)bcos::protocol::ProtocolVersion::V2)
+        {
+            asyncSendCompressDictionaries(_session);
+        }
     }
     catch (std::exception const& e)
     {
@@ -694,6 +807,158 @@ void Service::onReceiveProtocol(
     }
 }
 
+void Service::asyncSendConnectionsPerPeer(P2PSession::Ptr _session)
+{
+    auto payload = bytes(sizeof(uint32_t));
+    boost::endian::store_big_u32(payload.data(), m_connectionsPerPeer);
+    auto message = std::static_pointer_cast<P2PMessage>(messageFactory()->buildMessage());
+    message->setPacketType(GatewayMessageType::ConnectionsPerPeer);
+    message->setSeq(messageFactory()->newSeq());
+    message->setPayload(std::move(payload));
+    SERVICE_LOG(INFO) << LOG_DESC("asyncSendConnectionsPerPeer")
+                      << LOG_KV("peer", _session->printP2pID())
+                      << LOG_KV("connectionsPerPeer", m_connectionsPerPeer);
+    sendMessageToSession(_session, message, Options(), nullptr);
+}
+
+// the extra connections are dialed only after the peer has advertised that it keeps them
+void Service::onReceiveConnectionsPerPeer(
+    NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message)
+{
+    if (_error.errorCode() || !_session)
+    {
+        return;
+    }
+    auto payload = _message->payload();
+    if (payload.size() < sizeof(uint32_t))
+    {
+        SERVICE_LOG(WARNING) << LOG_DESC("onReceiveConnectionsPerPeer: invalid payload")
+                             << LOG_KV("peer", _session->printP2pID())
+                             << LOG_KV("payload", payload.size());
+        return;
+    }
+    auto connectionsPerPeer = std::clamp<uint32_t>(
+        boost::endian::load_big_u32(payload.data()), 1, TRAFFIC_CLASS_COUNT);
+    _session->setPeerConnectionsPerPeer(connectionsPerPeer);
+    SERVICE_LOG(INFO) << LOG_DESC("onReceiveConnectionsPerPeer")
+                      << LOG_KV("peer", _session->printP2pID())
+                      << LOG_KV("peerConnectionsPerPeer", connectionsPerPeer)
+                      << LOG_KV("connectionsLimit", connectionsLimit(*_session));
+}
+
+void Service::asyncSendCompressDictionaries(P2PSession::Ptr _session)
+{
+    std::vector<ZstdDictionaryManager::DictionaryEntry> dictionaries;
+    auto localDictionaries = m_dictionaryManager->localDictionaries();
+    for (size_t i = 0; i < localDictionaries.size(); ++i)
+    {
+        if (localDictionaries[i])
+        {
+            dictionaries.emplace_back(
+                static_cast<TrafficClass>(i), localDictionaries[i]->content());
+        }
+    }
+    if (dictionaries.empty())
+    {
+        return;
+    }
+    auto payload = ZstdDictionaryManager::encodeDictionaries(dictionaries);
+    auto message = std::static_pointer_cast<P2PMessage>(messageFactory()->buildMessage());
+    message->setPacketType(GatewayMessageType::CompressDictionary);
+    message->setSeq(messageFactory()->newSeq());
+    message->setPayload(std::move(payload));
+    COMPRESS_DICT_LOG(INFO) << LOG_DESC("asyncSendCompressDictionaries")
+                            << LOG_KV("peer", _session->printP2pID())
+                            << LOG_KV("dictionaries", dictionaries.size());
+    sendMessageToSession(_session, message, Options(), nullptr);
+}
+
+void Service::broadcastCompressDictionaries()
+{
+    std::vector<P2PSession::Ptr> sessions;
+    {
+        std::shared_lock lock(x_sessions);
+        for (auto const& it : m_sessions)
+        {
+            auto protocolInfo = it.second->protocolInfo();
+            if (it.second->active() && protocolInfo &&
+                protocolInfo->version() >= (uint32_t)bcos::protocol::ProtocolVersion::V2)
+            {
+                sessions.emplace_back(it.second);
+            }
+        }
+    }
+    for (auto const& session : sessions)
+    {
+        asyncSendCompressDictionaries(session);
+    }
+}
+
+// install the dictionaries trained by the peer and acknowledge them
+void Service::onReceiveCompressDictionaries(
+    NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message)
+{
+    if (_error.errorCode() || !_session)
+    {
+        return;
+    }
+    if (!m_dictionaryManager)
+    {
+        // acknowledge nothing, the peer compresses without the dictionaries
+        return;
+    }
+    try
+    {
+        std::vector<ZstdDictionaryManager::DictionaryIDEntry> installed;
+        for (auto& [trafficClass, content] :
+            ZstdDictionaryManager::decodeDictionaries(_message->payload()))
+        {
+            auto dictionary = std::make_shared<const ZstdDictionary>(
+                std::move(content), m_dictionaryManager->compressionLevel());
+            installed.emplace_back(trafficClass, dictionary->id());
+            _session->peerDictionaries()->add(trafficClass, dictionary);
+        }
+        auto message = std::static_pointer_cast<P2PMessage>(messageFactory()->buildMessage());
+        message->setPacketType(GatewayMessageType::CompressDictionaryAck);
+        message->setSeq(messageFactory()->newSeq());
+        message->setPayload(ZstdDictionaryManager::encodeDictionaryIDs(installed));
+        COMPRESS_DICT_LOG(INFO) << LOG_DESC("onReceiveCompressDictionaries")
+                                << LOG_KV("peer", _session->printP2pID())
+                                << LOG_KV("dictionaries", installed.size());
+        sendMessageToSession(_session, message, Options(), nullptr);
+    }
+    catch (std::exception const& e)
+    {
+        COMPRESS_DICT_LOG(WARNING) << LOG_DESC("onReceiveCompressDictionaries exception")
+                                   << LOG_KV("peer", _session->printP2pID())
+                                   << LOG_KV("message", boost::diagnostic_information(e));
+    }
+}
+
+// the peer has installed the dictionaries, compress the messages to the peer with them
+void Service::onReceiveCompressDictionaryAck(
+    NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message)
+{
+    if (_error.errorCode() || !_session || !m_dictionaryManager)
+    {
+        return;
+    }
+    for (auto const& [trafficClass, id] :
+        ZstdDictionaryManager::decodeDictionaryIDs(_message->payload()))
+    {
+        auto dictionary = m_dictionaryManager->localDictionary(trafficClass, id);
+        if (!dictionary)
+        {
+            continue;
+        }
+        _session->setCompressDictionary(trafficClass, std::move(dictionary));
+        COMPRESS_DICT_LOG(INFO) << LOG_DESC("onReceiveCompressDictionaryAck")
+                                << LOG_KV("peer", _session->printP2pID())
+                                << LOG_KV("trafficClass", static_cast<uint32_t>(trafficClass))
+                                << LOG_KV("dictionary", id);
+    }
+}
+
 void Service::updatePeerBlacklist(const std::set<std::string>& _strList, const bool _enable)
 {
     // update the config
@@ -13,7 +13,10 @@
 #include "bcos-framework/protocol/ProtocolInfoCodec.h"
 #include "bcos-gateway/libp2p/P2PInterface.h"
 #include "bcos-gateway/libp2p/P2PSession.h"
+#include "bcos-gateway/libp2p/ZstdDictionaryManager.h"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <shared_mutex>
 
 
@@ -62,6 +65,34 @@ public:
     virtual std::map<NodeIPEndpoint, P2pID> staticNodes();
     virtual void setStaticNodes(const std::set<NodeIPEndpoint>& staticNodes);
 
+    // the number of connections kept to each peer, the traffic classes are spread over them
+    virtual void setConnectionsPerPeer(uint32_t _connectionsPerPeer)
+    {
+        m_connectionsPerPeer = _connectionsPerPeer;
+    }
+    uint32_t connectionsPerPeer() const { return m_connectionsPerPeer; }
+    // the connections kept to the peer, both gateways must allow the extra connections
+    uint32_t connectionsLimit(P2PSession const& _session) const
+    {
+        return std::min<uint32_t>(m_connectionsPerPeer, _session.peerConnectionsPerPeer());
+    }
+    // only the gateway with the smaller p2pID dials the extra connections, so the two gateways
+    // never race to add connections to each other
+    bool isExtraConnectionDialer(P2pID const& _peer) const { return m_nodeID < _peer; }
+    // an extra connection is attached to the P2PSession of the peer until the limit is reached,
+    // the others are dropped as duplicate peers
+    bool acceptExtraConnection(P2PSession& _existedSession) const
+    {
+        return _existedSession.active() &&
+               _existedSession.connectionsSize() < connectionsLimit(_existedSession);
+    }
+
+    // train and exchange the zstd dictionaries, nullptr if the dictionaries are disabled
+    virtual void setDictionaryManager(ZstdDictionaryManager::Ptr _dictionaryManager)
+    {
+        m_dictionaryManager = std::move(_dictionaryManager);
+    }
+
     P2PInfos sessionInfos() override;  ///< Only connected node
     P2PInfo localP2pInfo() override;
     bool isConnected(P2pID const& nodeID) const override;
@@ -129,6 +160,18 @@ protected:
         NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
     void onReceiveHeartbeat(
         NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
+    // connections per peer negotiation
+    void asyncSendConnectionsPerPeer(P2PSession::Ptr _session);
+    void onReceiveConnectionsPerPeer(
+        NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
+
+    // compress dictionary negotiation
+    void asyncSendCompressDictionaries(P2PSession::Ptr _session);
+    void broadcastCompressDictionaries();
+    void onReceiveCompressDictionaries(
+        NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
+    void onReceiveCompressDictionaryAck(
+        NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
 
     // handlers called when new-session
     void registerOnNewSession(std::function<void(P2PSession::Ptr)> _handler);
@@ -147,6 +190,8 @@ protected:
 
     std::map<NodeIPEndpoint, P2pID> m_staticNodes;
     std::shared_mutex x_nodes;
+    std::atomic<uint32_t> m_connectionsPerPeer = 1;
+    ZstdDictionaryManager::Ptr m_dictionaryManager;
     std::shared_ptr<Host> m_host;
 
     // long p2pID to session
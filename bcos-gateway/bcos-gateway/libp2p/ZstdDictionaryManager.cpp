@@ -0,0 +1,262 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the zstd dictionaries trained from the p2p traffic
+ * @file ZstdDictionaryManager.cpp
+ * @date 2026-10-19
+ */
+#include "bcos-gateway/libp2p/ZstdDictionaryManager.h"
+#include "bcos-gateway/libp2p/Common.h"
+#include "bcos-utilities/Exceptions.h"
+#include <boost/asio/detail/socket_ops.hpp>
+#include <cstring>
+
+using namespace bcos;
+using namespace bcos::gateway;
+
+ZstdDictionaryManager::ZstdDictionaryManager(size_t _dictionaryCapacity, int _compressionLevel)
+  : m_dictionaryCapacity(_dictionaryCapacity),
+    m_compressionLevel(_compressionLevel),
+    m_worker("dictTrain", 1)
+{}
+
+ZstdDictionaryManager::~ZstdDictionaryManager()
+{
+    m_worker.stop();
+}
+
+bool ZstdDictionaryManager::trainable(TrafficClass _trafficClass)
+{
+    // the AMOP payloads are defined by the applications and share no structure
+    return _trafficClass != TrafficClass::AMOP;
+}
+
+void ZstdDictionaryManager::sample(TrafficClass _trafficClass, bytesConstRef _payload)
+{
+    if (!trainable(_trafficClass) || _payload.empty() || _payload.size() > MAX_SAMPLE_SIZE)
+    {
+        return;
+    }
+    auto& sampler = m_samplers[static_cast<size_t>(_trafficClass)];
+    if ((sampler.counter++) % SAMPLE_INTERVAL != 0)
+    {
+        return;
+    }
+    std::lock_guard lock(x_samplers);
+    if (sampler.samples.size() >= SAMPLES_PER_DICTIONARY)
+    {
+        return;
+    }
+    sampler.samples.emplace_back(_payload.begin(), _payload.end());
+}
+
+std::vector<TrafficClass> ZstdDictionaryManager::train()
+{
+    std::vector<TrafficClass> trainedClasses;
+    for (size_t i = 0; i < TRAFFIC_CLASS_COUNT; ++i)
+    {
+        auto& sampler = m_samplers[i];
+        std::vector<bytes> samples;
+        {
+            std::lock_guard lock(x_samplers);
+            auto now = utcSteadyTime();
+            if (sampler.samples.size() < SAMPLES_PER_DICTIONARY ||
+                (sampler.lastTrainTime > 0 &&
+                    now - sampler.lastTrainTime < MIN_RETRAIN_INTERVAL))
+            {
+                continue;
+            }
+            sampler.lastTrainTime = now;
+            samples.swap(sampler.samples);
+        }
+        auto startT = utcSteadyTime();
+        bytes content;
+        if (!ZstdCompress::trainDictionary(samples, m_dictionaryCapacity, content))
+        {
+            continue;
+        }
+        try
+        {
+            auto dictionary =
+                std::make_shared<const ZstdDictionary>(std::move(content), m_compressionLevel);
+            std::lock_guard lock(x_samplers);
+            sampler.versions.emplace_back(dictionary);
+            if (sampler.versions.size() > MAX_DICTIONARY_VERSIONS)
+            {
+                sampler.versions.pop_front();
+            }
+            trainedClasses.emplace_back(static_cast<TrafficClass>(i));
+            COMPRESS_DICT_LOG(INFO) << LOG_DESC("train dictionary success")
+                                    << LOG_KV("trafficClass", i)
+                                    << LOG_KV("dictionary", dictionary->id())
+                                    << LOG_KV("size", dictionary->content().size())
+                                    << LOG_KV("samples", samples.size())
+                                    << LOG_KV("timecost", utcSteadyTime() - startT);
+        }
+        catch (std::exception const& e)
+        {
+            COMPRESS_DICT_LOG(WARNING) << LOG_DESC("build trained dictionary failed")
+                                       << LOG_KV("trafficClass", i)
+                                       << LOG_KV("message", boost::diagnostic_information(e));
+        }
+    }
+    return trainedClasses;
+}
+
+void ZstdDictionaryManager::asyncTrain(std::function<void(std::vector<TrafficClass>)> _onTrained)
+{
+    if (m_training.exchange(true))
+    {
+        return;
+    }
+    // the training takes tens of milliseconds, never block the network threads
+    m_worker.enqueue([this, onTrained = std::move(_onTrained)]() {
+        auto trainedClasses = train();
+        m_training = false;
+        if (!trainedClasses.empty() && onTrained)
+        {
+            onTrained(std::move(trainedClasses));
+        }
+    });
+}
+
+std::array<ZstdDictionary::Ptr, TRAFFIC_CLASS_COUNT> ZstdDictionaryManager::localDictionaries()
+    const
+{
+    std::array<ZstdDictionary::Ptr, TRAFFIC_CLASS_COUNT> dictionaries;
+    std::lock_guard lock(x_samplers);
+    for (size_t i = 0; i < TRAFFIC_CLASS_COUNT; ++i)
+    {
+        if (!m_samplers[i].versions.empty())
+        {
+            dictionaries[i] = m_samplers[i].versions.back();
+        }
+    }
+    return dictionaries;
+}
+
+ZstdDictionary::Ptr ZstdDictionaryManager::localDictionary(
+    TrafficClass _trafficClass, uint32_t _id) const
+{
+    std::lock_guard lock(x_samplers);
+    for (auto const& dictionary : m_samplers[static_cast<size_t>(_trafficClass)].versions)
+    {
+        if (dictionary->id() == _id)
+        {
+            return dictionary;
+        }
+    }
+    return nullptr;
+}
+
+void ZstdPeerDictionaries::add(TrafficClass _trafficClass, ZstdDictionary::Ptr _dictionary)
+{
+    WriteGuard lock(x_versions);
+    auto& versions = m_versions[static_cast<size_t>(_trafficClass)];
+    for (auto const& dictionary : versions)
+    {
+        if (dictionary->id() == _dictionary->id())
+        {
+            return;
+        }
+    }
+    versions.emplace_back(std::move(_dictionary));
+    if (versions.size() > ZstdDictionaryManager::MAX_DICTIONARY_VERSIONS)
+    {
+        versions.pop_front();
+    }
+}
+
+ZstdDictionary::Ptr ZstdPeerDictionaries::find(TrafficClass _trafficClass, uint32_t _id) const
+{
+    ReadGuard lock(x_versions);
+    for (auto const& dictionary : m_versions[static_cast<size_t>(_trafficClass)])
+    {
+        if (dictionary->id() == _id)
+        {
+            return dictionary;
+        }
+    }
+    return nullptr;
+}
+
+bytes ZstdDictionaryManager::encodeDictionaries(std::vector<DictionaryEntry> const& _dictionaries)
+{
+    bytes payload;
+    for (auto const& [trafficClass, content] : _dictionaries)
+    {
+        payload.emplace_back(static_cast<uint8_t>(trafficClass));
+        uint32_t length = boost::asio::detail::socket_ops::host_to_network_long(content.size());
+        payload.insert(payload.end(), (byte*)&length, (byte*)&length + sizeof(length));
+        payload.insert(payload.end(), content.begin(), content.end());
+    }
+    return payload;
+}
+
+std::vector<ZstdDictionaryManager::DictionaryEntry> ZstdDictionaryManager::decodeDictionaries(
+    bytesConstRef _payload)
+{
+    std::vector<DictionaryEntry> dictionaries;
+    size_t offset = 0;
+    while (offset + 1 + sizeof(uint32_t) <= _payload.size())
+    {
+        auto trafficClass = _payload[offset];
+        uint32_t length = 0;
+        std::memcpy(&length, _payload.data() + offset + 1, sizeof(length));
+        length = boost::asio::detail::socket_ops::network_to_host_long(length);
+        offset += 1 + sizeof(uint32_t);
+        if (trafficClass >= TRAFFIC_CLASS_COUNT || offset + length > _payload.size())
+        {
+            BOOST_THROW_EXCEPTION(InvalidParameter() << errinfo_comment(
+                                      "decodeDictionaries: invalid dictionary payload"));
+        }
+        dictionaries.emplace_back(static_cast<TrafficClass>(trafficClass),
+            bytes(_payload.begin() + offset, _payload.begin() + offset + length));
+        offset += length;
+    }
+    return dictionaries;
+}
+
+bytes ZstdDictionaryManager::encodeDictionaryIDs(std::vector<DictionaryIDEntry> const& _ids)
+{
+    bytes payload;
+    for (auto const& [trafficClass, id] : _ids)
+    {
+        payload.emplace_back(static_cast<uint8_t>(trafficClass));
+        uint32_t networkID = boost::asio::detail::socket_ops::host_to_network_long(id);
+        payload.insert(payload.end(), (byte*)&networkID, (byte*)&networkID + sizeof(networkID));
+    }
+    return payload;
+}
+
+std::vector<ZstdDictionaryManager::DictionaryIDEntry> ZstdDictionaryManager::decodeDictionaryIDs(
+    bytesConstRef _payload)
+{
+    std::vector<DictionaryIDEntry> ids;
+    for (size_t offset = 0; offset + 1 + sizeof(uint32_t) <= _payload.size();
+         offset += 1 + sizeof(uint32_t))
+    {
+        auto trafficClass = _payload[offset];
+        if (trafficClass >= TRAFFIC_CLASS_COUNT)
+        {
+            continue;
+        }
+        uint32_t id = 0;
+        std::memcpy(&id, _payload.data() + offset + 1, sizeof(id));
+        ids.emplace_back(static_cast<TrafficClass>(trafficClass),
+            boost::asio::detail::socket_ops::network_to_host_long(id));
+    }
+    return ids;
+}
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the zstd dictionaries trained from the p2p traffic
+ * @file ZstdDictionaryManager.h
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include "bcos-gateway/libnetwork/Message.h"
+#include "bcos-utilities/Common.h"
+#include "bcos-utilities/ThreadPool.h"
+#include "bcos-utilities/ZstdCompress.h"
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace bcos::gateway
+{
+/**
+ * The small tars-encoded messages (transactions, PBFT packets) are too small for zstd to find
+ * repetitions inside a single payload. The manager samples the received payloads of every traffic
+ * class, trains a zstd dictionary per class and keeps the dictionaries received from the peers:
+ *
+ * - after the protocol handshake and whenever a new dictionary version is trained, the local
+ *   dictionaries are sent to the peer, the peer acknowledges the dictionary IDs it has installed
+ * - a dictionary is only used to compress the messages to the peers that acknowledged it
+ * - the receiver looks up the dictionary among the ones installed from the peer of the connection,
+ *   by the traffic class of the message and the dictionary ID written in the zstd frame
+ */
+class ZstdDictionaryManager
+{
+public:
+    using Ptr = std::shared_ptr<ZstdDictionaryManager>;
+    using DictionaryEntry = std::pair<TrafficClass, bytes>;
+    using DictionaryIDEntry = std::pair<TrafficClass, uint32_t>;
+
+    // the sampling parameters, the defaults fit the dictionaries of 16KB-64KB
+    constexpr static size_t SAMPLES_PER_DICTIONARY = 2048;
+    constexpr static size_t SAMPLE_INTERVAL = 8;
+    constexpr static size_t MAX_SAMPLE_SIZE = 4096;
+    // the dictionary versions of each traffic class kept for the in-flight messages
+    constexpr static size_t MAX_DICTIONARY_VERSIONS = 2;
+    // retrain the dictionary of a traffic class at most once every 30 minutes
+    constexpr static uint64_t MIN_RETRAIN_INTERVAL = 30 * 60 * 1000;
+
+    ZstdDictionaryManager(size_t _dictionaryCapacity, int _compressionLevel);
+    virtual ~ZstdDictionaryManager();
+    ZstdDictionaryManager(const ZstdDictionaryManager&) = delete;
+    ZstdDictionaryManager(ZstdDictionaryManager&&) = delete;
+    ZstdDictionaryManager& operator=(const ZstdDictionaryManager&) = delete;
+    ZstdDictionaryManager& operator=(ZstdDictionaryManager&&) = delete;
+
+    // sample the payload of a received message of the traffic class
+    virtual void sample(TrafficClass _trafficClass, bytesConstRef _payload);
+    // train the traffic classes with enough samples, return the classes with a new dictionary
+    virtual std::vector<TrafficClass> train();
+    // train in the background, _onTrained is called if any new dictionary is trained
+    virtual void asyncTrain(std::function<void(std::vector<TrafficClass>)> _onTrained);
+
+    // the latest local dictionary of every traffic class, nullptr if not trained yet
+    virtual std::array<ZstdDictionary::Ptr, TRAFFIC_CLASS_COUNT> localDictionaries() const;
+    // the local dictionary of the traffic class with the ID, nullptr if it has been retired
+    virtual ZstdDictionary::Ptr localDictionary(TrafficClass _trafficClass, uint32_t _id) const;
+
+    int compressionLevel() const { return m_compressionLevel; }
+    size_t dictionaryCapacity() const { return m_dictionaryCapacity; }
+
+    // the payload of the ZstdDictionary message: [trafficClass(1B)][length(4B)][content]...
+    static bytes encodeDictionaries(std::vector<DictionaryEntry> const& _dictionaries);
+    static std::vector<DictionaryEntry> decodeDictionaries(bytesConstRef _payload);
+    // the payload of the ZstdDictionaryAck message: [trafficClass(1B)][dictionaryID(4B)]...
+    static bytes encodeDictionaryIDs(std::vector<DictionaryIDEntry> const& _ids);
+    static std::vector<DictionaryIDEntry> decodeDictionaryIDs(bytesConstRef _payload);
+
+private:
+    struct Sampler
+    {
+        std::atomic<uint64_t> counter = 0;
+        std::vector<bytes> samples;
+        uint64_t lastTrainTime = 0;
+        // the latest version is at the back
+        std::deque<ZstdDictionary::Ptr> versions;
+    };
+    static bool trainable(TrafficClass _trafficClass);
+
+    size_t m_dictionaryCapacity;
+    int m_compressionLevel;
+
+    std::array<Sampler, TRAFFIC_CLASS_COUNT> m_samplers;
+    mutable std::mutex x_samplers;
+
+    std::atomic_bool m_training = false;
+    bcos::ThreadPool m_worker;
+};
+
+/**
+ * The dictionaries installed from one peer, owned by the P2PSession of the peer and shared by its
+ * connections. The dictionary ID is chosen by the sender, so the dictionaries of the peers are
+ * never mixed: a peer announcing the ID of another peer's dictionary only shadows its own.
+ */
+class ZstdPeerDictionaries
+{
+public:
+    using Ptr = std::shared_ptr<ZstdPeerDictionaries>;
+    using ConstPtr = std::shared_ptr<const ZstdPeerDictionaries>;
+
+    // install the dictionary of the traffic class, the oldest version is retired
+    void add(TrafficClass _trafficClass, ZstdDictionary::Ptr _dictionary);
+    // the dictionary to decompress the frame of the traffic class, nullptr if not installed
+    ZstdDictionary::Ptr find(TrafficClass _trafficClass, uint32_t _id) const;
+
+private:
+    std::array<std::deque<ZstdDictionary::Ptr>, TRAFFIC_CLASS_COUNT> m_versions;
+    mutable bcos::SharedMutex x_versions;
+};
+}  // namespace bcos::gateway
@@ -25,6 +25,7 @@
 #include "bcos-gateway/libp2p/P2PMessage.h"
 #include "bcos-gateway/libp2p/P2PMessageV2.h"
 #include "bcos-gateway/libp2p/Service.h"
+#include "bcos-gateway/libp2p/ZstdDictionaryManager.h"
 #include "bcos-utilities/testutils/TestPromptFixture.h"
 #include <boost/test/unit_test.hpp>
 
@@ -471,6 +472,176 @@ BOOST_AUTO_TEST_CASE(test_P2PMessage_compress)
     */
 }
 
+BOOST_AUTO_TEST_CASE(test_P2PMessage_encodeOnce)
+{
+    auto factory = std::make_shared<P2PMessageFactoryV2>();
+    auto msg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    msg->setVersion(2);
+    msg->setSeq(0x1234);
+    msg->setPacketType(0x4321);
+    msg->setPayload(bytes(10000, 'a'));
+
+    // the payload is compressed by the first session and shared by the others
+    EncodedMessage first;
+    BOOST_CHECK(msg->encode(first));
+    EncodedMessage second;
+    BOOST_CHECK(msg->encode(second));
+    BOOST_CHECK(first.payload == second.payload);
+    BOOST_CHECK_LT(first.payloadSize(), 10000U);
+
+    // the session without compression gets the raw payload and the flag is cleared
+    EncodedMessage raw;
+    raw.compress = false;
+    BOOST_CHECK(msg->encode(raw));
+    BOOST_CHECK_EQUAL(raw.payloadSize(), 10000U);
+    BOOST_CHECK(raw.payload->data() == msg->payload().data());
+
+    for (auto* encoded : {&first, &raw})
+    {
+        bytes buffer = encoded->header;
+        buffer.insert(buffer.end(), encoded->payload->begin(), encoded->payload->end());
+        auto decodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+        BOOST_CHECK_EQUAL(decodeMsg->decode(bytesConstRef(buffer.data(), buffer.size())),
+            (int32_t)buffer.size());
+        BOOST_CHECK(decodeMsg->payload().toBytes() == msg->payload().toBytes());
+    }
+}
+
+std::vector<bytes> dictionarySamples(char _input)
+{
+    std::vector<bytes> samples;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        auto sample = "{\"groupID\":\"group0\",\"chainID\":\"chain0\",\"nonce\":\"" +
+                      std::to_string(i * 7919) + "\",\"blockLimit\":" + std::to_string(i) +
+                      ",\"to\":\"0x0000000000000000000000000000000000001000\",\"input\":\"" +
+                      std::string(64, _input) + "\"}";
+        samples.emplace_back(sample.begin(), sample.end());
+    }
+    return samples;
+}
+
+BOOST_AUTO_TEST_CASE(test_P2PMessage_compressDictionary)
+{
+    auto samples = dictionarySamples('e');
+    bytes content;
+    BOOST_REQUIRE(ZstdCompress::trainDictionary(samples, 4096, content));
+
+    // the sender has trained the dictionary, the receiver installed it after the handshake
+    auto dictionary = std::make_shared<const ZstdDictionary>(content, 1);
+    auto senderDictionaries = std::make_shared<ZstdPeerDictionaries>();
+    senderDictionaries->add(TrafficClass::Consensus, dictionary);
+    auto payload = ZstdDictionaryManager::encodeDictionaries({{TrafficClass::TxsSync, content}});
+    auto decodedDictionaries = ZstdDictionaryManager::decodeDictionaries(ref(payload));
+    BOOST_REQUIRE_EQUAL(decodedDictionaries.size(), 1U);
+    BOOST_CHECK(decodedDictionaries[0].first == TrafficClass::TxsSync);
+    BOOST_CHECK(decodedDictionaries[0].second == content);
+    auto ack = ZstdDictionaryManager::encodeDictionaryIDs({{TrafficClass::TxsSync, 0x1234}});
+    auto ids = ZstdDictionaryManager::decodeDictionaryIDs(ref(ack));
+    BOOST_REQUIRE_EQUAL(ids.size(), 1U);
+    BOOST_CHECK_EQUAL(ids[0].second, 0x1234U);
+
+    auto factory = std::make_shared<P2PMessageFactoryV2>();
+    auto msg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    msg->setVersion(2);
+    msg->setSeq(0x1234);
+    msg->setPacketType(0x4321);
+    // below the plain compress threshold
+    msg->setPayload(samples[123]);
+
+    EncodedMessage plain;
+    BOOST_CHECK(msg->encode(plain));
+    BOOST_CHECK_EQUAL(plain.payloadSize(), samples[123].size());
+    EncodedMessage compressed;
+    compressed.dictionary = dictionary;
+    BOOST_CHECK(msg->encode(compressed));
+    BOOST_CHECK_LT(compressed.payloadSize(), samples[123].size());
+
+    bytes buffer = compressed.header;
+    buffer.insert(buffer.end(), compressed.payload->begin(), compressed.payload->end());
+    auto unknownDictionaryMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    BOOST_CHECK_EQUAL(unknownDictionaryMsg->decode(bytesConstRef(buffer.data(), buffer.size())),
+        MessageDecodeStatus::MESSAGE_ERROR);
+
+    auto decodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    decodeMsg->setPeerDictionaries(senderDictionaries);
+    BOOST_CHECK_EQUAL(
+        decodeMsg->decode(bytesConstRef(buffer.data(), buffer.size())), (int32_t)buffer.size());
+    BOOST_CHECK(decodeMsg->payload().toBytes() == samples[123]);
+
+    // the dictionary is installed for the traffic class of the message only
+    auto otherClassDictionaries = std::make_shared<ZstdPeerDictionaries>();
+    otherClassDictionaries->add(TrafficClass::TxsSync, dictionary);
+    auto otherClassMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    otherClassMsg->setPeerDictionaries(otherClassDictionaries);
+    BOOST_CHECK_EQUAL(otherClassMsg->decode(bytesConstRef(buffer.data(), buffer.size())),
+        MessageDecodeStatus::MESSAGE_ERROR);
+}
+
+BOOST_AUTO_TEST_CASE(test_P2PMessage_compressDictionarySameID)
+{
+    auto samples = dictionarySamples('e');
+    bytes content;
+    BOOST_REQUIRE(ZstdCompress::trainDictionary(samples, 4096, content));
+    bytes otherContent;
+    BOOST_REQUIRE(ZstdCompress::trainDictionary(dictionarySamples('f'), 4096, otherContent));
+    // another peer announces a different dictionary with the same ID: [magic(4B)][ID(4B)]...
+    std::copy(content.begin() + 4, content.begin() + 8, otherContent.begin() + 4);
+
+    auto dictionary = std::make_shared<const ZstdDictionary>(content, 1);
+    auto otherDictionary = std::make_shared<const ZstdDictionary>(otherContent, 1);
+    BOOST_REQUIRE_EQUAL(dictionary->id(), otherDictionary->id());
+    auto honestDictionaries = std::make_shared<ZstdPeerDictionaries>();
+    auto otherDictionaries = std::make_shared<ZstdPeerDictionaries>();
+    honestDictionaries->add(TrafficClass::Consensus, dictionary);
+    otherDictionaries->add(TrafficClass::Consensus, otherDictionary);
+    BOOST_CHECK(honestDictionaries->find(TrafficClass::Consensus, dictionary->id()) == dictionary);
+    BOOST_CHECK(
+        otherDictionaries->find(TrafficClass::Consensus, dictionary->id()) == otherDictionary);
+    BOOST_CHECK(!honestDictionaries->find(TrafficClass::TxsSync, dictionary->id()));
+
+    // the messages of the honest peer are still decompressed with its own dictionary
+    auto factory = std::make_shared<P2PMessageFactoryV2>();
+    auto msg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    msg->setVersion(2);
+    msg->setSeq(0x1234);
+    msg->setPacketType(0x4321);
+    msg->setPayload(samples[321]);
+    EncodedMessage compressed;
+    compressed.dictionary = dictionary;
+    BOOST_CHECK(msg->encode(compressed));
+    bytes buffer = compressed.header;
+    buffer.insert(buffer.end(), compressed.payload->begin(), compressed.payload->end());
+
+    auto decodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    decodeMsg->setPeerDictionaries(honestDictionaries);
+    BOOST_CHECK_EQUAL(
+        decodeMsg->decode(bytesConstRef(buffer.data(), buffer.size())), (int32_t)buffer.size());
+    BOOST_CHECK(decodeMsg->payload().toBytes() == samples[321]);
+}
+
+BOOST_AUTO_TEST_CASE(test_P2PMessage_trafficClass)
+{
+    auto factory = std::make_shared<P2PMessageFactoryV2>();
+    auto msg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    msg->setPacketType(GatewayMessageType::Heartbeat);
+    BOOST_CHECK(msg->trafficClass() == TrafficClass::Consensus);
+    msg->setPacketType(GatewayMessageType::AMOPMessageType);
+    BOOST_CHECK(msg->trafficClass() == TrafficClass::AMOP);
+
+    msg->setPacketType(GatewayMessageType::PeerToPeerMessage);
+    P2PMessageOptions options;
+    options.setModuleID(bcos::protocol::ModuleID::PBFT);
+    msg->setOptions(options);
+    BOOST_CHECK(msg->trafficClass() == TrafficClass::Consensus);
+    options.setModuleID(bcos::protocol::ModuleID::TxsSync);
+    msg->setOptions(options);
+    BOOST_CHECK(msg->trafficClass() == TrafficClass::TxsSync);
+    options.setModuleID(bcos::protocol::ModuleID::BlockSync);
+    msg->setOptions(options);
+    BOOST_CHECK(msg->trafficClass() == TrafficClass::BlockSync);
+}
+
 BOOST_AUTO_TEST_CASE(test_P2PMessage_attr)
 {
     auto attr = std::make_shared<GatewayMessageExtAttributes>();
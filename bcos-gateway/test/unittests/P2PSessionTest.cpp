@@ -0,0 +1,159 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the connection pool of the P2PSession
+ * @file P2PSessionTest.cpp
+ * @date 2026-10-19
+ */
+#include "bcos-gateway/libnetwork/SessionFace.h"
+#include "bcos-gateway/libp2p/P2PSession.h"
+#include "bcos-gateway/libp2p/Service.h"
+#include "bcos-utilities/testutils/TestPromptFixture.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::gateway;
+using namespace bcos::test;
+
+namespace
+{
+class FakeSession : public SessionFace
+{
+public:
+    void start() override { m_active = true; }
+    void disconnect(DisconnectReason) override { m_active = false; }
+    void asyncSendMessage(Message::Ptr, Options, SessionCallbackFunc) override { ++m_sent; }
+    task::Task<Message::Ptr> fastSendMessage(
+        const Message&, ::ranges::any_view<bytesConstRef>, Options) override
+    {
+        ++m_sent;
+        co_return nullptr;
+    }
+    std::shared_ptr<SocketFace> socket() override { return nullptr; }
+    void setMessageHandler(
+        std::function<void(NetworkException, SessionFace::Ptr, Message::Ptr)>) override
+    {}
+    void setBeforeMessageHandler(
+        std::function<std::optional<bcos::Error>(SessionFace&, Message&)>) override
+    {}
+    NodeIPEndpoint nodeIPEndpoint() const override { return {"127.0.0.1", 30300}; }
+    bool active() const override { return m_active; }
+    std::size_t writeQueueSize() override { return 0; }
+    std::array<std::size_t, TRAFFIC_CLASS_COUNT> writeQueueBytes() override { return {}; }
+
+    bool m_active = true;
+    size_t m_sent = 0;
+};
+
+P2PSession::Ptr createP2PSession(std::string const& _p2pID)
+{
+    auto p2pSession = std::make_shared<P2PSession>();
+    p2pSession->setSession(std::make_shared<FakeSession>());
+    p2pSession->setP2PInfo(P2PInfo(_p2pID, _p2pID));
+    return p2pSession;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(P2PSessionTest, TestPromptFixture)
+
+BOOST_AUTO_TEST_CASE(attachExtraSessions)
+{
+    auto p2pSession = createP2PSession("b");
+    auto mainSession = p2pSession->session();
+    BOOST_CHECK_EQUAL(p2pSession->connectionsSize(), 1U);
+    BOOST_CHECK(p2pSession->selectSession(TrafficClass::BlockSync) == mainSession);
+
+    auto extraSession1 = std::make_shared<FakeSession>();
+    auto extraSession2 = std::make_shared<FakeSession>();
+    p2pSession->addExtraSession(extraSession1);
+    p2pSession->addExtraSession(extraSession2);
+    BOOST_CHECK_EQUAL(p2pSession->connectionsSize(), 3U);
+
+    // consensus keeps the main connection, each other class is pinned to one extra connection
+    BOOST_CHECK(p2pSession->selectSession(TrafficClass::Consensus) == mainSession);
+    BOOST_CHECK(p2pSession->selectSession(TrafficClass::TxsSync) == extraSession1);
+    BOOST_CHECK(p2pSession->selectSession(TrafficClass::BlockSync) == extraSession2);
+    BOOST_CHECK(p2pSession->selectSession(TrafficClass::AMOP) == extraSession1);
+
+    // an inactive extra connection falls back to the main connection
+    extraSession2->disconnect(DisconnectReason::TCPError);
+    BOOST_CHECK(p2pSession->selectSession(TrafficClass::BlockSync) == mainSession);
+
+    // losing an extra connection only shrinks the pool
+    BOOST_CHECK(p2pSession->removeExtraSession(extraSession2));
+    BOOST_CHECK(!p2pSession->removeExtraSession(extraSession2));
+    BOOST_CHECK(!p2pSession->removeExtraSession(mainSession));
+    BOOST_CHECK_EQUAL(p2pSession->connectionsSize(), 2U);
+    BOOST_CHECK(p2pSession->selectSession(TrafficClass::BlockSync) == extraSession1);
+
+    // stopping the P2PSession disconnects all the connections
+    p2pSession->start();
+    p2pSession->stop(DisconnectReason::ClientQuit);
+    BOOST_CHECK(!mainSession->active());
+    BOOST_CHECK(!extraSession1->active());
+}
+
+BOOST_AUTO_TEST_CASE(connectionsLimit)
+{
+    auto service = std::make_shared<Service>(P2PInfo("b", "b"));
+    service->setConnectionsPerPeer(3);
+    auto p2pSession = createP2PSession("c");
+    p2pSession->start();
+
+    // the peer has not advertised its connections per peer, keep one connection
+    BOOST_CHECK_EQUAL(service->connectionsLimit(*p2pSession), 1U);
+    BOOST_CHECK(!service->acceptExtraConnection(*p2pSession));
+
+    // the smaller value of the two gateways is used
+    p2pSession->setPeerConnectionsPerPeer(2);
+    BOOST_CHECK_EQUAL(service->connectionsLimit(*p2pSession), 2U);
+    BOOST_CHECK(service->acceptExtraConnection(*p2pSession));
+    p2pSession->addExtraSession(std::make_shared<FakeSession>());
+    BOOST_CHECK(!service->acceptExtraConnection(*p2pSession));
+
+    p2pSession->setPeerConnectionsPerPeer(4);
+    BOOST_CHECK_EQUAL(service->connectionsLimit(*p2pSession), 3U);
+    BOOST_CHECK(service->acceptExtraConnection(*p2pSession));
+    p2pSession->addExtraSession(std::make_shared<FakeSession>());
+    BOOST_CHECK(!service->acceptExtraConnection(*p2pSession));
+
+    // a gateway with the default never keeps the extra connections
+    service->setConnectionsPerPeer(1);
+    BOOST_CHECK_EQUAL(service->connectionsLimit(*p2pSession), 1U);
+    BOOST_CHECK(!service->acceptExtraConnection(*p2pSession));
+}
+
+BOOST_AUTO_TEST_CASE(duplicatePeer)
+{
+    auto service = std::make_shared<Service>(P2PInfo("b", "b"));
+    service->setConnectionsPerPeer(2);
+
+    // only the gateway with the smaller p2pID dials the extra connections
+    BOOST_CHECK(service->isExtraConnectionDialer("c"));
+    BOOST_CHECK(!service->isExtraConnectionDialer("a"));
+    auto peerService = std::make_shared<Service>(P2PInfo("c", "c"));
+    BOOST_CHECK(!peerService->isExtraConnectionDialer("b"));
+
+    // the connections to an inactive session are not attached, they replace the session
+    auto p2pSession = createP2PSession("c");
+    p2pSession->setPeerConnectionsPerPeer(2);
+    BOOST_CHECK(!service->acceptExtraConnection(*p2pSession));
+    p2pSession->start();
+    BOOST_CHECK(service->acceptExtraConnection(*p2pSession));
+    p2pSession->stop(DisconnectReason::DuplicatePeer);
+    BOOST_CHECK(!service->acceptExtraConnection(*p2pSession));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -141,7 +141,7 @@ public:
             }
         }
 
-        m_payload.assign(_buffer.begin(), _buffer.begin() + length);
+        m_payload = std::make_shared<const bytes>(_buffer.begin(), _buffer.begin() + length);
         return length;
     }
 };
@@ -361,6 +361,69 @@ BOOST_AUTO_TEST_CASE(doReadTest)
     fakeSocket->close();
 }
 
+BOOST_AUTO_TEST_CASE(trafficClassTest)
+{
+    auto fakeHost = std::make_shared<FakeHost>(std::make_shared<Keccak256>(),
+        std::make_shared<FakeASIO>(), nullptr, std::make_shared<FakeMessageFactory>());
+    auto fakeSocket = std::make_shared<FakeSocket>();
+    auto session = std::make_shared<Session>(fakeSocket, *fakeHost);
+
+    bytes data(100 * 1024);
+    auto push = [&](TrafficClass trafficClass, size_t size) {
+        auto index = static_cast<size_t>(trafficClass);
+        session->m_writeQueueMsgs[index] += 1;
+        session->m_writeQueueBytes[index] += size;
+        session->m_writeQueues[index].push(
+            {.m_data{Payload::MessageList{bytesConstRef(data.data(), size)}}, .m_callback = {}});
+    };
+    for (size_t i = 0; i < 8; ++i)
+    {
+        push(TrafficClass::BlockSync, data.size());
+    }
+    push(TrafficClass::TxsSync, 1024);
+    push(TrafficClass::Consensus, 512);
+    BOOST_CHECK_EQUAL(session->writeQueueSize(), 10U);
+    BOOST_CHECK_EQUAL(
+        session->writeQueueBytes()[static_cast<size_t>(TrafficClass::BlockSync)], 800 * 1024U);
+
+    // the consensus message is written first and the txs are not queued behind the block data
+    std::vector<Payload> payloads;
+    BOOST_CHECK(session->tryPopSomeEncodedMsgs(payloads, 1024 * 1024, 10));
+    BOOST_REQUIRE_EQUAL(payloads.size(), 10U);
+    BOOST_CHECK_EQUAL(payloads[0].size(), 512U);
+    BOOST_CHECK_EQUAL(payloads[1].size(), 1024U);
+    BOOST_CHECK_EQUAL(session->writeQueueSize(), 0U);
+
+    // the bulk data is written in batches of the max send data size
+    for (size_t i = 0; i < 8; ++i)
+    {
+        push(TrafficClass::BlockSync, data.size());
+    }
+    payloads.clear();
+    BOOST_CHECK(session->tryPopSomeEncodedMsgs(payloads, 250 * 1024, 10));
+    BOOST_CHECK_EQUAL(payloads.size(), 3U);
+    BOOST_CHECK_EQUAL(session->writeQueueSize(), 5U);
+    payloads.clear();
+    BOOST_CHECK(session->tryPopSomeEncodedMsgs(payloads, 1024 * 1024, 10));
+    BOOST_CHECK_EQUAL(session->writeQueueSize(), 0U);
+
+    // a large proposal is written at most one consensus budget ahead of the txs
+    session->setTrafficClassBudget(TrafficClass::Consensus, 200 * 1024);
+    BOOST_CHECK_EQUAL(session->trafficClassBudget(TrafficClass::Consensus), 200 * 1024U);
+    for (size_t i = 0; i < 8; ++i)
+    {
+        push(TrafficClass::Consensus, data.size());
+    }
+    push(TrafficClass::TxsSync, 1024);
+    payloads.clear();
+    BOOST_CHECK(session->tryPopSomeEncodedMsgs(payloads, 1024 * 1024, 10));
+    BOOST_REQUIRE_GE(payloads.size(), 3U);
+    BOOST_CHECK_EQUAL(payloads[0].size(), 100 * 1024U);
+    BOOST_CHECK_EQUAL(payloads[1].size(), 100 * 1024U);
+    BOOST_CHECK_EQUAL(payloads[2].size(), 1024U);
+    session->setSocket(nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(SessionRecvBufferTest)
 {
     {
@@ -0,0 +1,791 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the append-only segment file store of the historical transactions and receipts
+ * @file ColdBlockStore.cpp
+ * @date 2026-10-19
+ */
+#include "ColdBlockStore.h"
+#include <bcos-framework/ledger/LedgerTypeDef.h>
+#include <bcos-utilities/BoostLog.h>
+#include <bcos-utilities/Error.h>
+#include <bcos-utilities/ZstdCompress.h>
+#include <unistd.h>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/throw_exception.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#define COLD_STORE_LOG(LEVEL) BCOS_LOG(LEVEL) << LOG_BADGE("LEDGER") << LOG_BADGE("ColdBlockStore")
+
+using namespace bcos;
+using namespace bcos::ledger;
+
+namespace
+{
+constexpr std::string_view INDEX_MAGIC = "CIDX";
+constexpr uint8_t INDEX_VERSION = 1;
+// [number(8B)][rawSize(4B)][compressedSize(4B)]
+constexpr size_t RECORD_HEADER_SIZE = 16;
+constexpr size_t INDEX_ENTRY_SIZE = ColdBlockStore::HASH_SIZE + sizeof(uint64_t);
+constexpr size_t BLOOM_PROBES = 4;
+constexpr std::string_view PRUNED_FILE = "PRUNED";
+
+template <class T>
+void putFixed(std::string& _out, T _value)
+{
+    _out.append(reinterpret_cast<const char*>(&_value), sizeof(T));
+}
+
+template <class T>
+T getFixed(std::string_view _in, size_t _offset)
+{
+    T value;
+    std::memcpy(&value, _in.data() + _offset, sizeof(T));
+    return value;
+}
+
+[[noreturn]] void throwCorrupted(std::string const& _path, std::string_view _reason)
+{
+    BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::GetStorageError,
+        "Corrupted cold block store file " + _path + ": " + std::string(_reason)));
+}
+
+std::string readAt(std::string const& _path, uint64_t _offset, size_t _size)
+{
+    std::ifstream file(_path, std::ios::binary);
+    std::string buffer(_size, '\0');
+    if (!file.seekg(static_cast<std::streamoff>(_offset)) ||
+        !file.read(buffer.data(), static_cast<std::streamsize>(_size)))
+    {
+        throwCorrupted(_path, "short read at " + std::to_string(_offset));
+    }
+    return buffer;
+}
+
+void syncFile(std::FILE* _file, std::string const& _path)
+{
+    if (std::fflush(_file) != 0 || ::fsync(::fileno(_file)) != 0)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(
+            LedgerError::ErrorCommitBlock, "Sync cold block store file failed: " + _path));
+    }
+}
+
+// write to a temporary file then rename, the file is either the old or the new content
+void writeFileAtomic(std::string const& _path, std::string_view _content)
+{
+    auto tmpPath = _path + ".tmp";
+    std::FILE* file = std::fopen(tmpPath.c_str(), "wb");
+    if (file == nullptr)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(
+            LedgerError::ErrorCommitBlock, "Open cold block store file failed: " + tmpPath));
+    }
+    auto written = std::fwrite(_content.data(), 1, _content.size(), file);
+    try
+    {
+        if (written != _content.size())
+        {
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(
+                LedgerError::ErrorCommitBlock, "Write cold block store file failed: " + tmpPath));
+        }
+        syncFile(file, tmpPath);
+    }
+    catch (...)
+    {
+        std::fclose(file);
+        throw;
+    }
+    std::fclose(file);
+    boost::filesystem::rename(tmpPath, _path);
+}
+
+bool bloomContains(std::vector<uint64_t> const& _bloom, std::string_view _hash)
+{
+    auto bits = _bloom.size() * 64;
+    for (size_t i = 0; i < BLOOM_PROBES; ++i)
+    {
+        auto bit = getFixed<uint64_t>(_hash, i * sizeof(uint64_t)) % bits;
+        if ((_bloom[bit / 64] & (uint64_t(1) << (bit % 64))) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void bloomInsert(std::vector<uint64_t>& _bloom, std::string_view _hash)
+{
+    auto bits = _bloom.size() * 64;
+    for (size_t i = 0; i < BLOOM_PROBES; ++i)
+    {
+        auto bit = getFixed<uint64_t>(_hash, i * sizeof(uint64_t)) % bits;
+        _bloom[bit / 64] |= (uint64_t(1) << (bit % 64));
+    }
+}
+
+// the record payload: [count(4B)] then [hash(32B)][txSize(4B)][tx][receiptSize(4B)][receipt]...
+std::string encodePayload(std::vector<ColdBlockStore::TransactionData> const& _transactions)
+{
+    std::string payload;
+    putFixed(payload, static_cast<uint32_t>(_transactions.size()));
+    for (auto const& data : _transactions)
+    {
+        payload.append(data.hash);
+        putFixed(payload, static_cast<uint32_t>(data.transaction.size()));
+        payload.append(data.transaction);
+        putFixed(payload, static_cast<uint32_t>(data.receipt.size()));
+        payload.append(data.receipt);
+    }
+    return payload;
+}
+
+std::optional<std::vector<ColdBlockStore::TransactionData>> decodePayload(std::string_view _payload)
+{
+    auto takeFixed = [&_payload](size_t _size) -> std::optional<std::string_view> {
+        if (_payload.size() < _size)
+        {
+            return std::nullopt;
+        }
+        auto field = _payload.substr(0, _size);
+        _payload.remove_prefix(_size);
+        return field;
+    };
+    auto takeSized = [&]() -> std::optional<std::string_view> {
+        auto size = takeFixed(sizeof(uint32_t));
+        if (!size)
+        {
+            return std::nullopt;
+        }
+        return takeFixed(getFixed<uint32_t>(*size, 0));
+    };
+
+    auto count = takeFixed(sizeof(uint32_t));
+    if (!count)
+    {
+        return std::nullopt;
+    }
+    std::vector<ColdBlockStore::TransactionData> transactions(getFixed<uint32_t>(*count, 0));
+    for (auto& data : transactions)
+    {
+        auto hash = takeFixed(ColdBlockStore::HASH_SIZE);
+        auto transaction = hash ? takeSized() : std::nullopt;
+        auto receipt = transaction ? takeSized() : std::nullopt;
+        if (!receipt)
+        {
+            return std::nullopt;
+        }
+        data.hash = *hash;
+        data.transaction = *transaction;
+        data.receipt = *receipt;
+    }
+    return transactions;
+}
+
+struct Record
+{
+    protocol::BlockNumber number = 0;
+    uint64_t size = 0;
+    std::optional<std::vector<ColdBlockStore::TransactionData>> transactions;
+};
+
+// read the record at the offset, transactions is nullopt if the record is torn or corrupted
+Record readRecord(std::ifstream& _file, uint64_t _offset)
+{
+    Record record;
+    if (!_file.seekg(0, std::ios::end))
+    {
+        return record;
+    }
+    auto fileSize = static_cast<uint64_t>(_file.tellg());
+    std::string header(RECORD_HEADER_SIZE, '\0');
+    if (!_file.seekg(static_cast<std::streamoff>(_offset)) ||
+        !_file.read(header.data(), RECORD_HEADER_SIZE))
+    {
+        return record;
+    }
+    record.number = getFixed<int64_t>(header, 0);
+    auto rawSize = getFixed<uint32_t>(header, 8);
+    auto compressedSize = getFixed<uint32_t>(header, 12);
+    // a torn header may claim any size
+    if (_offset + RECORD_HEADER_SIZE + compressedSize > fileSize)
+    {
+        return record;
+    }
+    std::string compressed(compressedSize, '\0');
+    if (!_file.read(compressed.data(), compressedSize))
+    {
+        return record;
+    }
+    bytes raw;
+    if (!ZstdCompress::uncompress(
+            bytesConstRef(reinterpret_cast<const byte*>(compressed.data()), compressed.size()),
+            raw) ||
+        raw.size() != rawSize)
+    {
+        return record;
+    }
+    record.size = RECORD_HEADER_SIZE + compressedSize;
+    record.transactions =
+        decodePayload(std::string_view(reinterpret_cast<const char*>(raw.data()), raw.size()));
+    return record;
+}
+
+Record readRecord(std::string const& _path, uint64_t _offset)
+{
+    std::ifstream file(_path, std::ios::binary);
+    auto record = readRecord(file, _offset);
+    if (!record.transactions)
+    {
+        throwCorrupted(_path, "invalid record at " + std::to_string(_offset));
+    }
+    return record;
+}
+}  // namespace
+
+ColdBlockStore::ColdBlockStore(std::string _path, uint64_t _segmentBlocks)
+  : m_path(std::move(_path)), m_segmentBlocks(std::max<uint64_t>(_segmentBlocks, 1))
+{
+    load();
+}
+
+ColdBlockStore::~ColdBlockStore()
+{
+    if (m_activeFile != nullptr)
+    {
+        std::fclose(m_activeFile);
+    }
+}
+
+std::string ColdBlockStore::segmentPath(
+    protocol::BlockNumber _firstBlock, std::string_view _suffix) const
+{
+    return (boost::filesystem::path(m_path) /
+            ((boost::format("%020d") % _firstBlock).str() + std::string(_suffix)))
+        .string();
+}
+
+std::string ColdBlockStore::indexPath(Segment const& _segment) const
+{
+    return segmentPath(_segment.firstBlock, ".idx");
+}
+
+void ColdBlockStore::load()
+{
+    boost::filesystem::create_directories(m_path);
+    auto prunedPath = (boost::filesystem::path(m_path) / std::string(PRUNED_FILE)).string();
+    if (boost::filesystem::exists(prunedPath))
+    {
+        std::ifstream file(prunedPath);
+        file >> m_prunedNumber;
+    }
+
+    std::vector<protocol::BlockNumber> firstBlocks;
+    for (auto const& it : boost::filesystem::directory_iterator(m_path))
+    {
+        if (it.path().extension() != ".seg")
+        {
+            continue;
+        }
+        try
+        {
+            firstBlocks.push_back(
+                boost::lexical_cast<protocol::BlockNumber>(it.path().stem().string()));
+        }
+        catch (boost::bad_lexical_cast const&)
+        {
+            COLD_STORE_LOG(WARNING) << LOG_DESC("ignore unknown segment file")
+                                    << LOG_KV("file", it.path().string());
+        }
+    }
+    std::sort(firstBlocks.begin(), firstBlocks.end());
+
+    for (auto firstBlock : firstBlocks)
+    {
+        auto segment = std::make_shared<Segment>();
+        segment->firstBlock = firstBlock;
+        segment->dataPath = segmentPath(firstBlock, ".seg");
+        if (!m_segments.empty())
+        {
+            auto& last = *m_segments.back();
+            if (!last.sealed)
+            {
+                // crashed while sealing the segment
+                sealSegment(last);
+            }
+            if (last.firstBlock + static_cast<protocol::BlockNumber>(last.blockOffsets.size()) >
+                firstBlock)
+            {
+                throwCorrupted(segment->dataPath, "the segments overlap");
+            }
+        }
+        if (boost::filesystem::exists(indexPath(*segment)))
+        {
+            loadIndex(*segment);
+        }
+        else
+        {
+            scanSegment(*segment);
+        }
+        m_segments.push_back(std::move(segment));
+    }
+    openActive();
+
+    COLD_STORE_LOG(INFO) << LOG_DESC("load") << LOG_KV("path", m_path)
+                         << LOG_KV("segments", m_segments.size())
+                         << LOG_KV("begin", beginBlockNumber()) << LOG_KV("end", endBlockNumber())
+                         << LOG_KV("pruned", m_prunedNumber);
+}
+
+void ColdBlockStore::openActive()
+{
+    if (m_segments.empty() || m_segments.back()->sealed)
+    {
+        return;
+    }
+    auto& segment = *m_segments.back();
+    m_activeFile = std::fopen(segment.dataPath.c_str(), "ab");
+    if (m_activeFile == nullptr)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::ErrorCommitBlock,
+            "Open cold block store file failed: " + segment.dataPath));
+    }
+}
+
+void ColdBlockStore::scanSegment(Segment& _segment)
+{
+    std::ifstream file(_segment.dataPath, std::ios::binary);
+    uint64_t offset = 0;
+    while (true)
+    {
+        auto record = readRecord(file, offset);
+        if (!record.transactions ||
+            record.number != _segment.firstBlock +
+                                 static_cast<protocol::BlockNumber>(_segment.blockOffsets.size()))
+        {
+            break;
+        }
+        _segment.blockOffsets.push_back(offset);
+        for (auto& data : *record.transactions)
+        {
+            _segment.index.emplace(std::move(data.hash), offset);
+        }
+        _segment.transactions += record.transactions->size();
+        offset += record.size;
+    }
+    file.close();
+
+    auto fileSize = boost::filesystem::file_size(_segment.dataPath);
+    if (offset < fileSize)
+    {
+        // the record appended when crashed
+        COLD_STORE_LOG(WARNING) << LOG_DESC("truncate the torn record")
+                                << LOG_KV("file", _segment.dataPath) << LOG_KV("size", fileSize)
+                                << LOG_KV("valid", offset);
+        boost::filesystem::resize_file(_segment.dataPath, offset);
+    }
+    _segment.dataSize = offset;
+}
+
+void ColdBlockStore::sealSegment(Segment& _segment)
+{
+    std::vector<std::pair<std::string_view, uint64_t>> entries(
+        _segment.index.begin(), _segment.index.end());
+    std::sort(entries.begin(), entries.end());
+
+    std::vector<uint64_t> bloom(
+        std::max<uint64_t>(1, (entries.size() * BLOOM_BITS_PER_KEY + 63) / 64), 0);
+    std::vector<std::string> sparseKeys;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        bloomInsert(bloom, entries[i].first);
+        if (i % SPARSE_INTERVAL == 0)
+        {
+            sparseKeys.emplace_back(entries[i].first);
+        }
+    }
+
+    // [magic][version(1B)][firstBlock(8B)][blockCount(8B)][blockOffsets(8B)...]
+    // [bloomWords(8B)][bloom(8B)...][sparseCount(8B)][sparseKeys(32B)...]
+    // [entryCount(8B)][hash(32B) offset(8B)...]
+    std::string content(INDEX_MAGIC);
+    putFixed(content, INDEX_VERSION);
+    putFixed(content, static_cast<int64_t>(_segment.firstBlock));
+    putFixed(content, static_cast<uint64_t>(_segment.blockOffsets.size()));
+    for (auto offset : _segment.blockOffsets)
+    {
+        putFixed(content, offset);
+    }
+    putFixed(content, static_cast<uint64_t>(bloom.size()));
+    for (auto word : bloom)
+    {
+        putFixed(content, word);
+    }
+    putFixed(content, static_cast<uint64_t>(sparseKeys.size()));
+    for (auto const& key : sparseKeys)
+    {
+        content.append(key);
+    }
+    putFixed(content, static_cast<uint64_t>(entries.size()));
+    auto entriesOffset = content.size();
+    for (auto const& [hash, offset] : entries)
+    {
+        content.append(hash);
+        putFixed(content, offset);
+    }
+    writeFileAtomic(indexPath(_segment), content);
+
+    _segment.bloom = std::move(bloom);
+    _segment.sparseKeys = std::move(sparseKeys);
+    _segment.entriesOffset = entriesOffset;
+    _segment.entryCount = entries.size();
+    _segment.index = {};
+    _segment.sealed = true;
+    COLD_STORE_LOG(INFO) << LOG_DESC("seal segment") << LOG_KV("firstBlock", _segment.firstBlock)
+                         << LOG_KV("blocks", _segment.blockOffsets.size())
+                         << LOG_KV("transactions", _segment.transactions)
+                         << LOG_KV("dataSize", _segment.dataSize);
+}
+
+void ColdBlockStore::loadIndex(Segment& _segment)
+{
+    auto path = indexPath(_segment);
+    std::ifstream file(path, std::ios::binary);
+    uint64_t offset = 0;
+    auto read = [&](size_t _size) {
+        std::string buffer(_size, '\0');
+        if (!file.read(buffer.data(), static_cast<std::streamsize>(_size)))
+        {
+            throwCorrupted(path, "short read");
+        }
+        offset += _size;
+        return buffer;
+    };
+    auto readUint64 = [&]() { return getFixed<uint64_t>(read(sizeof(uint64_t)), 0); };
+
+    auto header = read(INDEX_MAGIC.size() + 1);
+    if (std::string_view(header).substr(0, INDEX_MAGIC.size()) != INDEX_MAGIC ||
+        static_cast<uint8_t>(header.back()) != INDEX_VERSION)
+    {
+        throwCorrupted(path, "unknown index version");
+    }
+    if (getFixed<int64_t>(read(sizeof(int64_t)), 0) != _segment.firstBlock)
+    {
+        throwCorrupted(path, "first block mismatch");
+    }
+    _segment.blockOffsets.resize(readUint64());
+    for (auto& blockOffset : _segment.blockOffsets)
+    {
+        blockOffset = readUint64();
+    }
+    _segment.bloom.resize(readUint64());
+    for (auto& word : _segment.bloom)
+    {
+        word = readUint64();
+    }
+    _segment.sparseKeys.resize(readUint64());
+    for (auto& key : _segment.sparseKeys)
+    {
+        key = read(HASH_SIZE);
+    }
+    _segment.entryCount = readUint64();
+    _segment.entriesOffset = offset;
+    _segment.dataSize = boost::filesystem::file_size(_segment.dataPath);
+    if (_segment.bloom.empty() || _segment.blockOffsets.empty() ||
+        _segment.blockOffsets.back() >= _segment.dataSize ||
+        offset + _segment.entryCount * INDEX_ENTRY_SIZE != boost::filesystem::file_size(path))
+    {
+        throwCorrupted(path, "invalid index");
+    }
+    _segment.sealed = true;
+}
+
+std::optional<uint64_t> ColdBlockStore::findOffset(
+    Segment const& _segment, std::string const& _hash) const
+{
+    if (!_segment.sealed)
+    {
+        auto it = _segment.index.find(_hash);
+        if (it == _segment.index.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+    if (!bloomContains(_segment.bloom, _hash))
+    {
+        return std::nullopt;
+    }
+    auto it = std::upper_bound(_segment.sparseKeys.begin(), _segment.sparseKeys.end(), _hash);
+    if (it == _segment.sparseKeys.begin())
+    {
+        return std::nullopt;
+    }
+    auto begin = static_cast<uint64_t>(it - _segment.sparseKeys.begin() - 1) * SPARSE_INTERVAL;
+    auto count = std::min(SPARSE_INTERVAL, _segment.entryCount - begin);
+    auto entries = readAt(indexPath(_segment), _segment.entriesOffset + begin * INDEX_ENTRY_SIZE,
+        count * INDEX_ENTRY_SIZE);
+
+    // binary search in the chunk
+    uint64_t low = 0;
+    uint64_t high = count;
+    while (low < high)
+    {
+        auto middle = (low + high) / 2;
+        auto hash = std::string_view(entries).substr(middle * INDEX_ENTRY_SIZE, HASH_SIZE);
+        if (hash < _hash)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low == count ||
+        std::string_view(entries).substr(low * INDEX_ENTRY_SIZE, HASH_SIZE) != _hash)
+    {
+        return std::nullopt;
+    }
+    return getFixed<uint64_t>(entries, low * INDEX_ENTRY_SIZE + HASH_SIZE);
+}
+
+std::vector<std::optional<std::string>> ColdBlockStore::get(
+    std::vector<std::string> const& _hashes, bool _receipt) const
+{
+    std::vector<std::optional<std::string>> results(_hashes.size());
+    std::shared_lock lock(x_segments);
+
+    // read every block record once: (segment, record offset) => indexes of the hashes
+    std::map<std::pair<Segment const*, uint64_t>, std::vector<size_t>> records;
+    for (size_t i = 0; i < _hashes.size(); ++i)
+    {
+        if (_hashes[i].size() != HASH_SIZE)
+        {
+            continue;
+        }
+        for (auto it = m_segments.rbegin(); it != m_segments.rend(); ++it)
+        {
+            if (auto offset = findOffset(**it, _hashes[i]))
+            {
+                records[{it->get(), *offset}].push_back(i);
+                break;
+            }
+        }
+    }
+
+    for (auto const& [location, indexes] : records)
+    {
+        auto record = readRecord(location.first->dataPath, location.second);
+        for (auto& data : *record.transactions)
+        {
+            for (auto index : indexes)
+            {
+                if (_hashes[index] == data.hash)
+                {
+                    results[index] = _receipt ? data.receipt : data.transaction;
+                }
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<std::optional<std::string>> ColdBlockStore::getTransactions(
+    std::vector<std::string> const& _hashes) const
+{
+    return get(_hashes, false);
+}
+
+std::vector<std::optional<std::string>> ColdBlockStore::getReceipts(
+    std::vector<std::string> const& _hashes) const
+{
+    return get(_hashes, true);
+}
+
+std::optional<std::vector<ColdBlockStore::TransactionData>> ColdBlockStore::getBlock(
+    protocol::BlockNumber _number) const
+{
+    std::shared_lock lock(x_segments);
+    auto it = std::upper_bound(m_segments.begin(), m_segments.end(), _number,
+        [](protocol::BlockNumber _number, auto const& _segment) {
+            return _number < _segment->firstBlock;
+        });
+    if (it == m_segments.begin())
+    {
+        return std::nullopt;
+    }
+    auto& segment = **(--it);
+    auto index = static_cast<uint64_t>(_number - segment.firstBlock);
+    if (index >= segment.blockOffsets.size())
+    {
+        return std::nullopt;
+    }
+    return readRecord(segment.dataPath, segment.blockOffsets[index]).transactions;
+}
+
+void ColdBlockStore::appendBlock(
+    protocol::BlockNumber _number, std::vector<TransactionData> const& _transactions)
+{
+    for (auto const& data : _transactions)
+    {
+        if (data.hash.size() != HASH_SIZE)
+        {
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::ErrorArgument,
+                "Invalid transaction hash size: " + std::to_string(data.hash.size())));
+        }
+    }
+    auto payload = encodePayload(_transactions);
+    bytes compressed;
+    if (!ZstdCompress::compress(
+            bytesConstRef(reinterpret_cast<const byte*>(payload.data()), payload.size()),
+            compressed, COMPRESSION_LEVEL))
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::ErrorCommitBlock, "Compress block failed"));
+    }
+    std::string record;
+    putFixed(record, static_cast<int64_t>(_number));
+    putFixed(record, static_cast<uint32_t>(payload.size()));
+    putFixed(record, static_cast<uint32_t>(compressed.size()));
+    record.append(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+
+    std::unique_lock lock(x_segments);
+    if (!m_segments.empty() && _number != endBlockNumberNoLock())
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::ErrorArgument,
+            "Append block " + std::to_string(_number) + " to cold block store, expect " +
+                std::to_string(endBlockNumberNoLock())));
+    }
+    if (m_activeFile != nullptr)
+    {
+        auto& active = *m_segments.back();
+        if (!active.blockOffsets.empty() &&
+            (active.blockOffsets.size() >= m_segmentBlocks ||
+                active.transactions + _transactions.size() > MAX_SEGMENT_TRANSACTIONS))
+        {
+            std::fclose(m_activeFile);
+            m_activeFile = nullptr;
+            sealSegment(active);
+        }
+    }
+    if (m_activeFile == nullptr)
+    {
+        auto segment = std::make_shared<Segment>();
+        segment->firstBlock = _number;
+        segment->dataPath = segmentPath(_number, ".seg");
+        m_segments.push_back(std::move(segment));
+        openActive();
+    }
+
+    auto& active = *m_segments.back();
+    if (std::fwrite(record.data(), 1, record.size(), m_activeFile) != record.size())
+    {
+        // the torn record is truncated when loaded
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::ErrorCommitBlock,
+            "Write cold block store file failed: " + active.dataPath));
+    }
+    syncFile(m_activeFile, active.dataPath);
+
+    auto offset = active.dataSize;
+    active.blockOffsets.push_back(offset);
+    for (auto const& data : _transactions)
+    {
+        active.index.emplace(data.hash, offset);
+    }
+    active.transactions += _transactions.size();
+    active.dataSize += record.size();
+}
+
+void ColdBlockStore::skipTo(protocol::BlockNumber _number)
+{
+    std::unique_lock lock(x_segments);
+    auto endNumber = endBlockNumberNoLock();
+    if (_number <= endNumber)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::ErrorArgument,
+            "Skip cold block store to " + std::to_string(_number) +
+                ", end: " + std::to_string(endNumber)));
+    }
+    if (m_activeFile != nullptr)
+    {
+        std::fclose(m_activeFile);
+        m_activeFile = nullptr;
+        auto& active = *m_segments.back();
+        if (active.blockOffsets.empty())
+        {
+            boost::filesystem::remove(active.dataPath);
+            m_segments.pop_back();
+        }
+        else
+        {
+            sealSegment(active);
+        }
+    }
+    auto segment = std::make_shared<Segment>();
+    segment->firstBlock = _number;
+    segment->dataPath = segmentPath(_number, ".seg");
+    m_segments.push_back(std::move(segment));
+    openActive();
+    COLD_STORE_LOG(WARNING) << LOG_DESC("skip blocks") << LOG_KV("from", endNumber)
+                            << LOG_KV("to", _number);
+}
+
+protocol::BlockNumber ColdBlockStore::beginBlockNumber() const
+{
+    std::shared_lock lock(x_segments);
+    return m_segments.empty() ? 0 : m_segments.front()->firstBlock;
+}
+
+protocol::BlockNumber ColdBlockStore::endBlockNumber() const
+{
+    std::shared_lock lock(x_segments);
+    return endBlockNumberNoLock();
+}
+
+protocol::BlockNumber ColdBlockStore::endBlockNumberNoLock() const
+{
+    if (m_segments.empty())
+    {
+        return 0;
+    }
+    auto& last = *m_segments.back();
+    return last.firstBlock + static_cast<protocol::BlockNumber>(last.blockOffsets.size());
+}
+
+size_t ColdBlockStore::segmentCount() const
+{
+    std::shared_lock lock(x_segments);
+    return m_segments.size();
+}
+
+protocol::BlockNumber ColdBlockStore::prunedNumber() const
+{
+    std::shared_lock lock(x_segments);
+    return m_prunedNumber;
+}
+
+void ColdBlockStore::setPrunedNumber(protocol::BlockNumber _number)
+{
+    std::unique_lock lock(x_segments);
+    writeFileAtomic((boost::filesystem::path(m_path) / std::string(PRUNED_FILE)).string(),
+        std::to_string(_number));
+    m_prunedNumber = _number;
+}
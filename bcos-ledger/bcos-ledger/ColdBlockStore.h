@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the append-only segment file store of the historical transactions and receipts
+ * @file ColdBlockStore.h
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bcos::ledger
+{
+/**
+ * The transactions and receipts of the historical blocks, stored in the segment files under a
+ * directory which may be on a cheaper disk than the state:
+ *
+ * - <firstBlock>.seg: the zstd compressed records of consecutive blocks, one record per block,
+ *   a segment holds at most segmentBlocks blocks or MAX_SEGMENT_TRANSACTIONS transactions
+ * - <firstBlock>.idx: written when the segment is sealed, the record offset of every block, the
+ *   sorted transaction hashes with their record offsets, a sparse index and a bloom filter of the
+ *   hashes. The index of the segment being appended is kept in memory and rebuilt on restart
+ * - PRUNED: the blocks below the number have been removed from the hot storage
+ *
+ * The segments follow each other without a gap, unless skipTo() resumed the store after blocks
+ * that were removed from the hot storage without being moved here.
+ *
+ * The records are written in the byte order of the host.
+ */
+class ColdBlockStore
+{
+public:
+    using Ptr = std::shared_ptr<ColdBlockStore>;
+
+    struct TransactionData
+    {
+        std::string hash;
+        std::string transaction;
+        std::string receipt;
+    };
+
+    constexpr static size_t HASH_SIZE = 32;
+    constexpr static uint64_t DEFAULT_SEGMENT_BLOCKS = 10000;
+    constexpr static uint64_t MAX_SEGMENT_TRANSACTIONS = 1U << 20U;
+    constexpr static int COMPRESSION_LEVEL = 3;
+    // a sparse index key every SPARSE_INTERVAL hashes of a sealed segment
+    constexpr static uint64_t SPARSE_INTERVAL = 256;
+    constexpr static uint64_t BLOOM_BITS_PER_KEY = 10;
+
+    explicit ColdBlockStore(
+        std::string _path, uint64_t _segmentBlocks = DEFAULT_SEGMENT_BLOCKS);
+    ~ColdBlockStore();
+    ColdBlockStore(const ColdBlockStore&) = delete;
+    ColdBlockStore(ColdBlockStore&&) = delete;
+    ColdBlockStore& operator=(const ColdBlockStore&) = delete;
+    ColdBlockStore& operator=(ColdBlockStore&&) = delete;
+
+    // append the next block, the block is synced to the disk when returned
+    void appendBlock(
+        protocol::BlockNumber _number, std::vector<TransactionData> const& _transactions);
+    // seal the segment being appended and expect _number as the next block
+    void skipTo(protocol::BlockNumber _number);
+
+    // the stored blocks are [beginBlockNumber, endBlockNumber)
+    protocol::BlockNumber beginBlockNumber() const;
+    protocol::BlockNumber endBlockNumber() const;
+    size_t segmentCount() const;
+
+    // nullopt for the hashes not stored
+    std::vector<std::optional<std::string>> getTransactions(
+        std::vector<std::string> const& _hashes) const;
+    std::vector<std::optional<std::string>> getReceipts(
+        std::vector<std::string> const& _hashes) const;
+    std::optional<std::vector<TransactionData>> getBlock(protocol::BlockNumber _number) const;
+
+    protocol::BlockNumber prunedNumber() const;
+    void setPrunedNumber(protocol::BlockNumber _number);
+
+    std::string const& path() const { return m_path; }
+
+private:
+    struct Segment
+    {
+        protocol::BlockNumber firstBlock = 0;
+        std::string dataPath;
+        std::vector<uint64_t> blockOffsets;
+        uint64_t transactions = 0;
+        uint64_t dataSize = 0;
+        bool sealed = false;
+
+        // the segment being appended
+        std::unordered_map<std::string, uint64_t> index;
+
+        // the sealed segment, the index holds one entry per distinct hash
+        std::vector<uint64_t> bloom;
+        std::vector<std::string> sparseKeys;
+        uint64_t entriesOffset = 0;
+        uint64_t entryCount = 0;
+    };
+
+    void load();
+    void scanSegment(Segment& _segment);
+    void sealSegment(Segment& _segment);
+    void loadIndex(Segment& _segment);
+    std::optional<uint64_t> findOffset(Segment const& _segment, std::string const& _hash) const;
+    std::vector<std::optional<std::string>> get(
+        std::vector<std::string> const& _hashes, bool _receipt) const;
+    void openActive();
+    protocol::BlockNumber endBlockNumberNoLock() const;
+
+    std::string indexPath(Segment const& _segment) const;
+    std::string segmentPath(protocol::BlockNumber _firstBlock, std::string_view _suffix) const;
+
+    std::string m_path;
+    uint64_t m_segmentBlocks;
+
+    std::vector<std::shared_ptr<Segment>> m_segments;
+    std::FILE* m_activeFile = nullptr;
+    protocol::BlockNumber m_prunedNumber = 0;
+    mutable std::shared_mutex x_segments;
+};
+}  // namespace bcos::ledger
@@ -168,6 +168,23 @@ void Ledger::asyncPrewriteBlock(bcos::storage::StorageInterface::Ptr storage,
         return;
     }
     auto header = block->blockHeader();
+    if (m_coldBlockStore && header->number() > m_hotBlocks &&
+        !m_movingToColdBlockStore.exchange(true))
+    {
+        m_coldBlockThreadPool->enqueue([this, endNumber = header->number() - m_hotBlocks]() {
+            try
+            {
+                moveToColdBlockStore(endNumber);
+            }
+            catch (std::exception const& e)
+            {
+                LEDGER_LOG(WARNING) << LOG_DESC("moveToColdBlockStore failed")
+                                    << LOG_KV("endNumber", endNumber)
+                                    << LOG_KV("message", boost::diagnostic_information(e));
+            }
+            m_movingToColdBlockStore = false;
+        });
+    }
 
     auto blockNumberStr = boost::lexical_cast<std::string>(header->number());
 
@@ -947,6 +964,12 @@ void Ledger::asyncGetTransactionReceiptByHash(bcos::crypto::HashType const& _txH
     getBlockStorage()->asyncGetRow(SYS_HASH_2_RECEIPT, key,
         [this, callback = std::move(_onGetTx), _withProof, key](
             auto&& error, std::optional<bcos::storage::Entry>&& entry) {
+            if (!error && !entry && m_coldBlockStore)
+            {
+                std::vector<std::optional<Entry>> entries(1);
+                fillFromColdBlockStore({std::string(key)}, entries, true);
+                entry = std::move(entries[0]);
+            }
             auto entryError = checkEntryValid(std::forward<decltype(error)>(error), entry, key);
             if (entryError)
             {
@@ -1418,6 +1441,7 @@ void Ledger::asyncBatchGetTransactions(std::shared_ptr<std::vector<std::string>>
 
                 return;
             }
+            fillFromColdBlockStore(*hashes, entries, false);
 
             std::vector<protocol::Transaction::Ptr> transactions;
             size_t i = 0;
@@ -1542,6 +1566,7 @@ void Ledger::asyncBatchGetReceipts(std::shared_ptr<std::vector<std::string>> has
 
                 return;
             }
+            fillFromColdBlockStore(*hashes, entries, true);
 
             size_t i = 0;
             std::vector<protocol::TransactionReceipt::Ptr> receipts;
@@ -1569,6 +1594,176 @@ void Ledger::asyncBatchGetReceipts(std::shared_ptr<std::vector<std::string>> has
         });
 }
 
+void Ledger::fillFromColdBlockStore(std::vector<std::string> const& _hashes,
+    std::vector<std::optional<storage::Entry>>& _entries, bool _receipt)
+{
+    if (!m_coldBlockStore)
+    {
+        return;
+    }
+    std::vector<std::string> missingHashes;
+    std::vector<size_t> missingIndexes;
+    for (size_t i = 0; i < _entries.size() && i < _hashes.size(); ++i)
+    {
+        if (!_entries[i])
+        {
+            missingHashes.push_back(_hashes[i]);
+            missingIndexes.push_back(i);
+        }
+    }
+    if (missingHashes.empty())
+    {
+        return;
+    }
+    try
+    {
+        auto values = _receipt ? m_coldBlockStore->getReceipts(missingHashes) :
+                                 m_coldBlockStore->getTransactions(missingHashes);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (values[i])
+            {
+                Entry entry;
+                entry.importFields({std::move(*values[i])});
+                _entries[missingIndexes[i]] = std::move(entry);
+            }
+        }
+    }
+    catch (std::exception const& e)
+    {
+        LEDGER_LOG(WARNING) << LOG_DESC("Read cold block store failed")
+                            << LOG_KV("receipt", _receipt)
+                            << LOG_KV("message", boost::diagnostic_information(e));
+    }
+}
+
+void Ledger::setColdBlockStore(ColdBlockStore::Ptr _coldBlockStore, BlockNumber _hotBlocks)
+{
+    m_coldBlockStore = std::move(_coldBlockStore);
+    m_hotBlocks = _hotBlocks;
+    if (m_coldBlockStore && !m_coldBlockThreadPool)
+    {
+        m_coldBlockThreadPool = std::make_shared<ThreadPool>("coldBlock", 1);
+    }
+    LEDGER_LOG(INFO) << LOG_DESC("setColdBlockStore")
+                     << LOG_KV("path", m_coldBlockStore ? m_coldBlockStore->path() : "")
+                     << LOG_KV("hotBlocks", _hotBlocks);
+}
+
+BlockNumber Ledger::moveToColdBlockStore(BlockNumber _endNumber)
+{
+    auto prunedNumber = m_coldBlockStore->prunedNumber();
+    // the transactions and receipts below the archived number have been deleted
+    std::promise<std::pair<Error::Ptr, std::optional<bcos::storage::Entry>>> statePromise;
+    asyncGetCurrentStateByKey(ledger::SYS_KEY_ARCHIVED_NUMBER,
+        [&statePromise](Error::Ptr&& err, std::optional<bcos::storage::Entry>&& entry) {
+            statePromise.set_value(std::make_pair(std::move(err), std::move(entry)));
+        });
+    auto archiveRet = statePromise.get_future().get();
+    if (archiveRet.first)
+    {
+        BOOST_THROW_EXCEPTION(*archiveRet.first);
+    }
+    auto number = std::max<BlockNumber>(prunedNumber, 1);
+    if (archiveRet.second.has_value())
+    {
+        number = std::max(number, boost::lexical_cast<BlockNumber>(archiveRet.second->get()));
+    }
+    _endNumber = std::min(_endNumber, number + MAX_COLD_BLOCKS_PER_ROUND);
+
+    auto blockStorage = getBlockStorage();
+    auto start = utcTime();
+    size_t transactionsCount = 0;
+    try
+    {
+        for (; number < _endNumber; ++number)
+        {
+            std::promise<std::pair<Error::Ptr, std::vector<std::string>>> hashesPromise;
+            asyncGetBlockTransactionHashes(
+                number, [&hashesPromise](Error::Ptr&& error, std::vector<std::string>&& hashes) {
+                    hashesPromise.set_value(std::make_pair(std::move(error), std::move(hashes)));
+                });
+            auto hashesRet = hashesPromise.get_future().get();
+            if (hashesRet.first)
+            {
+                BOOST_THROW_EXCEPTION(*hashesRet.first);
+            }
+            auto const& hashes = hashesRet.second;
+
+            auto coldEndNumber = m_coldBlockStore->endBlockNumber();
+            if (m_coldBlockStore->segmentCount() > 0 && number > coldEndNumber)
+            {
+                // the blocks in between were archived or pruned without the cold block store
+                m_coldBlockStore->skipTo(number);
+                coldEndNumber = number;
+            }
+            if (m_coldBlockStore->segmentCount() == 0 || number == coldEndNumber)
+            {
+                auto getRows = [&blockStorage, &hashes](std::string_view table) {
+                    std::promise<std::pair<Error::UniquePtr, std::vector<std::optional<Entry>>>>
+                        rowsPromise;
+                    blockStorage->asyncGetRows(
+                        table, hashes, [&rowsPromise](auto&& error, auto&& entries) {
+                            rowsPromise.set_value(std::make_pair(
+                                std::forward<decltype(error)>(error),
+                                std::forward<decltype(entries)>(entries)));
+                        });
+                    auto rows = rowsPromise.get_future().get();
+                    if (rows.first)
+                    {
+                        BOOST_THROW_EXCEPTION(*rows.first);
+                    }
+                    return std::move(rows.second);
+                };
+                auto transactions = getRows(SYS_HASH_2_TX);
+                auto receipts = getRows(SYS_HASH_2_RECEIPT);
+                std::vector<ColdBlockStore::TransactionData> block(hashes.size());
+                for (size_t i = 0; i < hashes.size(); ++i)
+                {
+                    if (!transactions[i] || !receipts[i])
+                    {
+                        BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::GetStorageError,
+                            "Missing transaction or receipt of block " + std::to_string(number) +
+                                ", hash: " + toHex(hashes[i])));
+                    }
+                    block[i].hash = hashes[i];
+                    block[i].transaction = transactions[i]->getField(0);
+                    block[i].receipt = receipts[i]->getField(0);
+                }
+                m_coldBlockStore->appendBlock(number, block);
+            }
+            // else the block was moved before a restart and only the deletion is left
+
+            auto error = blockStorage->deleteRows(SYS_HASH_2_TX, hashes);
+            if (!error)
+            {
+                error = blockStorage->deleteRows(SYS_HASH_2_RECEIPT, hashes);
+            }
+            if (error)
+            {
+                BOOST_THROW_EXCEPTION(*error);
+            }
+            transactionsCount += hashes.size();
+        }
+    }
+    catch (std::exception const& e)
+    {
+        LEDGER_LOG(WARNING) << LOG_DESC("moveToColdBlockStore stopped")
+                            << LOG_KV("number", number)
+                            << LOG_KV("message", boost::diagnostic_information(e));
+    }
+    if (number > prunedNumber)
+    {
+        m_coldBlockStore->setPrunedNumber(number);
+        LEDGER_LOG(INFO) << METRIC << LOG_DESC("moveToColdBlockStore")
+                         << LOG_KV("from", prunedNumber) << LOG_KV("to", number)
+                         << LOG_KV("txs", transactionsCount)
+                         << LOG_KV("segments", m_coldBlockStore->segmentCount())
+                         << LOG_KV("timeCost(ms)", utcTime() - start);
+    }
+    return number;
+}
+
 void Ledger::asyncGetSystemTableEntry(const std::string_view& table, const std::string_view& key,
     std::function<void(Error::Ptr&&, std::optional<bcos::storage::Entry>&&)> callback)
 {
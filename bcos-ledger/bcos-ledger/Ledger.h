@@ -18,6 +18,7 @@
  * @date 2021-04-13
  */
 #pragma once
+#include "ColdBlockStore.h"
 #include "bcos-framework/ledger/GenesisConfig.h"
 #include "bcos-framework/ledger/LedgerInterface.h"
 #include "bcos-framework/ledger/LedgerTypeDef.h"
@@ -31,6 +32,7 @@
 #include <bcos-utilities/Exceptions.h>
 #include <bcos-utilities/ThreadPool.h>
 #include <boost/compute/detail/lru_cache.hpp>
+#include <atomic>
 #include <utility>
 
 #define LEDGER_LOG(LEVEL) BCOS_LOG(LEVEL) << LOG_BADGE("LEDGER")
@@ -121,6 +123,12 @@ public:
     void asyncGetBlockTransactionHashes(bcos::protocol::BlockNumber blockNumber,
         std::function<void(Error::Ptr&&, std::vector<std::string>&&)> callback);
     void setKeyPageSize(size_t keyPageSize) { m_keyPageSize = keyPageSize; }
+    constexpr static protocol::BlockNumber MAX_COLD_BLOCKS_PER_ROUND = 1000;
+    // move the transactions and receipts of the blocks older than the latest _hotBlocks blocks
+    // to the cold block store
+    void setColdBlockStore(ColdBlockStore::Ptr _coldBlockStore, protocol::BlockNumber _hotBlocks);
+    // move the blocks below _endNumber to the cold block store, return the new pruned number
+    protocol::BlockNumber moveToColdBlockStore(protocol::BlockNumber _endNumber);
 
     task::Task<bcos::ledger::SystemConfigs> fetchAllSystemConfigs(
         protocol::BlockNumber number = INT64_MAX) override;
@@ -157,6 +165,10 @@ private:
 
     void createFileSystemTables(uint32_t blockVersion);
 
+    // fill the entries not found in the block storage with the cold block store
+    void fillFromColdBlockStore(std::vector<std::string> const& _hashes,
+        std::vector<std::optional<storage::Entry>>& _entries, bool _receipt);
+
     bcos::storage::StorageInterface::Ptr getBlockStorage()
     {
         return m_blockStorage ? m_blockStorage : m_stateStorage;
@@ -196,5 +208,11 @@ private:
     CacheType m_txProofMerkleCache;
     CacheType m_receiptProofMerkleCache;
     size_t m_keyPageSize = 0;
+
+    ColdBlockStore::Ptr m_coldBlockStore;
+    protocol::BlockNumber m_hotBlocks = 0;
+    std::atomic_bool m_movingToColdBlockStore = false;
+    // declared last to be stopped before the other members are destroyed
+    std::shared_ptr<bcos::ThreadPool> m_coldBlockThreadPool;
 };
 }  // namespace bcos::ledger
@@ -15,6 +15,7 @@
 #include "bcos-framework/storage/StorageInterface.h"
 #include "bcos-framework/storage2/Storage.h"
 #include "bcos-framework/transaction-executor/StateKey.h"
+#include "bcos-ledger/ColdBlockStore.h"
 #include "bcos-ledger/LedgerImpl.h"
 #include "bcos-table/src/LegacyStorageWrapper.h"
 #include "bcos-tars-protocol/impl/TarsSerializable.h"
@@ -79,9 +80,54 @@ void tag_invoke(ledger::tag_t<removeExpiredNonce>, LedgerInterface& ledger,
 task::Task<protocol::Block::Ptr> tag_invoke(ledger::tag_t<getBlockData> /*unused*/,
     LedgerInterface& ledger, protocol::BlockNumber blockNumber, int32_t blockFlag);
 
+// read the transactions or receipts moved out of the storage from the cold block store
+void fillFromColdBlockStore(auto const& hashes, auto& entries,
+    ColdBlockStore const* coldBlockStore, bool receipt, protocol::BlockNumber blockNumber)
+{
+    std::vector<std::string> missingHashes;
+    std::vector<size_t> missingIndexes;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (!entries[i])
+        {
+            missingHashes.emplace_back(
+                reinterpret_cast<const char*>(hashes[i].data()), hashes[i].size());
+            missingIndexes.push_back(i);
+        }
+    }
+    if (missingHashes.empty())
+    {
+        return;
+    }
+    if (coldBlockStore != nullptr)
+    {
+        auto values = receipt ? coldBlockStore->getReceipts(missingHashes) :
+                                coldBlockStore->getTransactions(missingHashes);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (values[i])
+            {
+                storage::Entry entry;
+                entry.importFields({std::move(*values[i])});
+                entries[missingIndexes[i]].emplace(std::move(entry));
+            }
+        }
+    }
+    for (auto index : missingIndexes)
+    {
+        if (!entries[index])
+        {
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(LedgerError::GetStorageError,
+                std::string(receipt ? "Missing receipt" : "Missing transaction") + " of block " +
+                    std::to_string(blockNumber) + ", hash: " + hashes[index].hex()));
+        }
+    }
+}
+
 task::Task<protocol::Block::Ptr> tag_invoke(ledger::tag_t<getBlockData> /*unused*/,
     storage2::ReadableStorage<executor_v1::StateKeyView> auto& storage,
-    protocol::BlockNumber _blockNumber, int32_t _blockFlag, protocol::BlockFactory& blockFactory)
+    protocol::BlockNumber _blockNumber, int32_t _blockFlag, protocol::BlockFactory& blockFactory,
+    ColdBlockStore const* coldBlockStore = nullptr)
 {
     LEDGER_LOG(TRACE) << "GetBlockDataByNumber request" << LOG_KV("blockNumber", _blockNumber)
                       << LOG_KV("blockFlag", _blockFlag);
@@ -148,6 +194,8 @@ task::Task<protocol::Block::Ptr> tag_invoke(ledger::tag_t<getBlockData> /*unused
                         return executor_v1::StateKeyView{
                             SYS_HASH_2_TX, bcos::concepts::bytebuffer::toView(hash)};
                     }));
+                fillFromColdBlockStore(
+                    hashes, transactions, coldBlockStore, false, _blockNumber);
                 for (auto& txEntry : transactions)
                 {
                     auto field = txEntry->getField(0);
@@ -164,6 +212,7 @@ task::Task<protocol::Block::Ptr> tag_invoke(ledger::tag_t<getBlockData> /*unused
                         return executor_v1::StateKeyView{
                             SYS_HASH_2_RECEIPT, bcos::concepts::bytebuffer::toView(hash)};
                     }));
+                fillFromColdBlockStore(hashes, receipts, coldBlockStore, true, _blockNumber);
                 for (auto& receiptEntry : receipts)
                 {
                     auto field = receiptEntry->getField(0);
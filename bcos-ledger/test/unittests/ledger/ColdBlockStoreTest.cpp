@@ -0,0 +1,196 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file ColdBlockStoreTest.cpp
+ * @date 2026-10-19
+ */
+
+#include "bcos-ledger/ColdBlockStore.h"
+#include <bcos-utilities/Error.h>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <fstream>
+
+using namespace bcos;
+using namespace bcos::ledger;
+
+namespace bcos::test
+{
+struct ColdBlockStoreFixture
+{
+    ColdBlockStoreFixture()
+    {
+        path = (boost::filesystem::temp_directory_path() /
+                boost::filesystem::unique_path("coldBlockStore-%%%%%%%%"))
+                   .string();
+    }
+    ~ColdBlockStoreFixture() { boost::filesystem::remove_all(path); }
+
+    static std::string txHash(protocol::BlockNumber _number, size_t _index)
+    {
+        auto hash = std::string(ColdBlockStore::HASH_SIZE, '\0');
+        auto key = std::to_string(_number) + "-" + std::to_string(_index);
+        std::copy(key.begin(), key.end(), hash.begin());
+        return hash;
+    }
+
+    static std::vector<ColdBlockStore::TransactionData> block(protocol::BlockNumber _number)
+    {
+        std::vector<ColdBlockStore::TransactionData> transactions;
+        for (size_t i = 0; i < static_cast<size_t>(_number % 3); ++i)
+        {
+            transactions.push_back({txHash(_number, i), "tx" + std::to_string(_number),
+                "receipt" + std::to_string(_number)});
+        }
+        return transactions;
+    }
+
+    std::string path;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ColdBlockStoreTest, ColdBlockStoreFixture)
+
+BOOST_AUTO_TEST_CASE(appendAndGet)
+{
+    {
+        ColdBlockStore store(path, 4);
+        for (protocol::BlockNumber number = 5; number < 15; ++number)
+        {
+            store.appendBlock(number, block(number));
+        }
+        BOOST_CHECK_THROW(store.appendBlock(20, block(20)), bcos::Error);
+        BOOST_CHECK_EQUAL(store.beginBlockNumber(), 5);
+        BOOST_CHECK_EQUAL(store.endBlockNumber(), 15);
+        BOOST_CHECK_EQUAL(store.segmentCount(), 3U);
+        store.setPrunedNumber(15);
+    }
+
+    // reopen with two sealed segments and an active one
+    ColdBlockStore store(path, 4);
+    BOOST_CHECK_EQUAL(store.beginBlockNumber(), 5);
+    BOOST_CHECK_EQUAL(store.endBlockNumber(), 15);
+    BOOST_CHECK_EQUAL(store.prunedNumber(), 15);
+
+    std::vector<std::string> hashes{
+        txHash(5, 1), txHash(14, 1), txHash(10, 0), txHash(11, 0), txHash(13, 1)};
+    auto transactions = store.getTransactions(hashes);
+    auto receipts = store.getReceipts(hashes);
+    BOOST_CHECK_EQUAL(transactions.size(), hashes.size());
+    BOOST_CHECK_EQUAL(*transactions[0], "tx5");
+    BOOST_CHECK_EQUAL(*transactions[1], "tx14");
+    BOOST_CHECK_EQUAL(*transactions[2], "tx10");
+    BOOST_CHECK_EQUAL(*transactions[3], "tx11");
+    BOOST_CHECK_EQUAL(*receipts[1], "receipt14");
+    // block 13 has 1 transaction only, block 15 is not stored
+    BOOST_CHECK(!transactions[4]);
+    BOOST_CHECK(!store.getReceipts({txHash(15, 0)})[0]);
+
+    auto cold = store.getBlock(11);
+    BOOST_REQUIRE(cold);
+    BOOST_CHECK_EQUAL(cold->size(), 2U);
+    BOOST_CHECK_EQUAL((*cold)[1].hash, txHash(11, 1));
+    BOOST_CHECK_EQUAL((*cold)[1].receipt, "receipt11");
+    BOOST_CHECK(store.getBlock(12)->empty());
+    BOOST_CHECK(!store.getBlock(4));
+    BOOST_CHECK(!store.getBlock(15));
+
+    store.appendBlock(15, block(15));
+    BOOST_CHECK_EQUAL(store.endBlockNumber(), 16);
+}
+
+BOOST_AUTO_TEST_CASE(truncateTornRecord)
+{
+    std::string dataPath;
+    {
+        ColdBlockStore store(path, 100);
+        for (protocol::BlockNumber number = 1; number < 6; ++number)
+        {
+            store.appendBlock(number, block(number));
+        }
+        BOOST_CHECK_EQUAL(store.segmentCount(), 1U);
+    }
+    for (auto const& it : boost::filesystem::directory_iterator(path))
+    {
+        if (it.path().extension() == ".seg")
+        {
+            dataPath = it.path().string();
+        }
+    }
+    auto size = boost::filesystem::file_size(dataPath);
+    {
+        std::ofstream file(dataPath, std::ios::binary | std::ios::app);
+        file << std::string(24, '\x7f');
+    }
+
+    ColdBlockStore store(path, 100);
+    BOOST_CHECK_EQUAL(store.endBlockNumber(), 6);
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(dataPath), size);
+    BOOST_CHECK_EQUAL(*store.getTransactions({txHash(4, 0)})[0], "tx4");
+    store.appendBlock(6, block(6));
+    BOOST_CHECK_EQUAL(store.endBlockNumber(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(duplicatedHash)
+{
+    {
+        ColdBlockStore store(path, 2);
+        store.appendBlock(
+            1, {{txHash(1, 0), "tx1", "receipt1"}, {txHash(1, 1), "tx1", "receipt1"}});
+        // the index of the segment has 3 entries for the 4 transactions
+        store.appendBlock(
+            2, {{txHash(1, 0), "tx2", "receipt2"}, {txHash(2, 1), "tx2", "receipt2"}});
+        store.appendBlock(3, block(3));
+        BOOST_CHECK_EQUAL(store.segmentCount(), 2U);
+
+        auto transactions = store.getTransactions({txHash(1, 0), txHash(1, 1), txHash(2, 1)});
+        BOOST_CHECK_EQUAL(*transactions[0], "tx1");
+        BOOST_CHECK_EQUAL(*transactions[1], "tx1");
+        BOOST_CHECK_EQUAL(*transactions[2], "tx2");
+        BOOST_CHECK(!store.getTransactions({txHash(2, 2)})[0]);
+    }
+
+    ColdBlockStore store(path, 2);
+    BOOST_CHECK_EQUAL(*store.getReceipts({txHash(2, 1)})[0], "receipt2");
+}
+
+BOOST_AUTO_TEST_CASE(skipTo)
+{
+    {
+        ColdBlockStore store(path, 100);
+        store.appendBlock(1, block(1));
+        store.appendBlock(2, block(2));
+        BOOST_CHECK_THROW(store.skipTo(3), bcos::Error);
+        store.skipTo(5);
+        // skipping again replaces the empty segment
+        store.skipTo(6);
+        BOOST_CHECK_EQUAL(store.endBlockNumber(), 6);
+        BOOST_CHECK_EQUAL(store.segmentCount(), 2U);
+        BOOST_CHECK_THROW(store.appendBlock(5, block(5)), bcos::Error);
+        store.appendBlock(6, block(6));
+        store.appendBlock(7, block(7));
+    }
+
+    ColdBlockStore store(path, 100);
+    BOOST_CHECK_EQUAL(store.beginBlockNumber(), 1);
+    BOOST_CHECK_EQUAL(store.endBlockNumber(), 8);
+    BOOST_CHECK(store.getBlock(2));
+    BOOST_CHECK(!store.getBlock(4));
+    BOOST_CHECK_EQUAL(store.getBlock(7)->size(), 1U);
+    BOOST_CHECK_EQUAL(*store.getTransactions({txHash(2, 1)})[0], "tx2");
+    BOOST_CHECK_EQUAL(*store.getTransactions({txHash(7, 0)})[0], "tx7");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -53,6 +53,7 @@
 #include <bcos-utilities/DataConvertUtility.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
 #include <boost/algorithm/hex.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
@@ -1600,5 +1601,89 @@ BOOST_AUTO_TEST_CASE(nonceList)
     }());
 }
 
+BOOST_AUTO_TEST_CASE(coldBlockStore)
+{
+    initFixture();
+    initChain(20);
+    auto path = (boost::filesystem::temp_directory_path() /
+                 boost::filesystem::unique_path("ledgerColdBlockStore-%%%%%%%%"))
+                    .string();
+    auto coldBlockStore = std::make_shared<ColdBlockStore>(path, 4);
+    m_ledger->setColdBlockStore(coldBlockStore, 5);
+
+    // the blocks [1, 8) are moved out of the storage
+    BOOST_CHECK_EQUAL(m_ledger->moveToColdBlockStore(8), 8);
+    BOOST_CHECK_EQUAL(coldBlockStore->endBlockNumber(), 8);
+    BOOST_CHECK_EQUAL(coldBlockStore->prunedNumber(), 8);
+
+    // block 3 has 3 transactions
+    auto block = m_fakeBlocks->at(2);
+    BOOST_REQUIRE_EQUAL(block->blockHeader()->number(), 3);
+    auto hashList = std::make_shared<protocol::HashList>();
+    for (size_t i = 0; i < block->transactionsSize(); ++i)
+    {
+        hashList->push_back(block->transactions()[i]->hash());
+    }
+
+    std::promise<bool> p1;
+    m_ledger->asyncGetBatchTxsByHashList(
+        hashList, false, [&](Error::Ptr _error, TransactionsPtr _txs, auto) {
+            BOOST_CHECK_EQUAL(_error, nullptr);
+            BOOST_CHECK_EQUAL(_txs->size(), hashList->size());
+            for (size_t i = 0; i < _txs->size(); ++i)
+            {
+                BOOST_CHECK_EQUAL((*_txs)[i]->hash().hex(), (*hashList)[i].hex());
+            }
+            p1.set_value(true);
+        });
+    BOOST_CHECK(p1.get_future().get());
+
+    std::promise<bool> p2;
+    m_ledger->asyncGetTransactionReceiptByHash(
+        hashList->front(), false, [&](Error::Ptr _error, TransactionReceipt::Ptr _receipt, auto) {
+            BOOST_CHECK_EQUAL(_error, nullptr);
+            BOOST_CHECK(_receipt != nullptr);
+            p2.set_value(true);
+        });
+    BOOST_CHECK(p2.get_future().get());
+
+    std::promise<bool> p3;
+    m_ledger->asyncGetBlockDataByNumber(3, RECEIPTS, [&](Error::Ptr _error, Block::Ptr _block) {
+        BOOST_CHECK_EQUAL(_error, nullptr);
+        BOOST_CHECK_EQUAL(_block->receiptsSize(), block->receiptsSize());
+        p3.set_value(true);
+    });
+    BOOST_CHECK(p3.get_future().get());
+
+    // the storage2 path reads the cold block store only when it is given
+    protocol::Block::Ptr coldBlock;
+    BOOST_CHECK_THROW(
+        coldBlock = task::syncWait(
+            ledger::getBlockData(*m_storage, 3, TRANSACTIONS, *m_blockFactory)),
+        bcos::Error);
+    coldBlock = task::syncWait(ledger::getBlockData(
+        *m_storage, 3, TRANSACTIONS | RECEIPTS, *m_blockFactory, coldBlockStore.get()));
+    BOOST_CHECK_EQUAL(coldBlock->transactionsSize(), block->transactionsSize());
+    BOOST_CHECK_EQUAL(coldBlock->receiptsSize(), block->receiptsSize());
+
+    // the blocks 8 and 9 were pruned without the cold block store, it resumes after them
+    coldBlockStore->setPrunedNumber(10);
+    BOOST_CHECK_EQUAL(m_ledger->moveToColdBlockStore(12), 12);
+    BOOST_CHECK_EQUAL(coldBlockStore->endBlockNumber(), 12);
+    BOOST_CHECK(!coldBlockStore->getBlock(9));
+    BOOST_CHECK(coldBlockStore->getBlock(10));
+    BOOST_CHECK_EQUAL(m_ledger->moveToColdBlockStore(13), 13);
+
+    m_ledger->setColdBlockStore(nullptr, 0);
+    coldBlockStore.reset();
+    {
+        ColdBlockStore reopened(path, 4);
+        BOOST_CHECK_EQUAL(reopened.beginBlockNumber(), 1);
+        BOOST_CHECK_EQUAL(reopened.endBlockNumber(), 13);
+        BOOST_CHECK_EQUAL(reopened.getBlock(12)->size(), 12U);
+    }
+    boost::filesystem::remove_all(path);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace bcos::test
@@ -145,6 +145,16 @@ ConsensusNode* ConsensusConfig::getConsensusNodeByIndex(IndexType _nodeIndex)
     }
     return {};
 }
+
+bcos::crypto::PublicPtr ConsensusConfig::getConsensusNodeIDByIndex(IndexType _nodeIndex)
+{
+    ReadGuard lock(x_consensusNodeList);
+    if (_nodeIndex < m_consensusNodeList.size())
+    {
+        return m_consensusNodeList[_nodeIndex].nodeID;
+    }
+    return nullptr;
+}
 bcos::ledger::Features bcos::consensus::ConsensusConfig::features() const
 {
     return m_features;
@@ -94,6 +94,8 @@ public:
     virtual void updateQuorum() = 0;
     IndexType getNodeIndexByNodeID(bcos::crypto::PublicPtr _nodeID);
     ConsensusNode* getConsensusNodeByIndex(IndexType _nodeIndex);
+    // the copy of the nodeID taken under the lock, safe to use while the node list is replaced
+    bcos::crypto::PublicPtr getConsensusNodeIDByIndex(IndexType _nodeIndex);
     bcos::crypto::KeyPairInterface::Ptr keyPair() { return m_keyPair; }
 
     virtual void setBlockTxCountLimit(uint64_t _blockTxCountLimit)
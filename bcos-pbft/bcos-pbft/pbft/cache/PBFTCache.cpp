@@ -410,6 +410,22 @@ bool PBFTCache::collectEnoughCheckpoint()
     return collectEnoughQuorum(m_checkpointProposal->hash(), m_checkpointCacheWeight);
 }
 
+bool PBFTCache::collectCheckPointQC()
+{
+    if (!m_checkpointProposal || !m_checkpointQC)
+    {
+        return false;
+    }
+    if (m_checkpointQC->hash() != m_checkpointProposal->hash())
+    {
+        PBFT_LOG(WARNING) << LOG_DESC("collectCheckPointQC: the QC conflicts with local checkpoint")
+                          << LOG_KV("qcHash", m_checkpointQC->hash().abridged())
+                          << printPBFTProposal(m_checkpointProposal);
+        return false;
+    }
+    return m_checkpointQCWeight >= m_config->minRequiredQuorum();
+}
+
 bool PBFTCache::checkAndCommitStableCheckPoint()
 {
     if (m_stableCommitted)
@@ -431,14 +447,29 @@ bool PBFTCache::checkAndCommitStableCheckPoint()
     {
         recalculateQuorum(m_checkpointCacheWeight, m_checkpointCacheList);
     }
-    if (!collectEnoughCheckpoint())
+    if (collectEnoughCheckpoint())
+    {
+        setSignatureList(m_checkpointProposal, m_checkpointCacheList);
+    }
+    else if (collectCheckPointQC())
+    {
+        // the QC carries the checkpoint signatures of the quorum
+        m_checkpointProposal->clearSignatureProof();
+        for (size_t i = 0; i < m_checkpointQC->signatureProofSize(); ++i)
+        {
+            auto proof = m_checkpointQC->signatureProof(i);
+            m_checkpointProposal->appendSignatureProof(proof.first, proof.second);
+        }
+        m_stableByQC = true;
+    }
+    else
     {
         return false;
     }
-    setSignatureList(m_checkpointProposal, m_checkpointCacheList);
     m_stableCommitted = true;
     PBFT_LOG(INFO) << LOG_DESC("checkAndCommitStableCheckPoint")
                    << LOG_KV("index", m_checkpointProposal->index())
+                   << LOG_KV("byQC", m_stableByQC)
                    << LOG_KV("hash", m_checkpointProposal->hash().abridged())
                    << m_config->printCurrentState();
     if (m_config->committedProposal()->index() >= m_checkpointProposal->index())
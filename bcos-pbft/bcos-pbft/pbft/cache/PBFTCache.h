@@ -84,6 +84,11 @@ public:
     bcos::protocol::BlockNumber index() const { return m_index; }
 
     virtual PBFTMessageInterface::Ptr preCommitCache() { return m_precommit; }
+    bool systemProposal() const
+    {
+        return m_prePrepare && m_prePrepare->consensusProposal() &&
+               m_prePrepare->consensusProposal()->systemProposal();
+    }
     // Note: only called when receive checkPoint-triggered-proposal response
     virtual void setPrecommitCache(PBFTMessageInterface::Ptr _precommit)
     {
@@ -112,9 +117,26 @@ public:
                        << LOG_KV("minRequiredWeight", m_config->minRequiredQuorum());
     }
 
+    // the quorum certificate aggregated by the checkpoint aggregator, verified by the caller
+    virtual void addCheckPointQC(PBFTProposalInterface::Ptr _checkPointQC, uint64_t _weight)
+    {
+        if (_checkPointQC->index() != m_index)
+        {
+            return;
+        }
+        m_checkpointQC = std::move(_checkPointQC);
+        m_checkpointQCWeight = _weight;
+        PBFT_LOG(INFO) << LOG_DESC("addCheckPointQC") << printPBFTProposal(m_checkpointQC)
+                       << LOG_KV("signatureSize", m_checkpointQC->signatureProofSize())
+                       << LOG_KV("weight", _weight)
+                       << LOG_KV("minRequiredWeight", m_config->minRequiredQuorum());
+    }
+
     virtual bool checkAndCommitStableCheckPoint();
     virtual void onCheckPointTimeout();
     bool stableCommitted() const { return m_stableCommitted; }
+    // the stable checkpoint is reached by the quorum certificate instead of the collected messages
+    bool stableByQC() const { return m_stableByQC; }
     bool precommitted() const { return m_precommitted; }
 
     void registerCommittedIndexNotify(
@@ -125,6 +147,10 @@ public:
 
     uint64_t getCollectedCheckPointWeight(bcos::crypto::HashType const& _hash)
     {
+        if (m_checkpointQC && m_checkpointQC->hash() == _hash)
+        {
+            return m_checkpointQCWeight;
+        }
         if (auto it = m_checkpointCacheWeight.find(_hash); it != m_checkpointCacheWeight.end())
         {
             return it->second;
@@ -135,6 +161,7 @@ public:
     void resetState()
     {
         m_stableCommitted.store(false);
+        m_stableByQC = false;
         m_submitted.store(false);
         m_precommitted.store(false);
         m_checkpointProposal = nullptr;
@@ -153,6 +180,7 @@ protected:
     bool collectEnoughPrepareReq();
     bool collectEnoughCommitReq();
     bool collectEnoughCheckpoint();
+    bool collectCheckPointQC();
     virtual void intoPrecommit();
     virtual void setSignatureList(
         PBFTProposalInterface::Ptr _proposal, CollectionCacheType& _cache);
@@ -236,6 +264,10 @@ protected:
     CollectionCacheType m_checkpointCacheList;
     QuorumRecoderType m_checkpointCacheWeight;
 
+    PBFTProposalInterface::Ptr m_checkpointQC = nullptr;
+    uint64_t m_checkpointQCWeight = 0;
+    bool m_stableByQC = false;
+
     std::function<void(bcos::protocol::BlockNumber)> m_committedIndexNotifier;
 };
 }  // namespace bcos::consensus
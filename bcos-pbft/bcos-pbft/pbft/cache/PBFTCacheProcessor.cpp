@@ -340,12 +340,53 @@ ProposalInterface::ConstPtr PBFTCacheProcessor::getAppliedCheckPointProposal(
 
 bool PBFTCacheProcessor::tryToPreApplyProposal(ProposalInterface::Ptr _proposal)
 {
+    // the proposal has been pre-applied since its pre-prepare was verified
+    if (auto it = m_preAppliedProposals.find(_proposal->index());
+        it != m_preAppliedProposals.end() && it->second == _proposal->hash())
+    {
+        return false;
+    }
+    m_preAppliedProposals[_proposal->index()] = _proposal->hash();
     m_config->stateMachine()->asyncPreApply(
         std::move(_proposal), [](bool success) { (void)success; });
 
     return true;
 }
 
+void PBFTCacheProcessor::trySpeculativePreApply(PBFTMessageInterface::Ptr const& _prePrepareMsg)
+{
+    if (!m_config->speculativePreApply())
+    {
+        return;
+    }
+    auto proposal = _prePrepareMsg->consensusProposal();
+    auto committedIndex = m_config->committedProposal()->index();
+    if (!proposal || proposal->index() <= committedIndex)
+    {
+        return;
+    }
+    // the proposals after an uncommitted system proposal may depend on its changes
+    if (m_config->waitSealUntil() > committedIndex)
+    {
+        return;
+    }
+    // the system proposal in the pipeline has not reached the commit queue yet, preparing the
+    // following proposals now would bake the stale system config into them
+    for (auto it = m_caches.upper_bound(committedIndex);
+         it != m_caches.end() && it->first < proposal->index(); ++it)
+    {
+        if (it->second->systemProposal())
+        {
+            return;
+        }
+    }
+    if (tryToPreApplyProposal(proposal))
+    {
+        PBFT_LOG(DEBUG) << LOG_DESC("trySpeculativePreApply") << printPBFTProposal(proposal)
+                        << m_config->printCurrentState();
+    }
+}
+
 bool PBFTCacheProcessor::tryToApplyCommitQueue()
 {
     notifyToSealNextBlock();
@@ -513,6 +554,15 @@ void PBFTCacheProcessor::addCheckPointMsg(PBFTMessageInterface::Ptr _checkPointM
         });
 }
 
+void PBFTCacheProcessor::addCheckPointQC(
+    PBFTMessageInterface::Ptr _checkPointQC, uint64_t _weight)
+{
+    addCache(m_caches, std::move(_checkPointQC),
+        [_weight](PBFTCache::Ptr _pbftCache, PBFTMessageInterface::Ptr _checkPointQC) {
+            _pbftCache->addCheckPointQC(_checkPointQC->consensusProposal(), _weight);
+        });
+}
+
 void PBFTCacheProcessor::addViewChangeReq(ViewChangeMsgInterface::Ptr _viewChange)
 {
     auto reqView = _viewChange->view();
@@ -866,6 +916,8 @@ void PBFTCacheProcessor::removeConsensusedCache(
         }
         pcache++;
     }
+    m_preAppliedProposals.erase(
+        m_preAppliedProposals.begin(), m_preAppliedProposals.upper_bound(_consensusedNumber));
     removeInvalidViewChange(_view, _consensusedNumber);
     PBFT_LOG(INFO) << LOG_DESC("removeConsensusedCache finalizeConsensus") << LOG_KV("view", _view)
                    << LOG_KV("number", _consensusedNumber) << LOG_KV("eraseSize", eraseSize)
@@ -884,6 +936,18 @@ void PBFTCacheProcessor::resetCacheAfterViewChange(
     {
         it.second->resetCache(_view);
     }
+    // the speculatively prepared proposals without precommit are discarded by the viewchange
+    for (auto it = m_preAppliedProposals.begin(); it != m_preAppliedProposals.end();)
+    {
+        auto cacheIt = m_caches.find(it->first);
+        if (it->first > _latestCommittedProposal &&
+            (cacheIt == m_caches.end() || !cacheIt->second->preCommitCache()))
+        {
+            it = m_preAppliedProposals.erase(it);
+            continue;
+        }
+        ++it;
+    }
     m_maxPrecommitIndex.clear();
     m_maxCommittedIndex.clear();
     m_newViewGenerated = false;
@@ -989,10 +1053,41 @@ void PBFTCacheProcessor::checkAndCommitStableCheckPoint()
     // must call it after iterator m_caches
     for (const auto& cache : stabledCacheList)
     {
-        updateStableCheckPointQueue(cache->checkPointProposal());
+        auto stableCheckPoint = cache->checkPointProposal();
+        if (m_config->checkPointQCEnabled() && !cache->stableByQC() &&
+            m_config->isCheckPointAggregator(stableCheckPoint->index()))
+        {
+            broadcastCheckPointQC(stableCheckPoint);
+        }
+        updateStableCheckPointQueue(stableCheckPoint);
     }
 }
 
+void PBFTCacheProcessor::broadcastCheckPointQC(PBFTProposalInterface::Ptr _stableCheckPoint)
+{
+    auto checkPointQC = m_config->pbftMessageFactory()->populateFrom(PacketType::CheckPointQC,
+        m_config->pbftMsgDefaultVersion(), m_config->view(), utcTime(), m_config->nodeIndex(),
+        _stableCheckPoint, m_config->cryptoSuite(), m_config->keyPair(), false);
+    // the QC carries the checkpoint signatures of the quorum instead of the aggregator's own
+    auto qcProposal = checkPointQC->consensusProposal();
+    for (size_t i = 0; i < _stableCheckPoint->signatureProofSize(); ++i)
+    {
+        auto proof = _stableCheckPoint->signatureProof(i);
+        qcProposal->appendSignatureProof(proof.first, proof.second);
+    }
+    PBFT_LOG(INFO) << LOG_DESC("broadcastCheckPointQC") << LOG_KV("index", checkPointQC->index())
+                   << LOG_KV("hash", checkPointQC->hash().abridged())
+                   << LOG_KV("signatureSize", qcProposal->signatureProofSize())
+                   << m_config->printCurrentState();
+    auto encodedData = m_config->codec()->encode(checkPointQC);
+    // only broadcast message to the consensus nodes
+    task::wait(
+        [](front::FrontServiceInterface::Ptr front, bytesPointer encodedData) -> task::Task<void> {
+            co_await front->broadcastMessage(bcos::protocol::NodeType::CONSENSUS_NODE,
+                ModuleID::PBFT, ::ranges::views::single(ref(*encodedData)));
+        }(m_config->frontService(), std::move(encodedData)));
+}
+
 void PBFTCacheProcessor::updateStableCheckPointQueue(PBFTProposalInterface::Ptr _stableCheckPoint)
 {
     assert(_stableCheckPoint);
@@ -121,6 +121,7 @@ public:
 
     virtual void setCheckPointProposal(PBFTProposalInterface::Ptr _proposal);
     virtual void addCheckPointMsg(PBFTMessageInterface::Ptr _checkPointMsg);
+    virtual void addCheckPointQC(PBFTMessageInterface::Ptr _checkPointQC, uint64_t _weight);
     virtual void checkAndCommitStableCheckPoint();
     virtual void tryToCommitStableCheckPoint();
 
@@ -143,6 +144,8 @@ public:
     }
 
     bool tryToPreApplyProposal(ProposalInterface::Ptr _proposal);
+    // speculatively prepare the proposal for execution once its pre-prepare is verified
+    virtual void trySpeculativePreApply(PBFTMessageInterface::Ptr const& _prePrepareMsg);
     bool tryToApplyCommitQueue();
 
     // notify the consensusing proposal index to the sync module
@@ -205,6 +208,7 @@ public:
         m_executingProposals.clear();
         m_committedProposalList.clear();
         m_proposalsToStableConsensus.clear();
+        m_preAppliedProposals.clear();
 
         std::priority_queue<PBFTProposalInterface::Ptr, std::vector<PBFTProposalInterface::Ptr>,
             PBFTProposalCmp>
@@ -240,6 +244,7 @@ protected:
     void reCalculateViewChangeWeight();
     void removeInvalidRecoverCache(ViewType _view);
     void notifyMaxProposalIndex(bcos::protocol::BlockNumber _proposalIndex);
+    virtual void broadcastCheckPointQC(PBFTProposalInterface::Ptr _stableCheckPoint);
 
 protected:
     PBFTCacheFactory::Ptr m_cacheFactory;
@@ -268,6 +273,8 @@ protected:
 
     // ordered by the index
     std::set<bcos::protocol::BlockNumber, std::less<>> m_proposalsToStableConsensus;
+    // index => hash of the proposals that have been pre-applied
+    std::map<bcos::protocol::BlockNumber, bcos::crypto::HashType> m_preAppliedProposals;
 
     std::priority_queue<PBFTProposalInterface::Ptr, std::vector<PBFTProposalInterface::Ptr>,
         PBFTProposalCmp>
@@ -178,6 +178,35 @@ public:
         m_checkPointTimeoutInterval = _timeoutInterval;
     }
 
+    // prepare the proposal for execution once its pre-prepare is verified, overlapping the
+    // preparation with the prepare/commit rounds
+    bool speculativePreApply() const { return m_speculativePreApply; }
+    void setSpeculativePreApply(bool _speculativePreApply)
+    {
+        m_speculativePreApply = _speculativePreApply;
+    }
+
+    // the checkpoint messages are sent to the aggregator, which broadcasts the quorum certificate
+    bool checkPointQCEnabled() const
+    {
+        return features().get(ledger::Features::Flag::feature_checkpoint_qc);
+    }
+    // the leader of the proposal aggregates the checkpoint signatures, the next node aggregates
+    // them as well so that an unreachable leader does not stall the checkpoint until the timeout
+    IndexType checkPointAggregator(bcos::protocol::BlockNumber _index)
+    {
+        return leaderIndex(_index);
+    }
+    IndexType checkPointBackupAggregator(bcos::protocol::BlockNumber _index)
+    {
+        return (leaderIndex(_index) + 1) % consensusNodesNum();
+    }
+    bool isCheckPointAggregator(bcos::protocol::BlockNumber _index)
+    {
+        return nodeIndex() == checkPointAggregator(_index) ||
+               nodeIndex() == checkPointBackupAggregator(_index);
+    }
+
     void resetToView()
     {
         m_toView.store(m_view);
@@ -458,6 +487,7 @@ protected:
 
     int64_t m_waterMarkLimit = 50;
     std::atomic<int64_t> m_checkPointTimeoutInterval = {3000};
+    std::atomic_bool m_speculativePreApply = {true};
     std::atomic<int64_t> m_minSealTime = {3000};
 
     std::atomic<uint64_t> m_leaderSwitchPeriod = {1};
@@ -180,6 +180,10 @@ void PBFTEngine::stop()
         m_timer->stop();
         m_timer->destroy();
     }
+    if (m_msgVerifier)
+    {
+        m_msgVerifier->stop();
+    }
     PBFT_LOG(INFO) << LOG_DESC("stop the PBFTEngine");
 }
 
@@ -262,13 +266,7 @@ void PBFTEngine::onProposalApplySuccess(
         m_config->pbftMsgDefaultVersion(), m_config->view(), utcTime(), m_config->nodeIndex(),
         _executedProposal, m_config->cryptoSuite(), m_config->keyPair(), true);
 
-    auto encodedData = m_config->codec()->encode(checkPointMsg);
-    // only broadcast message to the consensus nodes
-    task::wait(
-        [](front::FrontServiceInterface::Ptr front, bytesPointer encodedData) -> task::Task<void> {
-            co_await front->broadcastMessage(bcos::protocol::NodeType::CONSENSUS_NODE,
-                ModuleID::PBFT, ::ranges::views::single(ref(*encodedData)));
-        }(m_config->frontService(), std::move(encodedData)));
+    sendCheckPointMsg(checkPointMsg);
     auto startT = utcTime();
     auto recordT = utcTime();
     // Note: must lock here to ensure thread safe
@@ -308,6 +306,50 @@ void PBFTEngine::onProposalApplySuccess(
                    << LOG_KV("timecost", (utcTime() - recordT));
 }
 
+void PBFTEngine::sendCheckPointMsg(PBFTMessageInterface::Ptr const& _checkPointMsg)
+{
+    if (m_config->checkPointQCEnabled())
+    {
+        // linear message flow: the aggregators collect the checkpoints and broadcast the QC
+        auto index = _checkPointMsg->index();
+        auto aggregators = {m_config->checkPointAggregator(index),
+            m_config->checkPointBackupAggregator(index)};
+        bcos::crypto::NodeIDs aggregatorNodeIDs;
+        bool missingAggregator = false;
+        for (auto aggregator : aggregators)
+        {
+            if (aggregator == m_config->nodeIndex())
+            {
+                continue;
+            }
+            auto nodeID = m_config->getConsensusNodeIDByIndex(aggregator);
+            if (nodeID == nullptr)
+            {
+                missingAggregator = true;
+                break;
+            }
+            aggregatorNodeIDs.emplace_back(std::move(nodeID));
+        }
+        if (!missingAggregator)
+        {
+            auto encodedData = m_config->codec()->encode(_checkPointMsg);
+            for (auto const& nodeID : aggregatorNodeIDs)
+            {
+                m_config->frontService()->asyncSendMessageByNodeID(
+                    ModuleID::PBFT, nodeID, ref(*encodedData), 0, nullptr);
+            }
+            return;
+        }
+    }
+    auto encodedData = m_config->codec()->encode(_checkPointMsg);
+    // only broadcast message to the consensus nodes
+    task::wait(
+        [](front::FrontServiceInterface::Ptr front, bytesPointer encodedData) -> task::Task<void> {
+            co_await front->broadcastMessage(bcos::protocol::NodeType::CONSENSUS_NODE,
+                ModuleID::PBFT, ::ranges::views::single(ref(*encodedData)));
+        }(m_config->frontService(), std::move(encodedData)));
+}
+
 // called after proposal executed successfully
 void PBFTEngine::onProposalApplied(int64_t _errorCode, PBFTProposalInterface::Ptr _proposal,
     PBFTProposalInterface::Ptr _executedProposal)
@@ -543,6 +585,21 @@ void PBFTEngine::onReceivePBFTMessage(Error::Ptr _error, NodeIDPtr _fromNode, by
             }
             return;
         }
+        if (m_msgVerifier)
+        {
+            // verify the signature before the message reaches the single-threaded worker
+            m_msgVerifier->asyncVerify(
+                pbftMsg, [self = weak_from_this()](PBFTBaseMessageInterface::Ptr _msg) {
+                    auto engine = self.lock();
+                    if (!engine)
+                    {
+                        return;
+                    }
+                    engine->m_msgQueue.push(std::move(_msg));
+                    engine->m_signalled.notify_all();
+                });
+            return;
+        }
         m_msgQueue.push(pbftMsg);
         m_signalled.notify_all();
     }
@@ -660,6 +717,12 @@ void PBFTEngine::handleMsg(std::shared_ptr<PBFTBaseMessageInterface> _msg)
         handleCheckPointMsg(checkPointMsg);
         break;
     }
+    case PacketType::CheckPointQC:
+    {
+        auto checkPointQC = std::dynamic_pointer_cast<PBFTMessageInterface>(_msg);
+        handleCheckPointQCMsg(checkPointQC);
+        break;
+    }
     case PacketType::RecoverRequest:
     {
         auto request = std::dynamic_pointer_cast<PBFTMessageInterface>(_msg);
@@ -782,6 +845,10 @@ CheckResult PBFTEngine::checkSignature(PBFTBaseMessageInterface::Ptr _req)
         return CheckResult::INVALID;
     }
     auto publicKey = nodeInfo->nodeID;
+    if (isPreVerified(_req))
+    {
+        return CheckResult::VALID;
+    }
     if (!_req->verifySignature(m_config->cryptoSuite(), publicKey))
     {
         PBFT_LOG(WARNING) << LOG_DESC("checkSignature failed for invalid signature")
@@ -791,6 +858,18 @@ CheckResult PBFTEngine::checkSignature(PBFTBaseMessageInterface::Ptr _req)
     return CheckResult::VALID;
 }
 
+bool PBFTEngine::isPreVerified(PBFTBaseMessageInterface::Ptr const& _req)
+{
+    auto signer = _req->verifiedSigner();
+    if (!signer)
+    {
+        return false;
+    }
+    // the consensus node list may have been changed since the message was verified
+    auto* nodeInfo = m_config->getConsensusNodeByIndex(_req->generatedFrom());
+    return nodeInfo != nullptr && nodeInfo->nodeID->data() == signer->data();
+}
+
 bool PBFTEngine::checkProposalSignature(
     IndexType _generatedFrom, PBFTProposalInterface::Ptr _proposal)
 {
@@ -954,6 +1033,8 @@ bool PBFTEngine::handlePrePrepareMsg(PBFTMessageInterface::Ptr _prePrepareMsg,
         m_config->validator()->asyncResetTxsFlag(*block, true);
         // add the pre-prepare packet into the cache
         m_cacheProcessor->addPrePrepareCache(_prePrepareMsg);
+        // overlap the preparation for execution with the prepare/commit rounds
+        m_cacheProcessor->trySpeculativePreApply(_prePrepareMsg);
         m_config->timer()->restart();
         // broadcast PrepareMsg the packet
         broadcastPrepareMsg(_prePrepareMsg);
@@ -1093,7 +1174,8 @@ bool PBFTEngine::handlePrepareMsg(PBFTMessageInterface::Ptr const& _prepareMsg)
     {
         return false;
     }
-    if (!checkProposalSignature(_prepareMsg->generatedFrom(), _prepareMsg->consensusProposal()))
+    if (!isPreVerified(_prepareMsg) &&
+        !checkProposalSignature(_prepareMsg->generatedFrom(), _prepareMsg->consensusProposal()))
     {
         return false;
     }
@@ -1548,7 +1630,8 @@ bool PBFTEngine::handleCheckPointMsg(std::shared_ptr<PBFTMessageInterface> _chec
         return false;
     }
     // check the proposal signature
-    if (!checkProposalSignature(
+    if (!isPreVerified(_checkPointMsg) &&
+        !checkProposalSignature(
             _checkPointMsg->generatedFrom(), _checkPointMsg->consensusProposal()))
     {
         PBFT_LOG(WARNING) << LOG_DESC("handleCheckPointMsg: invalid  proposal signature")
@@ -1573,6 +1656,71 @@ bool PBFTEngine::handleCheckPointMsg(std::shared_ptr<PBFTMessageInterface> _chec
     return true;
 }
 
+bool PBFTEngine::handleCheckPointQCMsg(PBFTMessageInterface::Ptr _checkPointQC)
+{
+    if (_checkPointQC->index() <= m_config->committedProposal()->index() || isSyncingHigher())
+    {
+        PBFT_LOG(TRACE) << LOG_DESC("handleCheckPointQCMsg: Invalid expired checkpoint QC")
+                        << printPBFTMsgInfo(_checkPointQC) << m_config->printCurrentState();
+        return false;
+    }
+    if (checkSignature(_checkPointQC) == CheckResult::INVALID)
+    {
+        PBFT_LOG(WARNING) << LOG_DESC("handleCheckPointQCMsg: invalid signature")
+                          << printPBFTMsgInfo(_checkPointQC);
+        return false;
+    }
+    uint64_t weight = 0;
+    if (!checkCheckPointQC(_checkPointQC->consensusProposal(), weight))
+    {
+        PBFT_LOG(WARNING) << LOG_DESC("handleCheckPointQCMsg: invalid quorum certificate")
+                          << printPBFTMsgInfo(_checkPointQC) << LOG_KV("weight", weight)
+                          << LOG_KV("minRequiredWeight", m_config->minRequiredQuorum());
+        return false;
+    }
+    PBFT_LOG(INFO) << LOG_DESC("handleCheckPointQCMsg: try to commit the stable checkpoint")
+                   << printPBFTMsgInfo(_checkPointQC) << LOG_KV("weight", weight)
+                   << m_config->printCurrentState();
+    m_cacheProcessor->addCheckPointQC(_checkPointQC, weight);
+    m_cacheProcessor->tryToApplyCommitQueue();
+    m_cacheProcessor->checkAndCommitStableCheckPoint();
+    if (m_cacheProcessor->shouldRequestCheckPoint(_checkPointQC))
+    {
+        PBFT_LOG(INFO) << LOG_DESC("request checkPoint proposal")
+                       << LOG_KV("checkPointIndex", _checkPointQC->index())
+                       << LOG_KV("checkPointHash", _checkPointQC->hash().abridged())
+                       << m_config->printCurrentState();
+        m_logSync->requestCommittedProposals(_checkPointQC->from(), _checkPointQC->index(), 1);
+    }
+    return true;
+}
+
+bool PBFTEngine::checkCheckPointQC(PBFTProposalInterface::Ptr _checkPointQC, uint64_t& _weight)
+{
+    _weight = 0;
+    if (!_checkPointQC)
+    {
+        return false;
+    }
+    std::set<int64_t> signers;
+    for (size_t i = 0; i < _checkPointQC->signatureProofSize(); ++i)
+    {
+        auto [nodeIdx, signature] = _checkPointQC->signatureProof(i);
+        auto* nodeInfo = m_config->getConsensusNodeByIndex(nodeIdx);
+        if (nodeInfo == nullptr || !signers.insert(nodeIdx).second)
+        {
+            return false;
+        }
+        if (!m_config->cryptoSuite()->signatureImpl()->verify(
+                nodeInfo->nodeID, _checkPointQC->hash(), signature))
+        {
+            return false;
+        }
+        _weight += nodeInfo->voteWeight;
+    }
+    return _weight >= m_config->minRequiredQuorum();
+}
+
 void PBFTEngine::handleRecoverResponse(PBFTMessageInterface::Ptr _recoverResponse)
 {
     if (checkSignature(_recoverResponse) == CheckResult::INVALID)
@@ -20,6 +20,7 @@
  */
 #pragma once
 #include "PBFTLogSync.h"
+#include "PBFTMsgVerifier.h"
 #include "bcos-framework/ledger/LedgerInterface.h"
 #include "bcos-pbft/core/ConsensusEngine.h"
 #include <bcos-utilities/Error.h>
@@ -66,6 +67,12 @@ public:
 
     std::shared_ptr<PBFTConfig> pbftConfig() { return m_config; }
 
+    PBFTMsgVerifier::Ptr msgVerifier() const { return m_msgVerifier; }
+    void setMsgVerifier(PBFTMsgVerifier::Ptr _msgVerifier)
+    {
+        m_msgVerifier = std::move(_msgVerifier);
+    }
+
     // Receive PBFT message package from frontService
     virtual void onReceivePBFTMessage(bcos::Error::Ptr _error, std::string const& _id,
         bcos::crypto::NodeIDPtr _nodeID, bytesConstRef _data);
@@ -125,6 +132,8 @@ protected:
     virtual CheckResult checkPrePrepareMsg(std::shared_ptr<PBFTMessageInterface> _prePrepareMsg);
     // To check pbft msg sign valid
     virtual CheckResult checkSignature(std::shared_ptr<PBFTBaseMessageInterface> _req);
+    // the signatures of the message have been verified by the PBFTMsgVerifier
+    virtual bool isPreVerified(std::shared_ptr<PBFTBaseMessageInterface> const& _req);
     virtual bool checkProposalSignature(
         IndexType _generatedFrom, PBFTProposalInterface::Ptr _proposal);
 
@@ -158,6 +167,11 @@ protected:
 
     // handle the checkpoint message
     virtual bool handleCheckPointMsg(std::shared_ptr<PBFTMessageInterface> _checkPointMsg);
+    virtual bool handleCheckPointQCMsg(PBFTMessageInterface::Ptr _checkPointQC);
+    // verify every signature of the QC, _weight is the vote weight of the signers
+    bool checkCheckPointQC(PBFTProposalInterface::Ptr _checkPointQC, uint64_t& _weight);
+    // send the checkpoint message to the aggregator in QC mode, or broadcast it
+    void sendCheckPointMsg(PBFTMessageInterface::Ptr const& _checkPointMsg);
 
     // function called after reaching a consensus
     virtual void finalizeConsensus(
@@ -221,6 +235,9 @@ protected:
     std::shared_ptr<PBFTCacheProcessor> m_cacheProcessor;
     // for log syncing
     PBFTLogSync::Ptr m_logSync;
+    // verify the signatures of the received messages in parallel, nullptr to verify them on the
+    // worker of the engine
+    PBFTMsgVerifier::Ptr m_msgVerifier;
 
     std::function<void(std::string const&, int, bcos::crypto::NodeIDPtr, bytesConstRef)>
         m_sendResponseHandler;
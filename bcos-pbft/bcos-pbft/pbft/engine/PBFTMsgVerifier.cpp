@@ -0,0 +1,184 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the parallel signature pre-verification stage in front of the PBFTEngine
+ * @file PBFTMsgVerifier.cpp
+ * @date 2026-10-19
+ */
+#include "PBFTMsgVerifier.h"
+#include <optional>
+
+using namespace bcos;
+using namespace bcos::consensus;
+
+PBFTMsgVerifier::PBFTMsgVerifier(PBFTConfig::Ptr _config, size_t _workerNum)
+  : m_config(std::move(_config)),
+    m_workerNum(std::max<size_t>(_workerNum, 1)),
+    m_worker("pbftVerifier", m_workerNum),
+    m_lastReportTime(utcSteadyTime())
+{
+    PBFT_LOG(INFO) << LOG_DESC("create PBFTMsgVerifier") << LOG_KV("workerNum", m_workerNum);
+}
+
+void PBFTMsgVerifier::stop()
+{
+    m_worker.stop();
+}
+
+std::string PBFTMsgVerifier::dedupKey(PBFTBaseMessageInterface::Ptr const& _msg)
+{
+    auto signature = _msg->signatureData();
+    // the unsigned messages can not be identified cheaply, never deduplicate them
+    if (signature.empty())
+    {
+        return {};
+    }
+    auto packetType = _msg->packetType();
+    auto generatedFrom = _msg->generatedFrom();
+    std::string key;
+    key.reserve(sizeof(packetType) + sizeof(generatedFrom) + signature.size());
+    key.append((const char*)&packetType, sizeof(packetType));
+    key.append((const char*)&generatedFrom, sizeof(generatedFrom));
+    key.append((const char*)signature.data(), signature.size());
+    return key;
+}
+
+void PBFTMsgVerifier::asyncVerify(PBFTBaseMessageInterface::Ptr _msg, VerifiedHandler _onVerified)
+{
+    PendingMsg pending{.msg = std::move(_msg),
+        .onVerified = std::move(_onVerified),
+        .enqueueTime = utcSteadyTimeUs()};
+    auto key = dedupKey(pending.msg);
+    if (!key.empty())
+    {
+        std::lock_guard lock(x_pendingMsgs);
+        auto [it, inserted] = m_pendingMsgs.try_emplace(key);
+        if (!inserted)
+        {
+            // the identical message is being verified
+            it->second.emplace_back(std::move(pending));
+            return;
+        }
+    }
+    m_worker.enqueue([this, key = std::move(key), pending = std::move(pending)]() mutable {
+        verifyPending(key, std::move(pending));
+    });
+}
+
+bool PBFTMsgVerifier::verify(PBFTBaseMessageInterface::Ptr const& _msg) const
+{
+    // the verifier workers run concurrently with the update of the consensus node list
+    auto signer = m_config->getConsensusNodeIDByIndex(_msg->generatedFrom());
+    if (!signer)
+    {
+        return false;
+    }
+    if (!_msg->verifySignature(m_config->cryptoSuite(), signer))
+    {
+        return false;
+    }
+    // the engine checks the proposal signature of the prepare and checkpoint messages as well
+    auto packetType = _msg->packetType();
+    if (packetType == PacketType::PreparePacket || packetType == PacketType::CheckPoint)
+    {
+        auto pbftMsg = std::dynamic_pointer_cast<PBFTMessageInterface>(_msg);
+        auto proposal = pbftMsg ? pbftMsg->consensusProposal() : nullptr;
+        if (!proposal || proposal->signature().size() == 0 ||
+            !m_config->cryptoSuite()->signatureImpl()->verify(
+                signer, proposal->hash(), proposal->signature()))
+        {
+            return false;
+        }
+    }
+    _msg->setVerifiedSigner(std::move(signer));
+    return true;
+}
+
+void PBFTMsgVerifier::verifyPending(std::string const& _key, PendingMsg _pending)
+{
+    while (true)
+    {
+        auto startT = utcSteadyTimeUs();
+        auto queueWait = startT - _pending.enqueueTime;
+        m_totalQueueWaitUs.fetch_add(queueWait);
+        auto maxQueueWait = m_maxQueueWaitUs.load();
+        while (queueWait > maxQueueWait &&
+               !m_maxQueueWaitUs.compare_exchange_weak(maxQueueWait, queueWait))
+        {
+        }
+        auto verified = verify(_pending.msg);
+        m_totalVerifyUs.fetch_add(utcSteadyTimeUs() - startT);
+        verified ? ++m_verified : ++m_failed;
+
+        std::optional<PendingMsg> next;
+        if (!_key.empty())
+        {
+            std::lock_guard lock(x_pendingMsgs);
+            auto it = m_pendingMsgs.find(_key);
+            if (it != m_pendingMsgs.end())
+            {
+                if (verified || it->second.empty())
+                {
+                    m_deduplicated += it->second.size();
+                    m_pendingMsgs.erase(it);
+                }
+                else
+                {
+                    // the in-flight message is forged, the identical ones may be genuine
+                    next = std::move(it->second.front());
+                    it->second.pop_front();
+                }
+            }
+        }
+        if (_pending.onVerified)
+        {
+            _pending.onVerified(std::move(_pending.msg));
+        }
+        if (!next)
+        {
+            break;
+        }
+        _pending = std::move(*next);
+    }
+    tryToReportMetrics();
+}
+
+PBFTMsgVerifier::Metrics PBFTMsgVerifier::metrics() const
+{
+    return Metrics{.verified = m_verified,
+        .failed = m_failed,
+        .deduplicated = m_deduplicated,
+        .totalQueueWaitUs = m_totalQueueWaitUs,
+        .maxQueueWaitUs = m_maxQueueWaitUs,
+        .totalVerifyUs = m_totalVerifyUs};
+}
+
+void PBFTMsgVerifier::tryToReportMetrics()
+{
+    auto now = utcSteadyTime();
+    auto lastReportTime = m_lastReportTime.load();
+    if (now - lastReportTime < METRICS_REPORT_INTERVAL ||
+        !m_lastReportTime.compare_exchange_strong(lastReportTime, now))
+    {
+        return;
+    }
+    auto stat = metrics();
+    auto count = std::max<uint64_t>(stat.verified + stat.failed, 1);
+    PBFT_LOG(INFO) << LOG_DESC("PBFTMsgVerifier stat") << LOG_KV("verified", stat.verified)
+                   << LOG_KV("failed", stat.failed) << LOG_KV("deduplicated", stat.deduplicated)
+                   << LOG_KV("avgQueueWaitUs", stat.totalQueueWaitUs / count)
+                   << LOG_KV("maxQueueWaitUs", stat.maxQueueWaitUs)
+                   << LOG_KV("avgVerifyUs", stat.totalVerifyUs / count);
+}
@@ -0,0 +1,106 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the parallel signature pre-verification stage in front of the PBFTEngine
+ * @file PBFTMsgVerifier.h
+ * @date 2026-10-19
+ */
+#pragma once
+#include "../config/PBFTConfig.h"
+#include "../interfaces/PBFTMessageInterface.h"
+#include <bcos-utilities/ThreadPool.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace bcos::consensus
+{
+/**
+ * Verifies the signatures of the received PBFT messages on a worker pool before they are pushed
+ * into the message queue of the single-threaded PBFTEngine:
+ *
+ * - the messages passed the verification carry the verified signer, the engine skips verifying
+ *   them again as long as the signer is still the consensus node of the generatedFrom index
+ * - the messages failed the verification are still dispatched, the engine verifies and rejects
+ *   them as before
+ * - the identical messages received during the verification wait for the in-flight one, they are
+ *   dropped if it passes and verified in turn if it fails
+ */
+class PBFTMsgVerifier
+{
+public:
+    using Ptr = std::shared_ptr<PBFTMsgVerifier>;
+    using VerifiedHandler = std::function<void(PBFTBaseMessageInterface::Ptr)>;
+
+    // report the verification metrics at most once every minute
+    constexpr static uint64_t METRICS_REPORT_INTERVAL = 60 * 1000;
+
+    struct Metrics
+    {
+        uint64_t verified = 0;
+        uint64_t failed = 0;
+        uint64_t deduplicated = 0;
+        uint64_t totalQueueWaitUs = 0;
+        uint64_t maxQueueWaitUs = 0;
+        uint64_t totalVerifyUs = 0;
+    };
+
+    PBFTMsgVerifier(PBFTConfig::Ptr _config, size_t _workerNum);
+    virtual ~PBFTMsgVerifier() { stop(); }
+    PBFTMsgVerifier(const PBFTMsgVerifier&) = delete;
+    PBFTMsgVerifier(PBFTMsgVerifier&&) = delete;
+    PBFTMsgVerifier& operator=(const PBFTMsgVerifier&) = delete;
+    PBFTMsgVerifier& operator=(PBFTMsgVerifier&&) = delete;
+
+    virtual void stop();
+
+    // verify the message on the worker pool, _onVerified is called on the worker thread
+    virtual void asyncVerify(PBFTBaseMessageInterface::Ptr _msg, VerifiedHandler _onVerified);
+    // verify the signatures of the message, set the verified signer if all of them are valid
+    virtual bool verify(PBFTBaseMessageInterface::Ptr const& _msg) const;
+
+    // the metrics since the verifier created
+    Metrics metrics() const;
+    size_t workerNum() const { return m_workerNum; }
+
+private:
+    struct PendingMsg
+    {
+        PBFTBaseMessageInterface::Ptr msg;
+        VerifiedHandler onVerified;
+        uint64_t enqueueTime = 0;
+    };
+    static std::string dedupKey(PBFTBaseMessageInterface::Ptr const& _msg);
+    void verifyPending(std::string const& _key, PendingMsg _pending);
+    void tryToReportMetrics();
+
+    PBFTConfig::Ptr m_config;
+    size_t m_workerNum;
+    bcos::ThreadPool m_worker;
+
+    // dedup key => the identical messages waiting for the in-flight one
+    std::unordered_map<std::string, std::deque<PendingMsg>> m_pendingMsgs;
+    mutable std::mutex x_pendingMsgs;
+
+    std::atomic<uint64_t> m_verified = 0;
+    std::atomic<uint64_t> m_failed = 0;
+    std::atomic<uint64_t> m_deduplicated = 0;
+    std::atomic<uint64_t> m_totalQueueWaitUs = 0;
+    std::atomic<uint64_t> m_maxQueueWaitUs = 0;
+    std::atomic<uint64_t> m_totalVerifyUs = 0;
+    std::atomic<uint64_t> m_lastReportTime = 0;
+};
+}  // namespace bcos::consensus
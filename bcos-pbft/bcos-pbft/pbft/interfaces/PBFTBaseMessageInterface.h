@@ -67,6 +67,10 @@ public:
 
     virtual void setFrom(bcos::crypto::PublicPtr _from) = 0;
     virtual bcos::crypto::PublicPtr from() const = 0;
+    // the signer whose signatures of the message passed the pre-verification, nullptr if the
+    // message has not been pre-verified
+    virtual void setVerifiedSigner(bcos::crypto::PublicPtr _signer) = 0;
+    virtual bcos::crypto::PublicPtr verifiedSigner() const = 0;
     virtual uint64_t liveTimeInMilliseconds() const = 0;
     virtual std::string toDebugString() const = 0;
 };
@@ -123,6 +123,11 @@ public:
 
     void setFrom(bcos::crypto::PublicPtr _from) override { m_from = _from; }
     bcos::crypto::PublicPtr from() const override { return m_from; }
+    void setVerifiedSigner(bcos::crypto::PublicPtr _signer) override
+    {
+        m_verifiedSigner = std::move(_signer);
+    }
+    bcos::crypto::PublicPtr verifiedSigner() const override { return m_verifiedSigner; }
     uint64_t liveTimeInMilliseconds() const override { return bcos::utcTime() - m_createTime; }
     std::string toDebugString() const override
     {
@@ -161,6 +166,7 @@ protected:
     bytesPointer m_signatureData;
 
     bcos::crypto::PublicPtr m_from;
+    bcos::crypto::PublicPtr m_verifiedSigner;
     uint64_t m_createTime = 0;
 };
 }  // namespace consensus
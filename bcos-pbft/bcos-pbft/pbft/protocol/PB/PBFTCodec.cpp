@@ -78,6 +78,7 @@ PBFTBaseMessageInterface::Ptr PBFTCodec::decode(bytesConstRef _data) const
     case PacketType::CheckPoint:
     case PacketType::RecoverRequest:
     case PacketType::RecoverResponse:
+    case PacketType::CheckPointQC:
         decodedMsg = m_pbftMessageFactory->createPBFTMsg(m_cryptoSuite, payLoadRefData);
         break;
     case PacketType::PreparedProposalResponse:
@@ -42,6 +42,7 @@ enum PacketType : uint32_t
     CheckPoint = 0x9,
     RecoverRequest = 0xa,
     RecoverResponse = 0xb,
+    CheckPointQC = 0xc,
 };
 DERIVE_BCOS_EXCEPTION(UnknownPBFTMsgType);
 DERIVE_BCOS_EXCEPTION(InitPBFTException);
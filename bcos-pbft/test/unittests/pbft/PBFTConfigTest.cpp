@@ -106,6 +106,9 @@ BOOST_AUTO_TEST_CASE(testPBFTInit)
     }
     BOOST_CHECK(pbftConfig->consensusNodeList().size() == (consensusNodesSize + 1));
     BOOST_CHECK(pbftConfig->nodeID()->data() == faker->nodeID()->data());
+    BOOST_CHECK(pbftConfig->getConsensusNodeIDByIndex(pbftConfig->nodeIndex())->data() ==
+                faker->nodeID()->data());
+    BOOST_CHECK(!pbftConfig->getConsensusNodeIDByIndex(consensusNodesSize + 1));
 
     // check params
     BOOST_CHECK(pbftConfig->isConsensusNode());
@@ -131,6 +134,18 @@ BOOST_AUTO_TEST_CASE(testPBFTInit)
                 pbftConfig->progressedIndex() + pbftConfig->waterMarkLimit());
     BOOST_CHECK(pbftConfig->stateMachine());
     BOOST_CHECK(pbftConfig->expectedCheckPoint() == faker->ledger()->blockNumber() + 1);
+    // check the checkpoint aggregators: the leader and the node next to it
+    auto maxIndex = static_cast<BlockNumber>(3 * pbftConfig->leaderSwitchPeriod());
+    for (BlockNumber index = 1; index <= maxIndex; ++index)
+    {
+        auto leader = pbftConfig->leaderIndex(index);
+        BOOST_CHECK_EQUAL(pbftConfig->checkPointAggregator(index), leader);
+        BOOST_CHECK_EQUAL(pbftConfig->checkPointBackupAggregator(index),
+            (leader + 1) % pbftConfig->consensusNodesNum());
+        BOOST_CHECK_EQUAL(pbftConfig->isCheckPointAggregator(index),
+            pbftConfig->nodeIndex() == leader ||
+                pbftConfig->nodeIndex() == (leader + 1) % pbftConfig->consensusNodesNum());
+    }
 
 
 #if 0
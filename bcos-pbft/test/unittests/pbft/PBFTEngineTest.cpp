@@ -280,6 +280,163 @@ BOOST_AUTO_TEST_CASE(testHandlePrePrepareMsg)
         leaderFaker->pbftEngine()->executeWorkerByRoundbin();
     }
 }
+
+BOOST_AUTO_TEST_CASE(testMsgVerifier)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    auto signatureImpl = std::make_shared<Secp256k1Crypto>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+
+    size_t consensusNodeSize = 2;
+    auto fakerMap = createFakers(cryptoSuite, consensusNodeSize, 10, consensusNodeSize);
+    auto receiver = fakerMap[0];
+    auto sender = fakerMap[1];
+    auto codec = receiver->pbftConfig()->codec();
+
+    auto msgFixture = std::make_shared<PBFTMessageFixture>(cryptoSuite, sender->keyPair());
+    auto hash = hashImpl->hash(bytesConstRef("msgVerifier"));
+    auto commitMsg = fakePBFTMessage(utcTime(), 1, sender->pbftConfig()->view(),
+        sender->pbftConfig()->nodeIndex(), hash, 11, bytes(), 0, msgFixture,
+        PacketType::CommitPacket);
+    auto validData = sender->pbftConfig()->codec()->encode(commitMsg);
+    // signed by the key of another node
+    auto forgedData = receiver->pbftConfig()->codec()->encode(commitMsg);
+
+    auto verifier = std::make_shared<PBFTMsgVerifier>(receiver->pbftConfig(), 2);
+    BOOST_CHECK(verifier->verify(codec->decode(ref(*validData))));
+    BOOST_CHECK(!verifier->verify(codec->decode(ref(*forgedData))));
+
+    std::mutex mutex;
+    std::vector<PBFTBaseMessageInterface::Ptr> received;
+    auto onVerified = [&](PBFTBaseMessageInterface::Ptr _msg) {
+        std::lock_guard lock(mutex);
+        received.emplace_back(std::move(_msg));
+    };
+    auto waitFor = [&](size_t _count) {
+        auto startT = utcTime();
+        while (utcTime() - startT <= 10 * 1000)
+        {
+            {
+                std::lock_guard lock(mutex);
+                if (received.size() + verifier->metrics().deduplicated >= _count)
+                {
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    };
+
+    // the forged message is still dispatched to the engine, without the verified signer
+    verifier->asyncVerify(codec->decode(ref(*forgedData)), onVerified);
+    waitFor(1);
+    BOOST_REQUIRE_EQUAL(received.size(), 1U);
+    BOOST_CHECK(!received[0]->verifiedSigner());
+
+    // the identical messages received during the verification are dropped
+    size_t duplicatedCount = 4;
+    for (size_t i = 0; i < duplicatedCount; i++)
+    {
+        verifier->asyncVerify(codec->decode(ref(*validData)), onVerified);
+    }
+    waitFor(duplicatedCount + 1);
+    auto metrics = verifier->metrics();
+    std::lock_guard lock(mutex);
+    BOOST_CHECK_EQUAL(received.size() - 1 + metrics.deduplicated, duplicatedCount);
+    for (size_t i = 1; i < received.size(); i++)
+    {
+        auto signer = received[i]->verifiedSigner();
+        BOOST_REQUIRE(signer);
+        BOOST_CHECK(signer->data() == sender->keyPair()->publicKey()->data());
+    }
+    BOOST_CHECK_EQUAL(metrics.failed, 1U);
+}
+
+BOOST_AUTO_TEST_CASE(testCheckPointQC)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    auto signatureImpl = std::make_shared<Secp256k1Crypto>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+
+    size_t consensusNodeSize = 4;
+    auto fakerMap = createFakers(cryptoSuite, consensusNodeSize, 10, consensusNodeSize);
+    auto verifier = fakerMap[0];
+    auto hash = hashImpl->hash(bytesConstRef("checkPointQC"));
+    auto createQC = [&](std::vector<IndexType> const& _signers) {
+        auto qc = verifier->pbftConfig()->pbftMessageFactory()->createPBFTProposal();
+        qc->setIndex(11);
+        qc->setHash(hash);
+        for (auto signer : _signers)
+        {
+            auto faker = fakerMap[signer];
+            auto signature = signatureImpl->sign(*faker->keyPair(), hash);
+            qc->appendSignatureProof(faker->pbftConfig()->nodeIndex(), ref(*signature));
+        }
+        return qc;
+    };
+
+    uint64_t weight = 0;
+    BOOST_CHECK(verifier->pbftEngine()->checkCheckPointQC(createQC({0, 1, 2}), weight));
+    BOOST_CHECK_EQUAL(weight, verifier->pbftConfig()->minRequiredQuorum());
+    // less than the quorum
+    BOOST_CHECK(!verifier->pbftEngine()->checkCheckPointQC(createQC({1, 2}), weight));
+    // the duplicated signer
+    BOOST_CHECK(!verifier->pbftEngine()->checkCheckPointQC(createQC({1, 2, 2}), weight));
+    // the signature does not match the signer index
+    auto forged = createQC({0, 1});
+    auto signature = signatureImpl->sign(*fakerMap[1]->keyPair(), hash);
+    forged->appendSignatureProof(fakerMap[3]->pbftConfig()->nodeIndex(), ref(*signature));
+    BOOST_CHECK(!verifier->pbftEngine()->checkCheckPointQC(forged, weight));
+}
+
+BOOST_AUTO_TEST_CASE(testSpeculativePreApply)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    auto signatureImpl = std::make_shared<Secp256k1Crypto>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+
+    auto fakerMap = createFakers(cryptoSuite, 1, 10, 1);
+    auto faker = fakerMap[0];
+    auto config = faker->pbftConfig();
+    auto cacheProcessor =
+        std::dynamic_pointer_cast<FakeCacheProcessor>(faker->pbftEngine()->cacheProcessor());
+    auto committedIndex = config->committedProposal()->index();
+    auto createPrePrepare = [&](BlockNumber _index, bool _systemProposal) {
+        auto block = fakeBlock(cryptoSuite, faker, _index, 1);
+        auto blockData = std::make_shared<bytes>();
+        block->encode(*blockData);
+        auto proposal = config->pbftMessageFactory()->createPBFTProposal();
+        proposal->setIndex(_index);
+        proposal->setHash(block->blockHeader()->hash());
+        proposal->setData(*blockData);
+        proposal->setSystemProposal(_systemProposal);
+        auto prePrepare = config->pbftMessageFactory()->createPBFTMsg();
+        prePrepare->setPacketType(PacketType::PrePreparePacket);
+        prePrepare->setIndex(_index);
+        prePrepare->setHash(proposal->hash());
+        prePrepare->setConsensusProposal(proposal);
+        cacheProcessor->addPrePrepareCache(prePrepare);
+        return prePrepare;
+    };
+
+    // disabled by the config
+    config->setSpeculativePreApply(false);
+    cacheProcessor->trySpeculativePreApply(createPrePrepare(committedIndex + 1, false));
+    BOOST_CHECK(!cacheProcessor->preApplied(committedIndex + 1));
+    config->setSpeculativePreApply(true);
+
+    // the proposal after the committed proposal is prepared
+    cacheProcessor->trySpeculativePreApply(createPrePrepare(committedIndex + 1, false));
+    BOOST_CHECK(cacheProcessor->preApplied(committedIndex + 1));
+    // the system proposal itself is prepared, the proposals after it wait for its commit
+    cacheProcessor->trySpeculativePreApply(createPrePrepare(committedIndex + 2, true));
+    BOOST_CHECK(cacheProcessor->preApplied(committedIndex + 2));
+    cacheProcessor->trySpeculativePreApply(createPrePrepare(committedIndex + 3, false));
+    BOOST_CHECK(!cacheProcessor->preApplied(committedIndex + 3));
+    // the committed proposals are not prepared again
+    cacheProcessor->trySpeculativePreApply(createPrePrepare(committedIndex, false));
+    BOOST_CHECK(!cacheProcessor->preApplied(committedIndex));
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
\ No newline at end of file
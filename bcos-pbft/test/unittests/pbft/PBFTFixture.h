@@ -112,6 +112,7 @@ public:
     PBFTCachesType& caches() { return m_caches; }
     size_t stableCheckPointQueueSize() const { return m_stableCheckPointQueue.size(); }
     size_t committedQueueSize() const { return m_committedQueue.size(); }
+    bool preApplied(BlockNumber _index) const { return m_preAppliedProposals.contains(_index); }
     bool checkPrecommitWeight(PBFTMessageInterface::Ptr _precommitMsg) override
     {
         PBFTCacheProcessor::checkPrecommitWeight(_precommitMsg);
@@ -159,6 +160,11 @@ public:
 
     void executeWorkerByRoundbin() { return PBFTEngine::executeWorker(); }
 
+    bool checkCheckPointQC(PBFTProposalInterface::Ptr _checkPointQC, uint64_t& _weight)
+    {
+        return PBFTEngine::checkCheckPointQC(std::move(_checkPointQC), _weight);
+    }
+
     void onRecvProposal(bool _containSysTxs, const protocol::Block& _proposalData,
         bcos::protocol::BlockNumber _proposalIndex,
         bcos::crypto::HashType const& _proposalHash) override
@@ -139,6 +139,7 @@ void Rpc::asyncNotifyBlockNumber(std::string const& _groupID, std::string const&
         _callback(nullptr);
     }
     m_jsonRpcImpl->groupManager()->updateGroupBlockInfo(_groupID, _nodeName, _blockNumber);
+    m_jsonRpcImpl->prefillBlockResponse(_groupID, _nodeName, _blockNumber);
 
     if (m_onNewBlock)
     {
@@ -76,6 +76,13 @@ std::shared_ptr<bcos::boostssl::ws::WsConfig> RpcFactory::initConfig(
     wsConfig->setListenPort(_nodeConfig->rpcListenPort());
     wsConfig->setThreadPoolSize(_nodeConfig->rpcThreadPoolSize());
     wsConfig->setDisableSsl(_nodeConfig->rpcDisableSsl());
+    wsConfig->setMaxWriteQueueBytes(_nodeConfig->rpcSessionWriteQueueBytes());
+    wsConfig->setWriteQueueOverflowPolicy(_nodeConfig->rpcDisconnectSlowClient() ?
+                                              boostssl::ws::WriteQueueOverflowPolicy::Disconnect :
+                                              boostssl::ws::WriteQueueOverflowPolicy::Reject);
+    wsConfig->setHttpAcceptorCount(_nodeConfig->rpcHttpAcceptorCount());
+    wsConfig->setHttpPipelineLimit(_nodeConfig->rpcHttpPipelineLimit());
+    wsConfig->setHttpHandlerTimeout(_nodeConfig->rpcHttpHandlerTimeout());
     if (_nodeConfig->rpcDisableSsl())
     {
         RPC_LOG(INFO) << LOG_BADGE("initConfig") << LOG_DESC("rpc work in disable ssl model")
@@ -334,6 +341,13 @@ std::shared_ptr<bcos::boostssl::ws::WsConfig> RpcFactory::initWeb3RpcServiceConf
     wsConfig->setThreadPoolSize(_nodeConfig->web3RpcThreadSize());
     wsConfig->setDisableSsl(true);
     wsConfig->setMaxMsgSize(_nodeConfig->web3HttpBodySizeLimit());
+    wsConfig->setMaxWriteQueueBytes(_nodeConfig->rpcSessionWriteQueueBytes());
+    wsConfig->setWriteQueueOverflowPolicy(_nodeConfig->rpcDisconnectSlowClient() ?
+                                              boostssl::ws::WriteQueueOverflowPolicy::Disconnect :
+                                              boostssl::ws::WriteQueueOverflowPolicy::Reject);
+    wsConfig->setHttpAcceptorCount(_nodeConfig->rpcHttpAcceptorCount());
+    wsConfig->setHttpPipelineLimit(_nodeConfig->rpcHttpPipelineLimit());
+    wsConfig->setHttpHandlerTimeout(_nodeConfig->rpcHttpHandlerTimeout());
     wsConfig->setCorsConfig(
         bcos::boostssl::http::CorsConfig{.enableCORS = _nodeConfig->web3EnableCors(),
             .allowCredentials = _nodeConfig->web3CorsAllowCredentials(),
@@ -375,6 +389,14 @@ bcos::rpc::JsonRpcImpl_2_0::Ptr RpcFactory::buildJsonRpc(int sendTxTimeout,
     auto jsonRpcInterface = std::make_shared<bcos::rpc::JsonRpcImpl_2_0>(
         _groupManager, m_gateway, _wsService, filterSystem, m_nodeConfig->forceSender());
     jsonRpcInterface->setSendTxTimeout(sendTxTimeout);
+    jsonRpcInterface->setBatchRequestConfig(
+        m_nodeConfig->rpcBatchRequestSizeLimit(), m_nodeConfig->rpcBatchRequestConcurrency());
+    if (m_nodeConfig->rpcBlockResponseCacheSize() > 0)
+    {
+        jsonRpcInterface->setBlockResponseCache(
+            std::make_shared<BlockResponseCache>(m_nodeConfig->rpcBlockResponseCacheSize()),
+            m_nodeConfig->rpcBlockResponsePrefill());
+    }
 
     if (auto httpServer = _wsService->httpServer())
     {
@@ -392,8 +414,14 @@ bcos::rpc::Web3JsonRpcImpl::Ptr RpcFactory::buildWeb3JsonRpc(
         std::make_shared<Web3FilterSystem>(_groupManager, m_nodeConfig->groupId(),
             m_nodeConfig->web3FilterTimeout(), m_nodeConfig->web3MaxProcessBlock());
     auto web3JsonRpc = std::make_shared<Web3JsonRpcImpl>(m_nodeConfig->groupId(),
-        m_nodeConfig->web3BatchRequestSizeLimit(), std::move(_groupManager), m_gateway, _wsService,
-        web3FilterSystem, m_nodeConfig->web3SyncTransaction());
+        m_nodeConfig->web3BatchRequestSizeLimit(), m_nodeConfig->web3BatchRequestConcurrency(),
+        std::move(_groupManager), m_gateway, _wsService, web3FilterSystem,
+        m_nodeConfig->web3SyncTransaction());
+    if (m_nodeConfig->web3BlockResponseCacheSize() > 0)
+    {
+        web3JsonRpc->endpoints().setBlockResponseCache(
+            std::make_shared<BlockResponseCache>(m_nodeConfig->web3BlockResponseCacheSize()));
+    }
 
     if (auto httpServer = _wsService->httpServer())
     {
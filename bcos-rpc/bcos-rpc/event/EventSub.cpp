@@ -26,6 +26,7 @@
 #include "bcos-rpc/event/EventSubRequest.h"
 #include "bcos-rpc/event/EventSubResponse.h"
 #include "bcos-rpc/event/EventSubTask.h"
+#include "bcos-rpc/jsonrpc/JsonCodec.h"
 #include <chrono>
 #include <memory>
 #include <thread>
@@ -218,9 +219,9 @@ bool EventSub::sendEvents(std::shared_ptr<bcos::boostssl::ws::WsSession> _sessio
     auto jResp = esResp->jResp();
     jResp["result"] = _result;
 
-    Json::FastWriter writer;
-    std::string strEventInfo = writer.write(jResp);
-    auto data = std::make_shared<bcos::bytes>(strEventInfo.begin(), strEventInfo.end());
+    auto data = std::make_shared<bcos::bytes>(bcos::rpc::encodeJson(jResp));
+    // keep the trailing newline of the Json::FastWriter, the pushed payload is unchanged
+    data->push_back('\n');
 
     auto msg = m_messageFactory->buildMessage();
     msg->setPacketType(bcos::protocol::MessageType::EVENT_LOG_PUSH);
@@ -229,7 +230,9 @@ bool EventSub::sendEvents(std::shared_ptr<bcos::boostssl::ws::WsSession> _sessio
 
     EVENT_SUB(TRACE) << LOG_BADGE("sendEvents") << LOG_DESC("send events to client")
                      << LOG_KV("endpoint", _session->endPoint()) << LOG_KV("id", _id)
-                     << LOG_KV("events", strEventInfo);
+                     << LOG_KV("events", std::string_view(
+                                             reinterpret_cast<const char*>(data->data()),
+                                             data->size()));
 
     return true;
 }
@@ -22,6 +22,7 @@
 #include <bcos-rpc/event/Common.h>
 #include <bcos-rpc/event/EventSubRequest.h>
 #include <bcos-rpc/event/EventSubTask.h>
+#include <bcos-rpc/jsonrpc/JsonCodec.h>
 #include <json/json.h>
 #include <exception>
 
@@ -56,11 +57,10 @@ bool EventSubUnsubRequest::fromJson(const std::string& _request)
     try
     {
         Json::Value root;
-        Json::Reader jsonReader;
         std::string errorMessage;
         do
         {
-            if (!jsonReader.parse(_request, root))
+            if (!bcos::rpc::parseJson(_request, root))
             {
                 errorMessage = "invalid json object, parse request failed";
                 break;
@@ -178,11 +178,10 @@ bool EventSubRequest::fromJson(const std::string& _request)
     try
     {
         Json::Value root;
-        Json::Reader jsonReader;
         std::string errorMessage;
         do
         {
-            if (!jsonReader.parse(_request, root))
+            if (!bcos::rpc::parseJson(_request, root))
             {
                 errorMessage = "invalid json object, parse request failed";
                 break;
@@ -19,6 +19,7 @@
  */
 #include <bcos-rpc/event/Common.h>
 #include <bcos-rpc/event/EventSubResponse.h>
+#include <bcos-rpc/jsonrpc/JsonCodec.h>
 #include <json/json.h>
 
 using namespace bcos;
@@ -57,11 +58,10 @@ bool EventSubResponse::fromJson(const std::string& _response)
     try
     {
         Json::Value root;
-        Json::Reader jsonReader;
         std::string errorMessage;
         do
         {
-            if (!jsonReader.parse(_response, root))
+            if (!bcos::rpc::parseJson(_response, root))
             {
                 errorMessage = "invalid json object, parse response failed";
                 break;
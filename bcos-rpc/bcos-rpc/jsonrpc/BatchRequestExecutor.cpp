@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief execute the elements of a json rpc batch request concurrently
+ * @file BatchRequestExecutor.cpp
+ * @date 2026-10-19
+ */
+#include "bcos-rpc/jsonrpc/BatchRequestExecutor.h"
+#include "bcos-rpc/jsonrpc/Common.h"
+#include <boost/exception/diagnostic_information.hpp>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+BatchRequestExecutor::BatchRequestExecutor(uint32_t _concurrency)
+  : m_concurrency(std::max(_concurrency, 1U)), m_arena(static_cast<int>(m_concurrency))
+{}
+
+void BatchRequestExecutor::execute(
+    Json::Value _requests, Handler _handler, ResponseCallback _onFinished)
+{
+    auto batch = std::make_shared<Batch>();
+    batch->requests.reserve(_requests.size());
+    for (auto& request : _requests)
+    {
+        batch->requests.emplace_back(std::move(request));
+    }
+    batch->responses.resize(batch->requests.size());
+    batch->handler = std::move(_handler);
+    batch->onFinished = std::move(_onFinished);
+    if (batch->requests.empty())
+    {
+        batch->onFinished(Json::Value(Json::arrayValue));
+        return;
+    }
+
+    // one slow element only holds one worker, the others keep draining the batch
+    auto workers = std::min<size_t>(m_concurrency, batch->requests.size());
+    for (size_t i = 0; i < workers; ++i)
+    {
+        dispatch(batch);
+    }
+}
+
+void BatchRequestExecutor::dispatch(std::shared_ptr<Batch> _batch)
+{
+    auto index = _batch->next++;
+    if (index >= _batch->requests.size())
+    {
+        return;
+    }
+    m_arena.enqueue([self = shared_from_this(), batch = std::move(_batch), index]() {
+        try
+        {
+            batch->handler(std::move(batch->requests[index]),
+                [self, batch, index](Json::Value _response) {
+                    self->onResponse(batch, index, std::move(_response));
+                });
+        }
+        catch (...)
+        {
+            Json::Value response;
+            response["jsonrpc"] = "2.0";
+            response["error"]["code"] = JsonRpcError::InternalError;
+            response["error"]["message"] = boost::current_exception_diagnostic_information();
+            self->onResponse(batch, index, std::move(response));
+        }
+    });
+}
+
+void BatchRequestExecutor::onResponse(
+    std::shared_ptr<Batch> const& _batch, size_t _index, Json::Value _response)
+{
+    _batch->responses[_index] = std::move(_response);
+    if (++_batch->finished < _batch->requests.size())
+    {
+        dispatch(_batch);
+        return;
+    }
+    Json::Value responses(Json::arrayValue);
+    responses.resize(static_cast<Json::ArrayIndex>(_batch->responses.size()));
+    for (Json::ArrayIndex i = 0; i < _batch->responses.size(); ++i)
+    {
+        responses[i] = std::move(_batch->responses[i]);
+    }
+    _batch->onFinished(std::move(responses));
+}
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief execute the elements of a json rpc batch request concurrently
+ * @file BatchRequestExecutor.h
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include <json/json.h>
+#include <oneapi/tbb/task_arena.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace bcos::rpc
+{
+/**
+ * Dispatches the elements of a batch request (https://www.jsonrpc.org/specification#batch) to a
+ * bounded task arena, at most `concurrency` elements of one batch are in flight at the same time,
+ * the responses are assembled in the order of the requests.
+ */
+class BatchRequestExecutor : public std::enable_shared_from_this<BatchRequestExecutor>
+{
+public:
+    using Ptr = std::shared_ptr<BatchRequestExecutor>;
+    using ResponseCallback = std::function<void(Json::Value)>;
+    // handle one element of the batch, the callback must be called exactly once
+    using Handler = std::function<void(Json::Value, ResponseCallback)>;
+
+    constexpr static uint32_t DEFAULT_CONCURRENCY = 8;
+
+    explicit BatchRequestExecutor(uint32_t _concurrency = DEFAULT_CONCURRENCY);
+    ~BatchRequestExecutor() = default;
+    BatchRequestExecutor(const BatchRequestExecutor&) = delete;
+    BatchRequestExecutor(BatchRequestExecutor&&) = delete;
+    BatchRequestExecutor& operator=(const BatchRequestExecutor&) = delete;
+    BatchRequestExecutor& operator=(BatchRequestExecutor&&) = delete;
+
+    // _onFinished is called with the json array of the responses
+    void execute(Json::Value _requests, Handler _handler, ResponseCallback _onFinished);
+
+    uint32_t concurrency() const { return m_concurrency; }
+
+private:
+    struct Batch
+    {
+        std::vector<Json::Value> requests;
+        std::vector<Json::Value> responses;
+        std::atomic<size_t> next = 0;
+        std::atomic<size_t> finished = 0;
+        Handler handler;
+        ResponseCallback onFinished;
+    };
+    // dispatch the next pending element of the batch
+    void dispatch(std::shared_ptr<Batch> _batch);
+    void onResponse(std::shared_ptr<Batch> const& _batch, size_t _index, Json::Value _response);
+
+    uint32_t m_concurrency;
+    tbb::task_arena m_arena;
+};
+}  // namespace bcos::rpc
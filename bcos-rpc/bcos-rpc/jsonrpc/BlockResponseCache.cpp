@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the LRU cache of the block and receipt responses of the committed blocks
+ * @file BlockResponseCache.cpp
+ * @date 2026-10-19
+ */
+#include "bcos-rpc/jsonrpc/BlockResponseCache.h"
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+BlockResponseCache::BlockResponseCache(size_t _capacity, size_t _maxBytes)
+  : m_capacity(_capacity), m_maxBytes(_maxBytes)
+{}
+
+template <class Key>
+BlockResponseCache::Response BlockResponseCache::get(LRU<Key>& _lru, Key const& _key)
+{
+    if (m_capacity == 0)
+    {
+        return nullptr;
+    }
+    std::lock_guard lock(m_mutex);
+    auto it = _lru.index.find(_key);
+    if (it == _lru.index.end())
+    {
+        return nullptr;
+    }
+    _lru.entries.splice(_lru.entries.begin(), _lru.entries, it->second);
+    return it->second->response;
+}
+
+template <class Key>
+void BlockResponseCache::put(LRU<Key>& _lru, Key _key, Json::Value _response)
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+    // a response taking the most of the bytes would evict all the others, never cache it
+    auto bytes = approximateBytes(_response);
+    if (bytes > m_maxBytes / 2)
+    {
+        return;
+    }
+    auto response = std::make_shared<const Json::Value>(std::move(_response));
+    std::lock_guard lock(m_mutex);
+    if (auto it = _lru.index.find(_key); it != _lru.index.end())
+    {
+        _lru.bytes -= it->second->bytes;
+        _lru.entries.erase(it->second);
+        _lru.index.erase(it);
+    }
+    _lru.entries.push_front({_key, std::move(response), bytes});
+    _lru.index.emplace(std::move(_key), _lru.entries.begin());
+    _lru.bytes += bytes;
+    while (_lru.entries.size() > m_capacity || _lru.bytes > m_maxBytes)
+    {
+        auto& oldest = _lru.entries.back();
+        _lru.bytes -= oldest.bytes;
+        _lru.index.erase(oldest.key);
+        _lru.entries.pop_back();
+    }
+}
+
+BlockResponseCache::Response BlockResponseCache::getBlock(
+    std::string_view _groupID, protocol::BlockNumber _number, BlockResponseFormat _format)
+{
+    return get(m_blocks, BlockKey(_groupID, _number, _format));
+}
+
+void BlockResponseCache::putBlock(std::string_view _groupID, protocol::BlockNumber _number,
+    BlockResponseFormat _format, Json::Value _response)
+{
+    put(m_blocks, BlockKey(_groupID, _number, _format), std::move(_response));
+}
+
+BlockResponseCache::Response BlockResponseCache::getReceipt(
+    std::string_view _groupID, crypto::HashType const& _txHash)
+{
+    return get(m_receipts, ReceiptKey(_groupID, _txHash));
+}
+
+void BlockResponseCache::putReceipt(
+    std::string_view _groupID, crypto::HashType const& _txHash, Json::Value _response)
+{
+    put(m_receipts, ReceiptKey(_groupID, _txHash), std::move(_response));
+}
+
+size_t BlockResponseCache::bytes()
+{
+    std::lock_guard lock(m_mutex);
+    return m_blocks.bytes + m_receipts.bytes;
+}
+
+void BlockResponseCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_blocks = {};
+    m_receipts = {};
+}
+
+size_t BlockResponseCache::approximateBytes(Json::Value const& _value)
+{
+    // the value itself and the node holding it in the parent container
+    constexpr static size_t NODE_BYTES = 64;
+    size_t bytes = NODE_BYTES;
+    char const* begin = nullptr;
+    char const* end = nullptr;
+    if (_value.isString() && _value.getString(&begin, &end))
+    {
+        bytes += end - begin;
+    }
+    else if (_value.isArray() || _value.isObject())
+    {
+        for (auto it = _value.begin(); it != _value.end(); ++it)
+        {
+            if (_value.isObject() && (begin = it.memberName(&end)) != nullptr)
+            {
+                bytes += end - begin;
+            }
+            bytes += approximateBytes(*it);
+        }
+    }
+    return bytes;
+}
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the LRU cache of the block and receipt responses of the committed blocks
+ * @file BlockResponseCache.h
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include "bcos-framework/protocol/ProtocolTypeDef.h"
+#include "bcos-utilities/FixedBytes.h"
+#include <json/json.h>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace bcos::rpc
+{
+// the variants of the block response, every variant is cached separately
+enum class BlockResponseFormat : uint8_t
+{
+    Header,
+    TxHashes,
+    FullTxs,
+    Web3TxHashes,
+    Web3FullTxs,
+};
+
+/**
+ * The committed blocks never change, the json responses of the blocks and the receipts are built
+ * once and shared by all the clients polling the same blocks. Only the successful responses of the
+ * committed blocks should be put into the cache. The blocks with full transactions can be tens of
+ * MB each, the cache is bounded by the approximate bytes of the responses besides the entry count.
+ */
+class BlockResponseCache
+{
+public:
+    using Ptr = std::shared_ptr<BlockResponseCache>;
+    using Response = std::shared_ptr<const Json::Value>;
+    constexpr static size_t DEFAULT_CAPACITY = 1024;
+    constexpr static size_t DEFAULT_MAX_BYTES = 256 << 20;  // 256MB
+
+    // the capacity and the bytes of the block responses and the receipt responses respectively
+    explicit BlockResponseCache(
+        size_t _capacity = DEFAULT_CAPACITY, size_t _maxBytes = DEFAULT_MAX_BYTES);
+    ~BlockResponseCache() = default;
+    BlockResponseCache(const BlockResponseCache&) = delete;
+    BlockResponseCache(BlockResponseCache&&) = delete;
+    BlockResponseCache& operator=(const BlockResponseCache&) = delete;
+    BlockResponseCache& operator=(BlockResponseCache&&) = delete;
+
+    // nullptr if the response has not been cached
+    Response getBlock(
+        std::string_view _groupID, protocol::BlockNumber _number, BlockResponseFormat _format);
+    void putBlock(std::string_view _groupID, protocol::BlockNumber _number,
+        BlockResponseFormat _format, Json::Value _response);
+
+    Response getReceipt(std::string_view _groupID, crypto::HashType const& _txHash);
+    void putReceipt(
+        std::string_view _groupID, crypto::HashType const& _txHash, Json::Value _response);
+
+    size_t capacity() const { return m_capacity; }
+    size_t maxBytes() const { return m_maxBytes; }
+    // the approximate bytes of the cached block responses and receipt responses
+    size_t bytes();
+    void clear();
+
+    // the approximate memory held by the json value, the strings and the nodes
+    static size_t approximateBytes(Json::Value const& _value);
+
+private:
+    using BlockKey = std::tuple<std::string, protocol::BlockNumber, BlockResponseFormat>;
+    using ReceiptKey = std::tuple<std::string, crypto::HashType>;
+
+    template <class Key>
+    struct LRU
+    {
+        struct Entry
+        {
+            Key key;
+            Response response;
+            size_t bytes;
+        };
+        // the most recently used entry in the front
+        std::list<Entry> entries;
+        std::map<Key, typename std::list<Entry>::iterator> index;
+        size_t bytes = 0;
+    };
+
+    template <class Key>
+    Response get(LRU<Key>& _lru, Key const& _key);
+    template <class Key>
+    void put(LRU<Key>& _lru, Key _key, Json::Value _response);
+
+    size_t m_capacity;
+    size_t m_maxBytes;
+    LRU<BlockKey> m_blocks;
+    LRU<ReceiptKey> m_receipts;
+    // the lookups reorder the entries, they are guarded by the mutex too
+    std::mutex m_mutex;
+};
+}  // namespace bcos::rpc
@@ -96,7 +96,7 @@ struct JsonResponse
         }
     };
     std::string jsonrpc;
-    int64_t id;
+    int64_t id{0};
     Error error;
     Json::Value result;
 };
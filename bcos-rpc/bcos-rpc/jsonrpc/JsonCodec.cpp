@@ -0,0 +1,267 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the json parser and serializer of the rpc hot path
+ * @file JsonCodec.cpp
+ * @date 2026-10-19
+ */
+#include "bcos-rpc/jsonrpc/JsonCodec.h"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+// named instead of anonymous, the rpc target is built as an unity build
+namespace bcos::rpc::jsoncodec
+{
+constexpr std::string_view c_hexDigits = "0123456789abcdef";
+
+inline void append(bcos::bytes& _out, std::string_view _text)
+{
+    _out.insert(_out.end(), _text.begin(), _text.end());
+}
+
+void appendUnicodeEscape(bcos::bytes& _out, uint32_t _unit)
+{
+    char buffer[6] = {'\\', 'u', c_hexDigits[(_unit >> 12) & 0xf], c_hexDigits[(_unit >> 8) & 0xf],
+        c_hexDigits[(_unit >> 4) & 0xf], c_hexDigits[_unit & 0xf]};
+    append(_out, std::string_view(buffer, sizeof(buffer)));
+}
+
+// decode one utf-8 code point, return 0xfffd and consume one byte for the invalid sequences
+uint32_t decodeUTF8(const unsigned char*& _it, const unsigned char* _end)
+{
+    auto lead = *_it;
+    size_t length = 0;
+    uint32_t codePoint = 0;
+    if ((lead & 0xe0) == 0xc0)
+    {
+        length = 2;
+        codePoint = lead & 0x1f;
+    }
+    else if ((lead & 0xf0) == 0xe0)
+    {
+        length = 3;
+        codePoint = lead & 0x0f;
+    }
+    else if ((lead & 0xf8) == 0xf0)
+    {
+        length = 4;
+        codePoint = lead & 0x07;
+    }
+    if (length == 0 || static_cast<size_t>(_end - _it) < length)
+    {
+        ++_it;
+        return 0xfffd;
+    }
+    for (size_t i = 1; i < length; ++i)
+    {
+        if ((_it[i] & 0xc0) != 0x80)
+        {
+            ++_it;
+            return 0xfffd;
+        }
+        codePoint = (codePoint << 6) | (_it[i] & 0x3f);
+    }
+    _it += length;
+    return codePoint;
+}
+
+// escape the string as the StreamWriter does: the control and the non-ascii characters are
+// written as \uXXXX, the plain runs are copied at once
+void writeString(const char* _begin, const char* _end, bcos::bytes& _out)
+{
+    _out.push_back('"');
+    auto it = reinterpret_cast<const unsigned char*>(_begin);
+    auto end = reinterpret_cast<const unsigned char*>(_end);
+    while (it != end)
+    {
+        auto runBegin = it;
+        while (it != end && *it >= 0x20 && *it < 0x80 && *it != '"' && *it != '\\')
+        {
+            ++it;
+        }
+        _out.insert(_out.end(), runBegin, it);
+        if (it == end)
+        {
+            break;
+        }
+        switch (*it)
+        {
+        case '"':
+            append(_out, "\\\"");
+            ++it;
+            break;
+        case '\\':
+            append(_out, "\\\\");
+            ++it;
+            break;
+        case '\b':
+            append(_out, "\\b");
+            ++it;
+            break;
+        case '\f':
+            append(_out, "\\f");
+            ++it;
+            break;
+        case '\n':
+            append(_out, "\\n");
+            ++it;
+            break;
+        case '\r':
+            append(_out, "\\r");
+            ++it;
+            break;
+        case '\t':
+            append(_out, "\\t");
+            ++it;
+            break;
+        default:
+            if (*it < 0x20)
+            {
+                appendUnicodeEscape(_out, *it);
+                ++it;
+                break;
+            }
+            auto codePoint = decodeUTF8(it, end);
+            if (codePoint >= 0x10000)
+            {
+                codePoint -= 0x10000;
+                appendUnicodeEscape(_out, 0xd800 + ((codePoint >> 10) & 0x3ff));
+                appendUnicodeEscape(_out, 0xdc00 + (codePoint & 0x3ff));
+            }
+            else
+            {
+                appendUnicodeEscape(_out, codePoint);
+            }
+            break;
+        }
+    }
+    _out.push_back('"');
+}
+
+template <class Integer>
+void writeInteger(Integer _value, bcos::bytes& _out)
+{
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), _value);
+    append(_out, std::string_view(buffer, result.ptr - buffer));
+}
+
+void writeReal(double _value, bcos::bytes& _out)
+{
+    if (!std::isfinite(_value))
+    {
+        append(_out, std::isnan(_value) ? "null" : (_value < 0 ? "-1e+9999" : "1e+9999"));
+        return;
+    }
+    char buffer[32];
+    auto length = std::snprintf(buffer, sizeof(buffer), "%.17g", _value);
+    std::string_view text(buffer, length);
+    append(_out, text);
+    if (text.find_first_of(".eE") == std::string_view::npos)
+    {
+        append(_out, ".0");
+    }
+}
+
+void writeValue(Json::Value const& _value, bcos::bytes& _out)
+{
+    switch (_value.type())
+    {
+    case Json::nullValue:
+        append(_out, "null");
+        break;
+    case Json::intValue:
+        writeInteger(_value.asLargestInt(), _out);
+        break;
+    case Json::uintValue:
+        writeInteger(_value.asLargestUInt(), _out);
+        break;
+    case Json::realValue:
+        writeReal(_value.asDouble(), _out);
+        break;
+    case Json::booleanValue:
+        append(_out, _value.asBool() ? "true" : "false");
+        break;
+    case Json::stringValue:
+    {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        if (_value.getString(&begin, &end))
+        {
+            writeString(begin, end, _out);
+        }
+        else
+        {
+            append(_out, "\"\"");
+        }
+        break;
+    }
+    case Json::arrayValue:
+    {
+        _out.push_back('[');
+        for (Json::ArrayIndex i = 0; i < _value.size(); ++i)
+        {
+            if (i > 0)
+            {
+                _out.push_back(',');
+            }
+            writeValue(_value[i], _out);
+        }
+        _out.push_back(']');
+        break;
+    }
+    case Json::objectValue:
+    {
+        _out.push_back('{');
+        bool first = true;
+        for (auto it = _value.begin(); it != _value.end(); ++it)
+        {
+            if (!first)
+            {
+                _out.push_back(',');
+            }
+            first = false;
+            const char* nameEnd = nullptr;
+            const char* name = it.memberName(&nameEnd);
+            writeString(name, nameEnd, _out);
+            _out.push_back(':');
+            writeValue(*it, _out);
+        }
+        _out.push_back('}');
+        break;
+    }
+    }
+}
+}  // namespace bcos::rpc::jsoncodec
+
+bool bcos::rpc::parseJson(std::string_view _text, Json::Value& _root)
+{
+    thread_local std::unique_ptr<Json::CharReader> reader = []() {
+        Json::CharReaderBuilder builder;
+        builder["collectComments"] = false;
+        return std::unique_ptr<Json::CharReader>(builder.newCharReader());
+    }();
+    return reader->parse(_text.data(), _text.data() + _text.size(), &_root, nullptr);
+}
+
+void bcos::rpc::writeJson(Json::Value const& _value, bcos::bytes& _out)
+{
+    jsoncodec::writeValue(_value, _out);
+}
@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the json parser and serializer of the rpc hot path
+ * @file JsonCodec.h
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include <bcos-utilities/Common.h>
+#include <json/json.h>
+#include <string_view>
+
+namespace bcos::rpc
+{
+/**
+ * parse the json text with a reader cached per thread, replace the deprecated Json::Reader
+ * which allocates its parse stack and error list for every request
+ *
+ * @return false if the text is not valid json
+ */
+bool parseJson(std::string_view _text, Json::Value& _root);
+
+/**
+ * serialize the json value in the compact form and append it to the buffer, the output is the
+ * same as the StreamWriter with empty indentation, without building the writer and the ostream
+ * for every response. The handlers still build the Json::Value of the response
+ */
+void writeJson(Json::Value const& _value, bcos::bytes& _out);
+
+inline bcos::bytes encodeJson(Json::Value const& _value)
+{
+    bcos::bytes out;
+    writeJson(_value, out);
+    return out;
+}
+}  // namespace bcos::rpc
@@ -30,6 +30,7 @@
 #include "bcos-framework/protocol/TransactionReceipt.h"
 #include "bcos-protocol/TransactionStatus.h"
 #include "bcos-rpc/jsonrpc/Common.h"
+#include "bcos-rpc/jsonrpc/JsonCodec.h"
 #include "bcos-rpc/validator/CallValidator.h"
 #include "bcos-rpc/web3jsonrpc/model/Web3Transaction.h"
 #include "bcos-utilities/Base64.h"
@@ -152,14 +153,13 @@ void JsonRpcImpl_2_0::parseRpcResponseJson(
     std::string_view _responseBody, JsonResponse& _jsonResponse)
 {
     Json::Value root;
-    Json::Reader jsonReader;
     std::string errorMessage;
 
     try
     {
         do
         {
-            if (!jsonReader.parse(_responseBody.begin(), _responseBody.end(), root))
+            if (!parseJson(_responseBody, root))
             {
                 errorMessage = "invalid response json object";
                 break;
@@ -667,6 +667,17 @@ void JsonRpcImpl_2_0::getTransactionReceipt(std::string_view _groupID, std::stri
                         << LOG_KV("node", _nodeName);
 
     auto hash = bcos::crypto::HashType(_txHash, bcos::crypto::HashType::FromHex);
+    // the receipts with proof are not cached
+    auto cache = _requireProof ? nullptr : m_blockResponseCache;
+    if (cache)
+    {
+        if (auto response = cache->getReceipt(_groupID, hash))
+        {
+            Json::Value jResp = *response;
+            _respFunc(nullptr, jResp);
+            return;
+        }
+    }
 
     auto nodeService = getNodeService(_groupID, _nodeName, "getTransactionReceipt");
     auto ledger = nodeService->ledger();
@@ -683,11 +694,11 @@ void JsonRpcImpl_2_0::getTransactionReceipt(std::string_view _groupID, std::stri
 
     bool isWasm = groupInfo->wasm();
 
-    auto self = std::weak_ptr<JsonRpcImpl_2_0>(shared_from_this());
+    auto self = weakSelf();
     ledger->asyncGetTransactionReceiptByHash(hash, _requireProof,
         [m_group = std::string(_groupID), m_nodeName = std::string(_nodeName),
             m_txHash = std::string(_txHash), hash, _requireProof, m_respFunc = std::move(_respFunc),
-            self, hashImpl, isWasm](Error::Ptr _error,
+            self, hashImpl, isWasm, cache = std::move(cache)](Error::Ptr _error,
             protocol::TransactionReceipt::ConstPtr _transactionReceiptPtr,
             ledger::MerkleProofPtr _merkleProofPtr) {
             auto rpc = self.lock();
@@ -724,9 +735,12 @@ void JsonRpcImpl_2_0::getTransactionReceipt(std::string_view _groupID, std::stri
 
             // fetch transaction proof
             rpc->getTransaction(m_group, m_nodeName, m_txHash, _requireProof,
-                [m_jResp = std::move(jResp), m_txHash, m_respFunc = std::move(m_respFunc)](
-                    bcos::Error::Ptr _error, Json::Value& _jTx) mutable {
-                    if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
+                [m_jResp = std::move(jResp), m_group, m_txHash, hash,
+                    m_respFunc = std::move(m_respFunc),
+                    cache = std::move(cache)](bcos::Error::Ptr _error, Json::Value& _jTx) mutable {
+                    auto success =
+                        !_error || _error->errorCode() == bcos::protocol::CommonError::SUCCESS;
+                    if (!success)
                     {
                         RPC_IMPL_LOG(WARNING)
                             << LOG_BADGE("getTransactionReceipt") << LOG_DESC("getTransaction")
@@ -740,6 +754,10 @@ void JsonRpcImpl_2_0::getTransactionReceipt(std::string_view _groupID, std::stri
                     m_jResp["extraData"] = _jTx["extraData"];
                     m_jResp["transactionProof"] = _jTx["transactionProof"];
 
+                    if (success && cache)
+                    {
+                        cache->putReceipt(m_group, hash, m_jResp);
+                    }
                     m_respFunc(nullptr, m_jResp);
                 });
         });
@@ -755,7 +773,7 @@ void JsonRpcImpl_2_0::getBlockByHash(std::string_view _groupID, std::string_view
     auto nodeService = getNodeService(_groupID, _nodeName, "getBlockByHash");
     auto ledger = nodeService->ledger();
     checkService(ledger, "ledger");
-    auto self = std::weak_ptr<JsonRpcImpl_2_0>(shared_from_this());
+    auto self = weakSelf();
     ledger->asyncGetBlockNumberByHash(
         bcos::crypto::HashType(_blockHash, bcos::crypto::HashType::FromHex),
         [m_groupID = std::string(_groupID), m_nodeName = std::string(_nodeName),
@@ -792,6 +810,19 @@ void JsonRpcImpl_2_0::getBlockByNumber(std::string_view _groupID, std::string_vi
                         << LOG_KV("onlyHeader", _onlyHeader) << LOG_KV("onlyTxHash", _onlyTxHash)
                         << LOG_KV("group", _groupID) << LOG_KV("node", _nodeName);
 
+    auto format = _onlyHeader ? BlockResponseFormat::Header :
+                                (_onlyTxHash ? BlockResponseFormat::TxHashes :
+                                               BlockResponseFormat::FullTxs);
+    if (m_blockResponseCache)
+    {
+        if (auto response = m_blockResponseCache->getBlock(_groupID, _blockNumber, format))
+        {
+            Json::Value jResp = *response;
+            _respFunc(nullptr, jResp);
+            return;
+        }
+    }
+
     auto nodeService = getNodeService(_groupID, _nodeName, "getBlockByNumber");
     auto ledger = nodeService->ledger();
     checkService(ledger, "ledger");
@@ -800,8 +831,9 @@ void JsonRpcImpl_2_0::getBlockByNumber(std::string_view _groupID, std::string_vi
                     (_onlyTxHash ? bcos::ledger::HEADER | bcos::ledger::TRANSACTIONS_HASH :
                                    bcos::ledger::HEADER | bcos::ledger::TRANSACTIONS);
     ledger->asyncGetBlockDataByNumber(_blockNumber, flag,
-        [_blockNumber, _onlyHeader, _onlyTxHash, m_respFunc = std::move(_respFunc)](
-            Error::Ptr _error, protocol::Block::Ptr _block) {
+        [_blockNumber, _onlyHeader, _onlyTxHash, format, m_groupID = std::string(_groupID),
+            cache = m_blockResponseCache,
+            m_respFunc = std::move(_respFunc)](Error::Ptr _error, protocol::Block::Ptr _block) {
             Json::Value jResp;
             if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
             {
@@ -821,11 +853,60 @@ void JsonRpcImpl_2_0::getBlockByNumber(std::string_view _groupID, std::string_vi
                 {
                     toJsonResp(jResp, *_block, _onlyTxHash);
                 }
+                // the block with the number has been committed and never changes
+                if (cache && _block && _block->blockHeader() &&
+                    _block->blockHeader()->number() == _blockNumber)
+                {
+                    cache->putBlock(m_groupID, _blockNumber, format, jResp);
+                }
             }
             m_respFunc(_error, jResp);
         });
 }
 
+void JsonRpcImpl_2_0::setBlockResponseCache(
+    BlockResponseCache::Ptr _blockResponseCache, bool _prefill)
+{
+    m_blockResponseCache = std::move(_blockResponseCache);
+    if (_prefill && m_blockResponseCache && m_blockResponseCache->capacity() > 0)
+    {
+        m_prefillWorker = std::make_shared<bcos::ThreadPool>("blockPrefill", 1);
+    }
+}
+
+void JsonRpcImpl_2_0::prefillBlockResponse(
+    std::string_view _groupID, std::string_view _nodeName, protocol::BlockNumber _blockNumber)
+{
+    if (!m_prefillWorker)
+    {
+        return;
+    }
+    // the local ledger is read synchronously, never block the notifier of the committed block
+    m_prefillWorker->enqueue([self = weakSelf(), groupID = std::string(_groupID),
+                                 nodeName = std::string(_nodeName), _blockNumber]() {
+        auto rpc = self.lock();
+        if (!rpc)
+        {
+            return;
+        }
+        // the SDKs poll the new blocks with the header or the tx hashes
+        try
+        {
+            rpc->getBlockByNumber(groupID, nodeName, _blockNumber, true, false,
+                [](bcos::Error::Ptr, Json::Value&) {});
+            rpc->getBlockByNumber(groupID, nodeName, _blockNumber, false, true,
+                [](bcos::Error::Ptr, Json::Value&) {});
+        }
+        catch (std::exception const& e)
+        {
+            RPC_IMPL_LOG(WARNING) << LOG_DESC("prefillBlockResponse failed")
+                                  << LOG_KV("group", groupID) << LOG_KV("node", nodeName)
+                                  << LOG_KV("blockNumber", _blockNumber)
+                                  << LOG_KV("message", boost::diagnostic_information(e));
+        }
+    });
+}
+
 void JsonRpcImpl_2_0::getBlockHashByNumber(
     std::string_view _groupID, std::string_view _nodeName, int64_t _blockNumber, RespFunc _respFunc)
 {
@@ -1236,7 +1317,7 @@ void JsonRpcImpl_2_0::getTotalTransactionCount(
 void JsonRpcImpl_2_0::getPeers(RespFunc _respFunc)
 {
     RPC_IMPL_LOG(TRACE) << LOG_DESC("getPeers");
-    auto self = std::weak_ptr<JsonRpcImpl_2_0>(shared_from_this());
+    auto self = weakSelf();
     m_gatewayInterface->asyncGetPeers([m_respFunc = std::move(_respFunc), self](Error::Ptr _error,
                                           bcos::gateway::GatewayInfo::Ptr _localP2pInfo,
                                           bcos::gateway::GatewayInfosPtr _peersInfo) {
@@ -1438,7 +1519,7 @@ void JsonRpcImpl_2_0::getGroupPeers(Json::Value& _response, std::string_view _gr
 
 void JsonRpcImpl_2_0::getGroupPeers(std::string_view _groupID, RespFunc _respFunc)
 {
-    auto self = std::weak_ptr<JsonRpcImpl_2_0>(shared_from_this());
+    auto self = weakSelf();
     m_gatewayInterface->asyncGetPeers(
         [_respFunc, group = std::string(_groupID), self](Error::Ptr _error,
             bcos::gateway::GatewayInfo::Ptr _localP2pInfo,
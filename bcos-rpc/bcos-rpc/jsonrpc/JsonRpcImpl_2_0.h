@@ -25,14 +25,15 @@
 #include "bcos-boostssl/websocket/WsService.h"
 #include "bcos-framework/gateway/GatewayInterface.h"
 #include "bcos-rpc/filter/FilterSystem.h"
+#include "bcos-rpc/jsonrpc/BlockResponseCache.h"
 #include "bcos-rpc/jsonrpc/JsonRpcInterface.h"
+#include <bcos-utilities/ThreadPool.h>
 #include <json/json.h>
 #include <boost/core/ignore_unused.hpp>
 
 namespace bcos::rpc
 {
-class JsonRpcImpl_2_0 : public JsonRpcInterface,
-                        public std::enable_shared_from_this<JsonRpcImpl_2_0>
+class JsonRpcImpl_2_0 : public JsonRpcInterface
 {
 public:
     using Ptr = std::shared_ptr<JsonRpcImpl_2_0>;
@@ -139,7 +140,19 @@ public:
     int sendTxTimeout() const { return m_sendTxTimeout; }
     void setSendTxTimeout(int _sendTxTimeout) { m_sendTxTimeout = _sendTxTimeout; }
 
+    // _prefill: build the responses of every new committed block in the background
+    void setBlockResponseCache(BlockResponseCache::Ptr _blockResponseCache, bool _prefill);
+    BlockResponseCache::Ptr blockResponseCache() const { return m_blockResponseCache; }
+    // called on the new committed block, nothing is done if the prefill is disabled
+    void prefillBlockResponse(std::string_view _groupID, std::string_view _nodeName,
+        protocol::BlockNumber _blockNumber);
+
 protected:
+    std::weak_ptr<JsonRpcImpl_2_0> weakSelf()
+    {
+        return std::static_pointer_cast<JsonRpcImpl_2_0>(shared_from_this());
+    }
+
     static bcos::bytes decodeData(std::string_view _data);
 
     static void parseRpcResponseJson(std::string_view _responseBody, JsonResponse& _jsonResponse);
@@ -184,6 +197,9 @@ protected:
     bcos::gateway::GatewayInterface::Ptr m_gatewayInterface;
     std::shared_ptr<boostssl::ws::WsService> m_wsService;
     FilterSystem::Ptr m_filterSystem;
+    // nullptr if the block responses are not cached
+    BlockResponseCache::Ptr m_blockResponseCache;
+    std::shared_ptr<bcos::ThreadPool> m_prefillWorker;
 
     NodeInfo m_nodeInfo;
     // Note: here clientID must non-empty for the rpc will set clientID as source for the tx for
@@ -1,10 +1,6 @@
 #include "JsonRpcInterface.h"
+#include "bcos-rpc/jsonrpc/JsonCodec.h"
 #include <json/forwards.h>
-#include <boost/beast/core/ostream.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/device/back_inserter.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-#include <boost/iostreams/stream.hpp>
 
 using namespace bcos::rpc;
 
@@ -120,12 +116,38 @@ void JsonRpcInterface::initMethod()
 }
 
 void JsonRpcInterface::onRPCRequest(std::string_view _requestBody, Sender _sender)
+{
+    Json::Value root;
+    if (parseJson(_requestBody, root) && root.isArray())
+    {
+        // handle batch request, https://www.jsonrpc.org/specification#batch
+        handleBatchRequest(std::move(root), std::move(_sender));
+        return;
+    }
+    if (c_fileLogLevel == TRACE) [[unlikely]]
+    {
+        RPC_IMPL_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody);
+    }
+    handleRequest(root, [_sender](JsonResponse _response) {
+        auto strResp = toStringResponse(std::move(_response));
+        if (c_fileLogLevel == TRACE) [[unlikely]]
+        {
+            RPC_IMPL_LOG(TRACE) << LOG_BADGE("onRPCRequest")
+                                << LOG_KV("response", std::string_view((const char*)strResp.data(),
+                                                          strResp.size()));
+        }
+        _sender(std::move(strResp));
+    });
+}
+
+void JsonRpcInterface::handleRequest(
+    Json::Value const& _root, std::function<void(JsonResponse)> _callback)
 {
     JsonRequest request;
     JsonResponse response;
     try
     {
-        parseRpcRequestJson(_requestBody, request);
+        parseRpcRequestJson(_root, request);
 
         response.jsonrpc = request.jsonrpc;
         response.id = request.id;
@@ -137,12 +159,8 @@ void JsonRpcInterface::onRPCRequest(std::string_view _requestBody, Sender _sende
             BOOST_THROW_EXCEPTION(JsonRpcException(
                 JsonRpcError::MethodNotFound, "The method does not exist/is not available."));
         }
-        if (c_fileLogLevel == TRACE) [[unlikely]]
-        {
-            RPC_IMPL_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody);
-        }
-        it->second(
-            request.params, [response, _sender](Error::Ptr _error, Json::Value& _result) mutable {
+        it->second(request.params,
+            [response, _callback](Error::Ptr _error, Json::Value& _result) mutable {
                 if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
                 {
                     // error
@@ -153,15 +171,7 @@ void JsonRpcInterface::onRPCRequest(std::string_view _requestBody, Sender _sende
                 {
                     response.result.swap(_result);
                 }
-                auto strResp = toStringResponse(std::move(response));
-                if (c_fileLogLevel == TRACE) [[unlikely]]
-                {
-                    RPC_IMPL_LOG(TRACE)
-                        << LOG_BADGE("onRPCRequest")
-                        << LOG_KV("response",
-                               std::string_view((const char*)strResp.data(), strResp.size()));
-                }
-                _sender(std::move(strResp));
+                _callback(std::move(response));
             });
 
         // success response
@@ -180,25 +190,82 @@ void JsonRpcInterface::onRPCRequest(std::string_view _requestBody, Sender _sende
     }
     catch (...)
     {
-        RPC_IMPL_LOG(DEBUG) << LOG_BADGE("onRPCRequest")
+        RPC_IMPL_LOG(DEBUG) << LOG_BADGE("handleRequest")
                             << LOG_DESC("response with unknown exception");
         response.error.code = JsonRpcError::InternalError;
         response.error.message = boost::current_exception_diagnostic_information();
     }
 
-    auto strResp = toStringResponse(response);
+    RPC_IMPL_LOG(DEBUG) << LOG_BADGE("handleRequest") << LOG_DESC("response with exception")
+                        << LOG_KV("method", request.method) << LOG_KV("code", response.error.code)
+                        << LOG_KV("message", response.error.message);
+    _callback(std::move(response));
+}
+
+void JsonRpcInterface::handleBatchRequest(Json::Value _requests, Sender _sender)
+{
+    if (_requests.empty() || _requests.size() > m_batchRequestSizeLimit)
+    {
+        JsonResponse response;
+        response.jsonrpc = "2.0";
+        response.id = 0;
+        response.error.code = JsonRpcError::InvalidRequest;
+        response.error.message =
+            _requests.empty() ? "The request array is empty" :
+                                "The requested array size exceeds the limit size: " +
+                                    std::to_string(m_batchRequestSizeLimit);
+        _sender(toStringResponse(std::move(response)));
+        return;
+    }
 
-    RPC_IMPL_LOG(DEBUG) << LOG_BADGE("onRPCRequest") << LOG_DESC("response with exception")
-                        << LOG_KV("request", _requestBody)
-                        << LOG_KV("response",
-                               std::string_view((const char*)strResp.data(), strResp.size()));
-    _sender(std::move(strResp));
+    auto startT = utcTime();
+    auto requestSize = _requests.size();
+    // the elements are handled concurrently, the responses keep the order of the requests
+    m_batchRequestExecutor->execute(
+        std::move(_requests),
+        [self = weak_from_this()](
+            Json::Value _item, BatchRequestExecutor::ResponseCallback _callback) {
+            auto rpc = self.lock();
+            if (!rpc)
+            {
+                JsonResponse response;
+                response.jsonrpc = "2.0";
+                response.id = _item.isObject() && _item.isMember("id") ? _item["id"].asInt64() : 0;
+                response.error.code = JsonRpcError::InternalError;
+                response.error.message = "The rpc service has been stopped";
+                _callback(toJsonResponse(std::move(response)));
+                return;
+            }
+            rpc->handleRequest(_item, [callback = std::move(_callback)](JsonResponse _response) {
+                callback(toJsonResponse(std::move(_response)));
+            });
+        },
+        [_sender, startT, requestSize](Json::Value _responses) {
+            auto strResp = toStringResponse(_responses);
+            RPC_IMPL_LOG(DEBUG) << LOG_BADGE("handleBatchRequest")
+                                << LOG_KV("reqSize", requestSize)
+                                << LOG_KV("respSize", strResp.size())
+                                << LOG_KV("costMs", utcTime() - startT);
+            _sender(std::move(strResp));
+        });
 }
 
 void bcos::rpc::parseRpcRequestJson(std::string_view _requestBody, JsonRequest& _jsonRequest)
 {
     Json::Value root;
-    Json::Reader jsonReader;
+    if (!parseJson(_requestBody, root))
+    {
+        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson")
+                            << LOG_KV("request", _requestBody)
+                            << LOG_KV("message", "invalid request json object");
+        BOOST_THROW_EXCEPTION(JsonRpcException(
+            JsonRpcError::InvalidRequest, "The JSON sent is not a valid Request object."));
+    }
+    parseRpcRequestJson(root, _jsonRequest);
+}
+
+void bcos::rpc::parseRpcRequestJson(Json::Value const& root, JsonRequest& _jsonRequest)
+{
     std::string errorMessage;
 
     try
@@ -208,7 +275,7 @@ void bcos::rpc::parseRpcRequestJson(std::string_view _requestBody, JsonRequest&
         int64_t id = 0;
         do
         {
-            if (!jsonReader.parse(_requestBody.begin(), _requestBody.end(), root))
+            if (!root.isObject())
             {
                 errorMessage = "invalid request json object";
                 break;
@@ -261,13 +328,15 @@ void bcos::rpc::parseRpcRequestJson(std::string_view _requestBody, JsonRequest&
     }
     catch (const std::exception& e)
     {
-        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody)
+        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson")
+                            << LOG_KV("request", root.toStyledString())
                             << LOG_KV("message", boost::diagnostic_information(e));
         BOOST_THROW_EXCEPTION(
             JsonRpcException(JsonRpcError::ParseError, "Invalid JSON was received by the server."));
     }
 
-    RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody)
+    RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson")
+                        << LOG_KV("request", root.toStyledString())
                         << LOG_KV("message", errorMessage);
 
     BOOST_THROW_EXCEPTION(JsonRpcException(
@@ -277,34 +346,12 @@ void bcos::rpc::parseRpcRequestJson(std::string_view _requestBody, JsonRequest&
 
 bcos::bytes bcos::rpc::toStringResponse(JsonResponse _jsonResponse)
 {
-    auto jResp = toJsonResponse(std::move(_jsonResponse));
-    auto builder = Json::StreamWriterBuilder();
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-    class JsonSink
-    {
-    public:
-        using char_type = char;
-        using category = boost::iostreams::sink_tag;
-
-        JsonSink(bcos::bytes& buffer) : m_buffer(buffer) {}
-
-        std::streamsize write(const char* s, std::streamsize n)
-        {
-            m_buffer.insert(m_buffer.end(), (bcos::byte*)s, (bcos::byte*)s + n);
-            return n;
-        }
-
-        bcos::bytes& m_buffer;
-    };
-
-    bcos::bytes out;
-    boost::iostreams::stream<JsonSink> outputStream(out);
+    return toStringResponse(toJsonResponse(std::move(_jsonResponse)));
+}
 
-    writer->write(jResp, &outputStream);
-    writer.reset();
-    return out;
+bcos::bytes bcos::rpc::toStringResponse(Json::Value const& _response)
+{
+    return encodeJson(_response);
 }
 
 Json::Value bcos::rpc::toJsonResponse(JsonResponse _jsonResponse)
@@ -23,11 +23,13 @@
 
 #include <bcos-framework/multigroup/GroupInfo.h>
 #include <bcos-framework/protocol/CommonError.h>
+#include <bcos-rpc/jsonrpc/BatchRequestExecutor.h>
 #include <bcos-rpc/jsonrpc/Common.h>
 #include <bcos-utilities/Error.h>
 #include <json/json.h>
 #include <util/tc_json.h>
 #include <functional>
+#include <memory>
 
 namespace bcos::rpc
 {
@@ -36,7 +38,7 @@ using Sender = std::function<void(bcos::bytes)>;
 using RespFunc = std::function<void(bcos::Error::Ptr, Json::Value&)>;
 using MethodMap = std::unordered_map<std::string, std::function<void(Json::Value&, RespFunc)>>;
 
-class JsonRpcInterface
+class JsonRpcInterface : public std::enable_shared_from_this<JsonRpcInterface>
 {
 public:
     using Ptr = std::shared_ptr<JsonRpcInterface>;
@@ -136,10 +138,21 @@ public:
 
     void onRPCRequest(std::string_view _requestBody, Sender _sender);
 
+    constexpr static uint32_t DEFAULT_BATCH_REQUEST_SIZE_LIMIT = 8;
+    void setBatchRequestConfig(uint32_t _sizeLimit, uint32_t _concurrency)
+    {
+        m_batchRequestSizeLimit = _sizeLimit;
+        m_batchRequestExecutor = std::make_shared<BatchRequestExecutor>(_concurrency);
+    }
+
 protected:
     void initMethod();
+    void handleRequest(Json::Value const& _root, std::function<void(JsonResponse)> _callback);
+    void handleBatchRequest(Json::Value _requests, Sender _sender);
 
     MethodMap m_methodToFunc;
+    uint32_t m_batchRequestSizeLimit = DEFAULT_BATCH_REQUEST_SIZE_LIMIT;
+    BatchRequestExecutor::Ptr m_batchRequestExecutor = std::make_shared<BatchRequestExecutor>();
 
 
     std::string_view toView(const Json::Value& value)
@@ -332,7 +345,9 @@ protected:
     }
 };
 void parseRpcRequestJson(std::string_view _requestBody, JsonRequest& _jsonRequest);
+void parseRpcRequestJson(Json::Value const& _root, JsonRequest& _jsonRequest);
 bcos::bytes toStringResponse(JsonResponse _jsonResponse);
+bcos::bytes toStringResponse(Json::Value const& _response);
 Json::Value toJsonResponse(JsonResponse _jsonResponse);
 
 
@@ -19,6 +19,7 @@
  */
 
 #include "Web3JsonRpcImpl.h"
+#include "bcos-rpc/jsonrpc/JsonCodec.h"
 #include "bcos-rpc/validator/JsonValidator.h"
 #include "bcos-task/Wait.h"
 #include "utils/util.h"
@@ -27,7 +28,7 @@ using namespace bcos;
 using namespace bcos::rpc;
 
 bcos::rpc::Web3JsonRpcImpl::Web3JsonRpcImpl(std::string _groupId, uint32_t _batchRequestSizeLimit,
-    bcos::rpc::GroupManager::Ptr _groupManager,
+    uint32_t _batchRequestConcurrency, bcos::rpc::GroupManager::Ptr _groupManager,
     bcos::gateway::GatewayInterface::Ptr _gatewayInterface,
     std::shared_ptr<boostssl::ws::WsService> _wsService, FilterSystem::Ptr filterSystem,
     bool syncTransaction)
@@ -36,6 +37,7 @@ bcos::rpc::Web3JsonRpcImpl::Web3JsonRpcImpl(std::string _groupId, uint32_t _batc
     m_wsService(std::move(_wsService)),
     m_groupId(std::move(_groupId)),
     m_batchRequestSizeLimit(_batchRequestSizeLimit),
+    m_batchRequestExecutor(std::make_shared<BatchRequestExecutor>(_batchRequestConcurrency)),
     m_endpoints(
         m_groupManager->getNodeService(m_groupId, ""), std::move(filterSystem), syncTransaction)
 {
@@ -144,38 +146,43 @@ void Web3JsonRpcImpl::handleRequest(
 void Web3JsonRpcImpl::handleBatchRequest(
     Json::Value _request, std::shared_ptr<boostssl::ws::WsSession> _session, const Sender& _sender)
 {
-    auto respJsonValuePtr = std::make_shared<Json::Value>(Json::arrayValue);
     auto requestSize = _request.size();
 
     auto startT = utcTime();
     if (c_fileLogLevel == TRACE) [[unlikely]]
     {
         WEB3_LOG(TRACE) << LOG_BADGE("handleBatchRequest") << LOG_DESC("begin")
-                        << LOG_KV("reqSize", requestSize);
+                        << LOG_KV("reqSize", requestSize)
+                        << LOG_KV("concurrency", m_batchRequestExecutor->concurrency());
     }
 
-    for (auto& reqItem : _request)
-    {
-        handleRequest(std::move(reqItem), _session,
-            [respJsonValuePtr, requestSize, _sender, startT](Json::Value response) {
-                respJsonValuePtr->append(std::move(response));
-                if (respJsonValuePtr->size() < requestSize)
-                {
-                    return;
-                }
-
-                auto respBytes = toBytesResponse(*respJsonValuePtr);
-                _sender(std::move(respBytes));
+    // the elements are handled concurrently, the responses keep the order of the requests
+    m_batchRequestExecutor->execute(
+        std::move(_request),
+        [self = weak_from_this(), _session](
+            Json::Value _item, BatchRequestExecutor::ResponseCallback _callback) {
+            auto rpc = self.lock();
+            if (!rpc)
+            {
+                Json::Value response;
+                buildJsonError(_item, InternalError, "The rpc service has been stopped", response);
+                _callback(std::move(response));
+                return;
+            }
+            rpc->handleRequest(std::move(_item), _session, _callback);
+        },
+        [_sender, startT](Json::Value _responses) {
+            auto respBytes = toBytesResponse(_responses);
+            _sender(std::move(respBytes));
 
-                auto endT = utcTime();
-                if (c_fileLogLevel == TRACE) [[unlikely]]
-                {
-                    WEB3_LOG(TRACE) << LOG_BADGE("handleBatchRequest") << LOG_DESC("end")
-                                    << LOG_KV("costMs", endT - startT)
-                                    << LOG_KV("response", printJson(*respJsonValuePtr));
-                }
-            });
-    }
+            auto endT = utcTime();
+            if (c_fileLogLevel == TRACE) [[unlikely]]
+            {
+                WEB3_LOG(TRACE) << LOG_BADGE("handleBatchRequest") << LOG_DESC("end")
+                                << LOG_KV("costMs", endT - startT)
+                                << LOG_KV("response", printJson(_responses));
+            }
+        });
 }
 
 void Web3JsonRpcImpl::handleSubscribeRequest(Json::Value _request, std::string _method,
@@ -236,8 +243,7 @@ void Web3JsonRpcImpl::onRPCRequest(std::string_view _requestBody,
         }
 
         // parse json
-        if (Json::Reader jsonReader;
-            !jsonReader.parse(_requestBody.begin(), _requestBody.end(), request))
+        if (!parseJson(_requestBody, request))
         {
             BOOST_THROW_EXCEPTION(JsonRpcException(InvalidRequest, "Parse json failed"));
         }
@@ -22,6 +22,7 @@
 #include "bcos-boostssl/websocket/WsService.h"
 #include "bcos-framework/gateway/GatewayInterface.h"
 #include "bcos-rpc/groupmgr/GroupManager.h"
+#include "bcos-rpc/jsonrpc/BatchRequestExecutor.h"
 #include "bcos-rpc/web3jsonrpc/Web3Subscribe.h"
 #include "bcos-rpc/web3jsonrpc/endpoints/Endpoints.h"
 #include "bcos-rpc/web3jsonrpc/endpoints/EndpointsMapping.h"
@@ -35,7 +36,7 @@ public:
     using WeakPtr = std::weak_ptr<Web3JsonRpcImpl>;
     using Sender = std::function<void(bcos::bytes)>;
     Web3JsonRpcImpl(std::string _groupId, uint32_t _batchRequestSizeLimit,
-        bcos::rpc::GroupManager::Ptr _groupManager,
+        uint32_t _batchRequestConcurrency, bcos::rpc::GroupManager::Ptr _groupManager,
         bcos::gateway::GatewayInterface::Ptr _gatewayInterface,
         std::shared_ptr<boostssl::ws::WsService> _wsService, FilterSystem::Ptr filterSystem,
         bool syncTransaction);
@@ -73,6 +74,7 @@ private:
     Web3Subscribe::Ptr m_web3Subscribe;
     std::string m_groupId;
     uint32_t m_batchRequestSizeLimit;
+    BatchRequestExecutor::Ptr m_batchRequestExecutor;
     Endpoints m_endpoints;
     EndpointsMapping m_endpointsMapping;
 };
@@ -436,8 +436,7 @@ task::Task<void> EthEndpoint::sendRawTransaction(const Json::Value& request, Jso
     }
     auto encodeTxHash = web3Tx.txHash();
 
-    auto tx = std::make_shared<bcostars::protocol::TransactionImpl>(
-        [m_tx = web3Tx.takeToTarsTransaction()]() mutable { return &m_tx; });
+    auto tx = bcostars::protocol::TransactionImpl::create(web3Tx.takeToTarsTransaction());
     // check transaction validator
     auto const checkStatus =
         co_await bcos::rpc::TxValidator::checkSenderBalance(*tx, m_nodeService->scheduler());
@@ -620,10 +619,7 @@ task::Task<void> EthEndpoint::getBlockByHash(const Json::Value& request, Json::V
     {
         auto const number = co_await ledger::getBlockNumber(
             *ledger, crypto::HashType(blockHash, crypto::HashType::FromHex));
-        auto flag = bcos::ledger::HEADER | bcos::ledger::RECEIPTS;
-        flag |= fullTransaction ? bcos::ledger::TRANSACTIONS : bcos::ledger::TRANSACTIONS_HASH;
-        auto block = co_await ledger::getBlockData(*ledger, number, flag);
-        combineBlockResponse(result, *block, fullTransaction);
+        result = co_await getBlockResult(number, fullTransaction);
     }
     catch (std::exception const& e)
     {
@@ -643,11 +639,7 @@ task::Task<void> EthEndpoint::getBlockByNumber(const Json::Value& request, Json:
     try
     {
         auto [blockNumber, _] = co_await getBlockNumberByTag(blockTag);
-        auto const ledger = m_nodeService->ledger();
-        auto flag = bcos::ledger::HEADER | bcos::ledger::RECEIPTS;
-        flag |= fullTransaction ? bcos::ledger::TRANSACTIONS : bcos::ledger::TRANSACTIONS_HASH;
-        auto block = co_await ledger::getBlockData(*ledger, blockNumber, flag);
-        combineBlockResponse(result, *block, fullTransaction);
+        result = co_await getBlockResult(blockNumber, fullTransaction);
     }
     catch (std::exception const& e)
     {
@@ -657,6 +649,31 @@ task::Task<void> EthEndpoint::getBlockByNumber(const Json::Value& request, Json:
     buildJsonContent(result, response);
     co_return;
 }
+task::Task<Json::Value> EthEndpoint::getBlockResult(
+    protocol::BlockNumber number, bool fullTransaction)
+{
+    // only one group is served by the web3 rpc
+    auto const format =
+        fullTransaction ? BlockResponseFormat::Web3FullTxs : BlockResponseFormat::Web3TxHashes;
+    if (m_blockResponseCache)
+    {
+        if (auto cached = m_blockResponseCache->getBlock({}, number, format))
+        {
+            co_return *cached;
+        }
+    }
+    auto const ledger = m_nodeService->ledger();
+    auto flag = bcos::ledger::HEADER | bcos::ledger::RECEIPTS;
+    flag |= fullTransaction ? bcos::ledger::TRANSACTIONS : bcos::ledger::TRANSACTIONS_HASH;
+    auto block = co_await ledger::getBlockData(*ledger, number, flag);
+    Json::Value result = Json::objectValue;
+    combineBlockResponse(result, *block, fullTransaction);
+    if (m_blockResponseCache && block->blockHeader()->number() == number)
+    {
+        m_blockResponseCache->putBlock({}, number, format, result);
+    }
+    co_return result;
+}
 task::Task<void> EthEndpoint::getTransactionByHash(
     const Json::Value& request, Json::Value& response)
 {
@@ -768,6 +785,15 @@ task::Task<void> EthEndpoint::getTransactionReceipt(
     // result: transactionReceipt(RECEIPT)
     auto const hashStr = toView(request[0U]);
     auto const hash = crypto::HashType(hashStr, crypto::HashType::FromHex);
+    if (m_blockResponseCache)
+    {
+        if (auto cached = m_blockResponseCache->getReceipt({}, hash))
+        {
+            Json::Value result = *cached;
+            buildJsonContent(result, response);
+            co_return;
+        }
+    }
     auto const ledger = m_nodeService->ledger();
     Json::Value result = Json::objectValue;
     try
@@ -783,6 +809,10 @@ task::Task<void> EthEndpoint::getTransactionReceipt(
         }
         auto blockHash = co_await ledger::getBlockHash(*ledger, receipt->blockNumber());
         combineReceiptResponse(result, *receipt, *txs->at(0), blockHash);
+        if (m_blockResponseCache)
+        {
+            m_blockResponseCache->putReceipt({}, hash, result);
+        }
     }
     catch (std::exception const& e)
     {
@@ -21,6 +21,7 @@
 #pragma once
 #include <bcos-framework/ledger/Ledger.h>
 #include <bcos-rpc/groupmgr/GroupManager.h>
+#include <bcos-rpc/jsonrpc/BlockResponseCache.h>
 #include <bcos-rpc/jsonrpc/JsonRpcInterface.h>
 #include <bcos-rpc/web3jsonrpc/Web3FilterSystem.h>
 #include <json/json.h>
@@ -37,6 +38,12 @@ public:
     EthEndpoint(NodeService::Ptr nodeService, FilterSystem::Ptr filterSystem, bool syncTransaction);
     virtual ~EthEndpoint() = default;
 
+    // nullptr disables the cache of the block and receipt responses
+    void setBlockResponseCache(BlockResponseCache::Ptr _blockResponseCache)
+    {
+        m_blockResponseCache = std::move(_blockResponseCache);
+    }
+
     task::Task<void> protocolVersion(const Json::Value&, Json::Value&);
     task::Task<void> syncing(const Json::Value&, Json::Value&);
     task::Task<void> coinbase(const Json::Value&, Json::Value&);
@@ -83,7 +90,10 @@ private:
     NodeService::Ptr m_nodeService;
     FilterSystem::Ptr m_filterSystem;
     bool m_syncTransaction;
+    BlockResponseCache::Ptr m_blockResponseCache;
 
+    // the block result of eth_getBlockByHash and eth_getBlockByNumber
+    task::Task<Json::Value> getBlockResult(protocol::BlockNumber number, bool fullTransaction);
     task::Task<void> call(const Json::Value&, Json::Value&, u256* gasUsed, bool isEstimate);
 };
 
@@ -19,6 +19,7 @@
  */
 
 #include "util.h"
+#include "bcos-rpc/jsonrpc/JsonCodec.h"
 
 using namespace bcos::rpc;
 
@@ -55,15 +56,5 @@ void bcos::rpc::buildJsonErrorWithData(
 
 bcos::bytes bcos::rpc::toBytesResponse(Json::Value const& jResp)
 {
-    auto builder = Json::StreamWriterBuilder();
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-
-    bcos::bytes out;
-    boost::iostreams::stream<JsonSink> outputStream(out);
-
-    writer->write(jResp, &outputStream);
-    writer.reset();
-    return out;
+    return encodeJson(jResp);
 }
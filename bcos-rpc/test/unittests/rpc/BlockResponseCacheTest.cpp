@@ -0,0 +1,109 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file BlockResponseCacheTest.cpp
+ * @date 2026-10-19
+ */
+
+#include <bcos-rpc/jsonrpc/BlockResponseCache.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace bcos::test
+{
+BOOST_FIXTURE_TEST_SUITE(testBlockResponseCache, TestPromptFixture)
+
+BOOST_AUTO_TEST_CASE(lruBlockResponses)
+{
+    BlockResponseCache cache(2);
+    Json::Value block;
+    block["number"] = 1;
+    cache.putBlock("group0", 1, BlockResponseFormat::TxHashes, block);
+    block["number"] = 2;
+    cache.putBlock("group0", 2, BlockResponseFormat::TxHashes, block);
+
+    // every format and group is cached separately
+    BOOST_CHECK(!cache.getBlock("group0", 1, BlockResponseFormat::FullTxs));
+    BOOST_CHECK(!cache.getBlock("group1", 1, BlockResponseFormat::TxHashes));
+    auto response = cache.getBlock("group0", 1, BlockResponseFormat::TxHashes);
+    BOOST_REQUIRE(response);
+    BOOST_CHECK_EQUAL((*response)["number"].asInt(), 1);
+
+    // block 2 is the least recently used one
+    block["number"] = 3;
+    cache.putBlock("group0", 3, BlockResponseFormat::TxHashes, block);
+    BOOST_CHECK(!cache.getBlock("group0", 2, BlockResponseFormat::TxHashes));
+    BOOST_CHECK(cache.getBlock("group0", 1, BlockResponseFormat::TxHashes));
+    BOOST_CHECK(cache.getBlock("group0", 3, BlockResponseFormat::TxHashes));
+
+    auto txHash = crypto::HashType::generateRandomFixedBytes();
+    Json::Value receipt;
+    receipt["status"] = 0;
+    cache.putReceipt("group0", txHash, receipt);
+    BOOST_REQUIRE(cache.getReceipt("group0", txHash));
+    BOOST_CHECK(!cache.getReceipt("group1", txHash));
+
+    cache.clear();
+    BOOST_CHECK(!cache.getBlock("group0", 1, BlockResponseFormat::TxHashes));
+    BOOST_CHECK(!cache.getReceipt("group0", txHash));
+}
+
+BOOST_AUTO_TEST_CASE(boundedByBytes)
+{
+    Json::Value block;
+    block["transactions"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < 100; ++i)
+    {
+        block["transactions"].append(std::string(1000, 'f'));
+    }
+    auto blockBytes = BlockResponseCache::approximateBytes(block);
+    BOOST_CHECK_GT(blockBytes, 100000U);
+
+    // only three blocks fit in the bytes though the capacity is larger
+    BlockResponseCache cache(16, blockBytes * 3 + blockBytes / 2);
+    for (protocol::BlockNumber number = 1; number <= 4; ++number)
+    {
+        cache.putBlock("group0", number, BlockResponseFormat::FullTxs, block);
+    }
+    BOOST_CHECK(!cache.getBlock("group0", 1, BlockResponseFormat::FullTxs));
+    BOOST_CHECK(cache.getBlock("group0", 2, BlockResponseFormat::FullTxs));
+    BOOST_CHECK(cache.getBlock("group0", 4, BlockResponseFormat::FullTxs));
+    BOOST_CHECK_EQUAL(cache.bytes(), blockBytes * 3);
+
+    // replacing an entry does not count it twice
+    cache.putBlock("group0", 4, BlockResponseFormat::FullTxs, block);
+    BOOST_CHECK_EQUAL(cache.bytes(), blockBytes * 3);
+
+    // a response taking most of the bytes is never cached
+    BlockResponseCache smallCache(16, blockBytes);
+    smallCache.putBlock("group0", 1, BlockResponseFormat::FullTxs, block);
+    BOOST_CHECK(!smallCache.getBlock("group0", 1, BlockResponseFormat::FullTxs));
+    BOOST_CHECK_EQUAL(smallCache.bytes(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(disabledCache)
+{
+    BlockResponseCache cache(0);
+    cache.putBlock("group0", 1, BlockResponseFormat::Header, Json::Value(1));
+    cache.putReceipt("group0", crypto::HashType(), Json::Value(1));
+    BOOST_CHECK(!cache.getBlock("group0", 1, BlockResponseFormat::Header));
+    BOOST_CHECK(!cache.getReceipt("group0", crypto::HashType()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -0,0 +1,66 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file JsonCodecTest.cpp
+ * @date 2026-10-19
+ */
+
+#include <bcos-rpc/jsonrpc/JsonCodec.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace bcos::test
+{
+BOOST_FIXTURE_TEST_SUITE(testJsonCodec, TestPromptFixture)
+
+BOOST_AUTO_TEST_CASE(writeJsonSameAsStreamWriter)
+{
+    Json::Value value;
+    value["jsonrpc"] = "2.0";
+    value["id"] = Json::Int64(-1655516568316917);
+    value["uid"] = Json::UInt64(18446744073709551615ULL);
+    value["real"] = 1.5;
+    value["integral"] = 3.0;
+    value["bool"] = true;
+    value["null"] = Json::Value::null;
+    value["empty"] = Json::Value(Json::objectValue);
+    value["escape"] =
+        "quote\" backslash\\ newline\n tab\t ctrl\x01 utf8 \xe4\xbd\xa0 \xf0\x9f\x98\x80";
+    Json::Value array(Json::arrayValue);
+    array.append("0x1234");
+    array.append(Json::Value(Json::arrayValue));
+    array.append(value["escape"]);
+    value["result"] = array;
+
+    Json::StreamWriterBuilder builder;
+    builder["commentStyle"] = "None";
+    builder["indentation"] = "";
+    auto expected = Json::writeString(builder, value);
+
+    auto encoded = encodeJson(value);
+    BOOST_CHECK_EQUAL(std::string(encoded.begin(), encoded.end()), expected);
+
+    Json::Value decoded;
+    BOOST_REQUIRE(
+        parseJson(std::string_view((const char*)encoded.data(), encoded.size()), decoded));
+    BOOST_CHECK(decoded == value);
+    BOOST_CHECK(!parseJson(R"({"jsonrpc":"2.0",)", decoded));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
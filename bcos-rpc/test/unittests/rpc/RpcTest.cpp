@@ -37,6 +37,7 @@
 #include <bcos-rpc/validator/CallValidator.h>
 #include <bcos-utilities/Exceptions.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <future>
 
 using namespace bcos;
 using namespace bcos::rpc;
@@ -71,5 +72,90 @@ BOOST_AUTO_TEST_CASE(jsonRpcTest)
         BOOST_CHECK(intValue > 0);
     });
 }
+
+BOOST_AUTO_TEST_CASE(batchRequestTest)
+{
+    auto rpc = factory->buildLocalRpc(groupInfo, nodeService);
+    rpc->groupManager()->updateGroupInfo(groupInfo);
+    auto jsonRpc = rpc->jsonRpcImpl();
+    jsonRpc->setBatchRequestConfig(3, 2);
+    auto onRPCRequest = [&](std::string const& _request) {
+        std::promise<bcos::bytes> promise;
+        jsonRpc->onRPCRequest(
+            _request, [&promise](bcos::bytes _resp) { promise.set_value(std::move(_resp)); });
+        auto resp = promise.get_future().get();
+        Json::Value response;
+        Json::Reader reader;
+        BOOST_REQUIRE(reader.parse(std::string(resp.begin(), resp.end()), response));
+        return response;
+    };
+
+    // the responses keep the order of the requests though the elements are handled concurrently
+    auto request = R"([
+        {"jsonrpc":"2.0","id":1,"method":"getBlockNumber","params":[")" + groupId + R"(",""]},
+        {"jsonrpc":"2.0","id":2,"method":"notExist","params":[]},
+        {"jsonrpc":"2.0","id":3,"method":"getBlockNumber","params":[")" + groupId + R"(",""]}
+    ])";
+    auto response = onRPCRequest(request);
+    BOOST_REQUIRE(response.isArray());
+    BOOST_REQUIRE_EQUAL(response.size(), 3U);
+    for (Json::ArrayIndex i = 0; i < response.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(response[i]["id"].asInt64(), static_cast<int64_t>(i + 1));
+    }
+    BOOST_CHECK(response[0]["result"].asInt64() > 0);
+    BOOST_CHECK_EQUAL(response[1]["error"]["code"].asInt(), (int)JsonRpcError::MethodNotFound);
+    BOOST_CHECK(response[2]["result"].asInt64() > 0);
+
+    // the array over the size limit and the empty array are rejected as a whole
+    auto oversized = R"([
+        {"jsonrpc":"2.0","id":1,"method":"getBlockNumber","params":[")" + groupId + R"(",""]},
+        {"jsonrpc":"2.0","id":2,"method":"getBlockNumber","params":[")" + groupId + R"(",""]},
+        {"jsonrpc":"2.0","id":3,"method":"getBlockNumber","params":[")" + groupId + R"(",""]},
+        {"jsonrpc":"2.0","id":4,"method":"getBlockNumber","params":[")" + groupId + R"(",""]}
+    ])";
+    response = onRPCRequest(oversized);
+    BOOST_REQUIRE(response.isObject());
+    BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), (int)JsonRpcError::InvalidRequest);
+    response = onRPCRequest("[]");
+    BOOST_REQUIRE(response.isObject());
+    BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), (int)JsonRpcError::InvalidRequest);
+}
+
+BOOST_AUTO_TEST_CASE(blockResponseCacheTest)
+{
+    auto rpc = factory->buildLocalRpc(groupInfo, nodeService);
+    rpc->groupManager()->updateGroupInfo(groupInfo);
+    auto jsonRpc = rpc->jsonRpcImpl();
+    auto cache = std::make_shared<BlockResponseCache>(16);
+    jsonRpc->setBlockResponseCache(cache, false);
+
+    // the response of the committed block is cached
+    jsonRpc->getBlockByNumber(groupId, "", 5, false, true, [](auto&& error, Json::Value& value) {
+        BOOST_CHECK(!error);
+        BOOST_CHECK_EQUAL(value["number"].asInt64(), 5);
+    });
+    auto cached = cache->getBlock(groupId, 5, BlockResponseFormat::TxHashes);
+    BOOST_REQUIRE(cached);
+    BOOST_CHECK_EQUAL((*cached)["number"].asInt64(), 5);
+    BOOST_CHECK(!cache->getBlock(groupId, 5, BlockResponseFormat::Header));
+    BOOST_CHECK_GT(cache->bytes(), 0U);
+
+    // the cached response is returned without reading the ledger
+    Json::Value sentinel;
+    sentinel["cached"] = true;
+    cache->putBlock(groupId, 6, BlockResponseFormat::TxHashes, sentinel);
+    jsonRpc->getBlockByNumber(groupId, "", 6, false, true, [](auto&& error, Json::Value& value) {
+        BOOST_CHECK(!error);
+        BOOST_CHECK(value["cached"].asBool());
+    });
+
+    // the error of the unknown block is not cached
+    bool failed = false;
+    jsonRpc->getBlockByNumber(groupId, "", 1000, false, true,
+        [&failed](auto&& error, Json::Value&) { failed = error != nullptr; });
+    BOOST_CHECK(failed);
+    BOOST_CHECK(!cache->getBlock(groupId, 1000, BlockResponseFormat::TxHashes));
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace bcos::test
\ No newline at end of file
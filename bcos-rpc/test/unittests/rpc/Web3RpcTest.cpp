@@ -270,6 +270,28 @@ BOOST_AUTO_TEST_CASE(handleWeb3NamespaceValidTest)
     }
 }
 
+BOOST_AUTO_TEST_CASE(handleBatchRequestTest)
+{
+    // the responses keep the order of the requests though the elements are handled concurrently
+    const auto request = R"([
+        {"jsonrpc":"2.0","id":1,"method":"eth_chainId","params":[]},
+        {"jsonrpc":"2.0","id":2,"method":"web3_clientVersion","params":[]},
+        {"jsonrpc":"2.0","id":3,"method":"eth_notExist","params":[]},
+        {"jsonrpc":"2.0","id":4,"method":"eth_blockNumber","params":[]}
+    ])";
+    auto response = onRPCRequestWrapper(request);
+    BOOST_REQUIRE(response.isArray());
+    BOOST_REQUIRE_EQUAL(response.size(), 4U);
+    for (Json::ArrayIndex i = 0; i < response.size(); ++i)
+    {
+        BOOST_TEST(response[i]["id"].asInt64() == static_cast<int64_t>(i + 1));
+    }
+    validRespCheck(response[0]);
+    validRespCheck(response[1]);
+    BOOST_TEST(response[2].isMember("error"));
+    validRespCheck(response[3]);
+}
+
 BOOST_AUTO_TEST_CASE(handleLegacyTxTest)
 {
     // method eth_sendRawTransaction
@@ -11,6 +11,7 @@
 #include "bcos-table/src/StateStorage.h"
 #include "bcos-task/Wait.h"
 #include <bcos-framework/executor/ExecuteError.h>
+#include <bcos-utilities/DataConvertUtility.h>
 #include <bcos-utilities/Error.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for_each.h>
@@ -1049,6 +1050,16 @@ void BlockExecutive::onDmcExecuteFinish(
         DMC_LOG(INFO) << BLOCK_NUMBER(number()) << LOG_BADGE("BlockTrace")
                       << LOG_BADGE("DMCRecorder") << " DMCExecute for transaction finished "
                       << LOG_KV("checksum", dmcChecksum);
+
+        for (auto const& [contract, metrics] : m_keyLocks->contentionMetrics())
+        {
+            DMC_LOG(INFO) << METRIC << BLOCK_NUMBER(number()) << LOG_BADGE("KeyLockContention")
+                          << LOG_KV("contract", contract) << LOG_KV("acquired", metrics.acquired)
+                          << LOG_KV("waited", metrics.waited)
+                          << LOG_KV("deadLocks", metrics.deadLocks)
+                          << LOG_KV("hottestKey", toHex(metrics.hottestKey))
+                          << LOG_KV("hottestKeyWaited", metrics.hottestKeyWaited);
+        }
     }
 
     updateMultiExecutorsNonce();
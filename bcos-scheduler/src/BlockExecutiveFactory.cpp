@@ -66,6 +66,7 @@ std::shared_ptr<BlockExecutive> BlockExecutiveFactory::build(bcos::protocol::Blo
         auto shardingBlockExecutive = std::make_shared<ShardingBlockExecutive>(block, scheduler,
             startContextID, transactionSubmitResultFactory, staticCall, _blockFactory, _txPool,
             m_contract2ShardCache, _gasLimit, _gasPrice, _syncBlock, m_keyPageSize);
+        shardingBlockExecutive->setKeyPageFormat(m_keyPageFormat);
         return shardingBlockExecutive;
     }
 
@@ -28,6 +28,7 @@
 #include <bcos-crypto/interfaces/crypto/CommonType.h>
 #include <bcos-framework/protocol/BlockFactory.h>
 #include <bcos-framework/txpool/TxPoolInterface.h>
+#include <bcos-table/src/KeyPageCodec.h>
 #include <bcos-utilities/BucketMap.h>
 
 
@@ -59,9 +60,12 @@ public:
         bcos::txpool::TxPoolInterface::Ptr _txPool, uint64_t _gasLimit, std::string _gasPrice,
         bool _syncBlock);
 
+    void setKeyPageFormat(bcos::storage::KeyPageFormat _format) { m_keyPageFormat = _format; }
+
 private:
     bool m_isSerialExecute;
     std::shared_ptr<ShardCache> m_contract2ShardCache;
     size_t m_keyPageSize;
+    bcos::storage::KeyPageFormat m_keyPageFormat = bcos::storage::KeyPageFormat::ARCHIVE;
 };
 }  // namespace bcos::scheduler
@@ -2,16 +2,9 @@
 #include "Common.h"
 #include <bcos-utilities/DataConvertUtility.h>
 #include <bcos-utilities/Error.h>
-#include <boost/core/ignore_unused.hpp>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/depth_first_search.hpp>
-#include <boost/graph/detail/adjacency_list.hpp>
-#include <boost/graph/edge_list.hpp>
-#include <boost/graph/graph_selectors.hpp>
-#include <boost/graph/properties.hpp>
-#include <boost/graph/visitors.hpp>
 #include <boost/throw_exception.hpp>
 #include <fmt/format.h>
+#include <algorithm>
 
 using namespace bcos::scheduler;
 
@@ -40,22 +33,25 @@ bool GraphKeyLocks::batchAcquireKeyLock(
 bool GraphKeyLocks::acquireKeyLock(
     std::string_view contract, std::string_view key, int64_t contextID, int64_t seq)
 {
-    auto keyVertex = touchKeyLock(std::make_tuple(contract, key));
-    auto contextVertex = touchContext(contextID);
+    auto& keyEntry = touchKeyLock(contract, key);
+    auto& context = m_contexts[contextID];
 
-    auto range = boost::out_edges(keyVertex, m_graph);
-    for (auto it = range.first; it != range.second; ++it)
+    for (auto holder : keyEntry.holders)
     {
-        auto vertex = boost::get(VertexPropertyTag(), boost::target(*it, m_graph));
-        if (std::get<0>(*vertex) != contextID)
+        if (holder != contextID)
         {
             KEY_LOCK_LOG(TRACE) << fmt::format(
                 "Acquire key lock failed, request: [{}:{}] -> {} | {}, "
                 "exists: [{}]",
-                contract, toHex(key), contextID, seq, std::get<0>(*vertex));
+                contract, toHex(key), contextID, seq, holder);
 
             // Key lock holding by another context
-            addEdge(contextVertex, keyVertex, seq);
+            auto [it, inserted] = context.waiting[&keyEntry].insert(seq);
+            if (inserted)
+            {
+                ++keyEntry.waited;
+                ++keyEntry.shard->waited;
+            }
             KEY_LOCK_LOG(TRACE) << " " << contextID << " | " << seq << " -> [["
                                 << std::string(contract) << ":" << toHex(key) << "]]";
 
@@ -63,11 +59,15 @@ bool GraphKeyLocks::acquireKeyLock(
         }
     }
 
-    // Remove all request edge
-    boost::remove_edge(contextVertex, keyVertex, m_graph);
+    // Remove all request
+    context.waiting.erase(&keyEntry);
 
-    // Add an own edge
-    addEdge(keyVertex, contextVertex, seq);
+    // Hold the key
+    context.holding[&keyEntry].insert(seq);
+    if (keyEntry.holders.insert(contextID).second)
+    {
+        ++keyEntry.shard->acquired;
+    }
     KEY_LOCK_LOG(TRACE) << " [" << std::string(contract) << ":" << toHex(key) << "]  -> "
                         << contextID << " | " << seq;
 
@@ -81,26 +81,20 @@ bool GraphKeyLocks::acquireKeyLock(
 std::vector<std::string> GraphKeyLocks::getKeyLocksNotHoldingByContext(
     std::string_view contract, int64_t excludeContextID) const
 {
-    std::set<std::string> uniqueKeyLocks;
-
-    auto range = boost::edges(m_graph);
-    for (auto it = range.first; it != range.second; ++it)
+    std::vector<std::string> keyLocks;
+    auto shardIt = m_shards.find(contract);
+    if (shardIt == m_shards.end())
     {
-        auto sourceVertex = boost::get(VertexPropertyTag(), boost::source(*it, m_graph));
-        auto targetVertex = boost::get(VertexPropertyTag(), boost::target(*it, m_graph));
-
-        if (targetVertex->index() == 0 && std::get<0>(*targetVertex) != excludeContextID &&
-            sourceVertex->index() == 1 && std::get<0>(std::get<1>(*sourceVertex)) == contract)
-        {
-            uniqueKeyLocks.emplace(std::get<1>(std::get<1>(*sourceVertex)));
-        }
+        return keyLocks;
     }
 
-    std::vector<std::string> keyLocks;
-    keyLocks.reserve(uniqueKeyLocks.size());
-    for (auto& it : uniqueKeyLocks)
+    for (auto const& [key, keyEntry] : shardIt->second.keys)
     {
-        keyLocks.emplace_back(std::move(it));
+        if (std::any_of(keyEntry.holders.begin(), keyEntry.holders.end(),
+                [excludeContextID](ContextID holder) { return holder != excludeContextID; }))
+        {
+            keyLocks.emplace_back(key);
+        }
     }
 
     return keyLocks;
@@ -108,7 +102,8 @@ std::vector<std::string> GraphKeyLocks::getKeyLocksNotHoldingByContext(
 
 void GraphKeyLocks::releaseKeyLocks(int64_t contextID, int64_t seq)
 {
-    if (m_vertexes.count(Vertex(contextID)) == 0)
+    auto contextIt = m_contexts.find(contextID);
+    if (contextIt == m_contexts.end())
     {
         return;
     }
@@ -116,161 +111,170 @@ void GraphKeyLocks::releaseKeyLocks(int64_t contextID, int64_t seq)
     SCHEDULER_LOG(TRACE) << "Release key lock, contextID: " << contextID << " seq: " << seq;
 
     KEY_LOCK_LOG(TRACE) << " [*****] -> " << contextID << " | " << seq;
-    auto vertex = touchContext(contextID);
+    auto& context = contextIt->second;
 
-    auto edgeRemoveFunc = [seq, graph = &m_graph](auto range) mutable -> bool {
-        size_t total = 0;
-        size_t removed = 0;
-
-        for (auto next = range.first; range.first != range.second; range.first = next)
+    auto releaseFunc = [seq](std::map<KeyEntry*, std::set<Seq>>& keys, auto&& onReleased) {
+        for (auto it = keys.begin(); it != keys.end();)
         {
-            ++total;
-            ++next;
-            auto edgeSeq = boost::get(EdgePropertyTag(), *range.first);
-            if (edgeSeq == seq)
+            if (it->second.erase(seq) == 0)
             {
-                ++removed;
-                if (bcos::LogLevel::TRACE <= bcos::c_fileLogLevel)
-                {
-                    auto source =
-                        boost::get(VertexPropertyTag(), boost::source(*range.first, *graph));
-                    auto target =
-                        boost::get(VertexPropertyTag(), boost::target(*range.first, *graph));
-                    if (target->index() == 1)
-                    {
-                        source = target;
-                    }
-
-                    const auto& [contract, key] = std::get<1>(*source);
-                    SCHEDULER_LOG(TRACE) << "Releasing key lock, contract: " << contract
-                                         << " key: " << bcos::toHexString(key);
-                }
-                boost::remove_edge(*range.first, *graph);
+                ++it;
+                continue;
+            }
+            if (bcos::LogLevel::TRACE <= bcos::c_fileLogLevel)
+            {
+                SCHEDULER_LOG(TRACE)
+                    << "Releasing key lock, contract: " << it->first->shard->contract
+                    << " key: " << bcos::toHexString(it->first->key);
+            }
+            if (!it->second.empty())
+            {
+                ++it;
+                continue;
             }
+            onReleased(it->first);
+            it = keys.erase(it);
         }
-
-        return total == removed;
     };
 
-    auto clearedIn = edgeRemoveFunc(boost::in_edges(vertex, m_graph));
-    auto clearedOut = edgeRemoveFunc(boost::out_edges(vertex, m_graph));
+    releaseFunc(context.holding, [contextID](KeyEntry* keyEntry) {
+        keyEntry->holders.erase(contextID);
+    });
+    releaseFunc(context.waiting, [](KeyEntry*) {});
 
-    if (clearedIn && clearedOut)
+    if (context.holding.empty() && context.waiting.empty())
     {
-        // All edge had removed, delete the vertex
-        boost::remove_vertex(vertex, m_graph);
-        m_vertexes.erase(contextID);
+        m_contexts.erase(contextIt);
     }
 }
 
 bool GraphKeyLocks::detectDeadLock(ContextID contextID)
 {
-    struct GraphVisitor
-    {
-        GraphVisitor(bool& backEdge) : m_backEdge(backEdge) {}
-
-        void initialize_vertex(VertexID, const Graph&) {}
-        void start_vertex(VertexID, const Graph&) {}
-        void discover_vertex(VertexID, const Graph&) {}
-        void examine_edge(EdgeID, const Graph&) {}
-        void tree_edge(EdgeID, const Graph&) {}
-        void forward_or_cross_edge(EdgeID, const Graph&) {}
-        void finish_edge(EdgeID, const Graph&) {}
-        void finish_vertex(VertexID, const Graph&) {}
-
-        void back_edge(EdgeID edgeID, const Graph&) const
-        {
-            auto edgeSeq = boost::get(EdgePropertyTag(), edgeID);
-            SCHEDULER_LOG(TRACE) << "Detected back edge seq: " << edgeSeq;
-
-            m_backEdge = true;
-        }
-
-        bool& m_backEdge;
-    };
-
-    auto it = m_vertexes.find(bcos::scheduler::GraphKeyLocks::Vertex(contextID));
-    if (it == m_vertexes.end())
+    auto it = m_contexts.find(contextID);
+    if (it == m_contexts.end())
     {
-        // No vertex, may be removed
+        // No context, may be removed
         return false;
     }
 
-    if (boost::in_degree(it->second, m_graph) == 0)
+    if (it->second.holding.empty())
     {
-        // No in degree, not holding key lock
+        // Not holding key lock
         return false;
     }
 
-    std::map<VertexID, boost::default_color_type> vertexColors;
-    bool hasDeadLock = false;
-    boost::depth_first_visit(m_graph, it->second, GraphVisitor(hasDeadLock),
-        boost::make_assoc_property_map(vertexColors),
-        [&hasDeadLock](VertexID, const Graph&) { return hasDeadLock; });
-
-
-    return hasDeadLock;
-}
+    // depth first search on the contexts: context -> the holders of the keys it is waiting for
+    enum Color : uint8_t
+    {
+        GRAY,
+        BLACK
+    };
+    struct Frame
+    {
+        ContextID contextID;
+        std::vector<ContextID> next;
+        size_t index = 0;
+    };
+    auto makeFrame = [this](ContextID id) {
+        Frame frame{id, {}};
+        auto contextIt = m_contexts.find(id);
+        if (contextIt == m_contexts.end())
+        {
+            return frame;
+        }
+        for (auto const& [keyEntry, seqs] : contextIt->second.waiting)
+        {
+            frame.next.insert(frame.next.end(), keyEntry->holders.begin(), keyEntry->holders.end());
+        }
+        return frame;
+    };
 
-GraphKeyLocks::VertexID GraphKeyLocks::touchContext(int64_t contextID)
-{
-    auto [it, inserted] = m_vertexes.emplace(Vertex(contextID), VertexID());
-    if (inserted)
+    std::unordered_map<ContextID, Color> colors;
+    std::vector<Frame> stack;
+    colors.emplace(contextID, GRAY);
+    stack.emplace_back(makeFrame(contextID));
+    bool hasDeadLock = false;
+    while (!stack.empty() && !hasDeadLock)
     {
-        it->second = boost::add_vertex(&(it->first), m_graph);
+        auto& frame = stack.back();
+        if (frame.index == frame.next.size())
+        {
+            colors[frame.contextID] = BLACK;
+            stack.pop_back();
+            continue;
+        }
+        auto next = frame.next[frame.index++];
+        auto [colorIt, inserted] = colors.emplace(next, GRAY);
+        if (inserted)
+        {
+            stack.emplace_back(makeFrame(next));
+        }
+        else if (colorIt->second == GRAY)
+        {
+            SCHEDULER_LOG(TRACE) << "Detected back edge: " << frame.contextID << " -> " << next;
+            hasDeadLock = true;
+        }
     }
-    auto contextVertexID = it->second;
 
-    return contextVertexID;
-}
-
-GraphKeyLocks::VertexID GraphKeyLocks::touchKeyLock(KeyLockView keyLockView)
-{
-    auto contractKeyView = keyLockView;
-    auto it = m_vertexes.lower_bound(contractKeyView);
-    if (it != m_vertexes.end() && it->first == contractKeyView)
+    if (hasDeadLock)
     {
-        return it->second;
+        std::set<Shard*> shards;
+        for (auto const& [keyEntry, seqs] : it->second.waiting)
+        {
+            shards.insert(keyEntry->shard);
+        }
+        for (auto* shard : shards)
+        {
+            ++shard->deadLocks;
+        }
     }
-
-    auto inserted = m_vertexes.emplace_hint(it,
-        Vertex(std::make_tuple(
-            std::string(std::get<0>(contractKeyView)), std::string(std::get<1>(contractKeyView)))),
-        VertexID());
-    inserted->second = boost::add_vertex(&(inserted->first), m_graph);
-    return inserted->second;
+    return hasDeadLock;
 }
 
-void GraphKeyLocks::addEdge(VertexID source, VertexID target, int64_t seq)
+std::map<std::string, GraphKeyLocks::ContentionMetrics, std::less<>>
+GraphKeyLocks::contentionMetrics() const
 {
-    bool exists = false;
-
-    auto range = boost::edge_range(source, target, m_graph);
-    for (auto it = range.first; it != range.second; ++it)
+    std::map<std::string, ContentionMetrics, std::less<>> metrics;
+    for (auto const& [contract, shard] : m_shards)
     {
-        auto edgeSeq = boost::get(EdgePropertyTag(), *it);
-        if (edgeSeq == seq)
+        if (shard.waited == 0 && shard.deadLocks == 0)
         {
-            exists = true;
+            continue;
+        }
+        auto& contractMetrics = metrics[contract];
+        contractMetrics.acquired = shard.acquired;
+        contractMetrics.waited = shard.waited;
+        contractMetrics.deadLocks = shard.deadLocks;
+        for (auto const& [key, keyEntry] : shard.keys)
+        {
+            if (keyEntry.waited > contractMetrics.hottestKeyWaited)
+            {
+                contractMetrics.hottestKey = key;
+                contractMetrics.hottestKeyWaited = keyEntry.waited;
+            }
         }
     }
+    return metrics;
+}
 
-    if (!exists)
+GraphKeyLocks::KeyEntry& GraphKeyLocks::touchKeyLock(
+    std::string_view contract, std::string_view key)
+{
+    auto shardIt = m_shards.find(contract);
+    if (shardIt == m_shards.end())
     {
-        boost::add_edge(source, target, seq, m_graph);
+        shardIt = m_shards.emplace(std::string(contract), Shard{}).first;
+        shardIt->second.contract = shardIt->first;
     }
-}
+    auto& shard = shardIt->second;
 
-void GraphKeyLocks::removeEdge(VertexID source, VertexID target, int64_t seq)
-{
-    auto range = boost::edge_range(source, target, m_graph);
-    for (auto it = range.first; it != range.second; ++it)
+    auto keyIt = shard.keys.lower_bound(key);
+    if (keyIt != shard.keys.end() && keyIt->first == key)
     {
-        auto edgeSeq = boost::get(EdgePropertyTag(), *it);
-        if (edgeSeq == seq)
-        {
-            boost::remove_edge(*it, m_graph);
-            break;
-        }
+        return keyIt->second;
     }
-}
\ No newline at end of file
+    keyIt = shard.keys.emplace_hint(keyIt, std::string(key), KeyEntry{});
+    keyIt->second.shard = &shard;
+    keyIt->second.key = keyIt->first;
+    return keyIt->second;
+}
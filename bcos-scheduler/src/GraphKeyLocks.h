@@ -1,27 +1,42 @@
 #pragma once
 
 #include "Common.h"
-#include <boost/graph/adjacency_list.hpp>
 #include <functional>
 #include <gsl/span>
+#include <map>
+#include <set>
 #include <string_view>
-#include <variant>
+#include <unordered_map>
 
 #define KEY_LOCK_LOG(LEVEL) BCOS_LOG(LEVEL) << LOG_BADGE("SCHEDULER") << LOG_BADGE("KEY_LOCK")
 // #define KEY_LOCK_LOG(LEVEL) std::cout << LOG_BADGE("KEY_LOCK")
 
 namespace bcos::scheduler
 {
+/**
+ * The key locks of the DMC contexts. The locks are sharded by contract, every lookup only touches
+ * the lock table of one contract. The holding and waiting relations form the wait-for graph:
+ * context -> (waiting) key -> (holding) context, a dead lock is a cycle reachable from a context
+ * and the detection only walks the contexts reachable from it.
+ */
 class GraphKeyLocks
 {
 public:
     using Ptr = std::shared_ptr<GraphKeyLocks>;
-    using KeyLock = std::tuple<std::string, std::string>;
-    using KeyLockView = std::tuple<std::string_view, std::string_view>;
 
     using ContractView = std::string_view;
     using KeyView = std::string_view;
 
+    // the contention counters of the key locks of a contract
+    struct ContentionMetrics
+    {
+        uint64_t acquired = 0;
+        uint64_t waited = 0;
+        uint64_t deadLocks = 0;
+        std::string hottestKey;
+        uint64_t hottestKeyWaited = 0;
+    };
+
     GraphKeyLocks() = default;
     GraphKeyLocks(const GraphKeyLocks&) = delete;
     GraphKeyLocks(GraphKeyLocks&&) = delete;
@@ -42,79 +57,37 @@ public:
 
     bool detectDeadLock(ContextID contextID);
 
-    struct Vertex : public std::variant<ContextID, KeyLock>
-    {
-        using std::variant<ContextID, KeyLock>::variant;
-
-        bool operator==(const KeyLockView& rhs) const
-        {
-            if (index() != 1)
-            {
-                return false;
-            }
-
-            auto view = std::make_tuple(std::string_view(std::get<0>(std::get<1>(*this))),
-                std::string_view(std::get<1>(std::get<1>(*this))));
-            return view == rhs;
-        }
-    };
+    // contract => contention counters, only the contracts with contention
+    std::map<std::string, ContentionMetrics, std::less<>> contentionMetrics() const;
 
 private:
-    struct VertexIterator
+    struct Shard;
+    struct KeyEntry
     {
-        using kind = boost::vertex_property_tag;
+        Shard* shard = nullptr;
+        std::string_view key;
+        std::set<ContextID> holders;
+        uint64_t waited = 0;
     };
-    using VertexProperty = boost::property<VertexIterator, const Vertex*>;
-    struct EdgeSeq
+    struct Shard
     {
-        using kind = boost::edge_property_tag;
+        std::string_view contract;
+        std::map<std::string, KeyEntry, std::less<>> keys;
+        uint64_t acquired = 0;
+        uint64_t waited = 0;
+        uint64_t deadLocks = 0;
+    };
+    struct ContextLocks
+    {
+        // key => the seqs holding or waiting for the key
+        std::map<KeyEntry*, std::set<Seq>> holding;
+        std::map<KeyEntry*, std::set<Seq>> waiting;
     };
-    using EdgeProperty = boost::property<EdgeSeq, int64_t>;
-
-    using Graph = boost::adjacency_list<boost::multisetS, boost::multisetS, boost::bidirectionalS,
-        VertexProperty, EdgeProperty>;
-    using VertexPropertyTag = boost::property_map<Graph, VertexIterator>::const_type;
-    using EdgePropertyTag = boost::property_map<Graph, EdgeSeq>::const_type;
-    using VertexID = Graph::vertex_descriptor;
-    using EdgeID = Graph::edge_descriptor;
-
-    Graph m_graph;
-    std::map<Vertex, VertexID, std::less<>> m_vertexes;
 
-    VertexID touchContext(ContextID contextID);
-    VertexID touchKeyLock(KeyLockView keylockView);
+    KeyEntry& touchKeyLock(std::string_view contract, std::string_view key);
 
-    void addEdge(VertexID source, VertexID target, Seq seq);
-    void removeEdge(VertexID source, VertexID target, Seq seq);
+    std::map<std::string, Shard, std::less<>> m_shards;
+    std::unordered_map<ContextID, ContextLocks> m_contexts;
 };
 
 }  // namespace bcos::scheduler
-
-namespace std
-{
-inline bool operator<(const bcos::scheduler::GraphKeyLocks::Vertex& lhs,
-    const bcos::scheduler::GraphKeyLocks::KeyLockView& rhs)
-{
-    if (lhs.index() != 1)
-    {
-        return true;
-    }
-
-    auto view = std::make_tuple(std::string_view(std::get<0>(std::get<1>(lhs))),
-        std::string_view(std::get<1>(std::get<1>(lhs))));
-    return view < rhs;
-}
-
-inline bool operator<(const bcos::scheduler::GraphKeyLocks::KeyLockView& lhs,
-    const bcos::scheduler::GraphKeyLocks::Vertex& rhs)
-{
-    if (rhs.index() != 1)
-    {
-        return false;
-    }
-
-    auto view = std::make_tuple(std::string_view(std::get<0>(std::get<1>(rhs))),
-        std::string_view(std::get<1>(std::get<1>(rhs))));
-    return lhs < view;
-}
-}  // namespace std
\ No newline at end of file
@@ -37,6 +37,7 @@ public:
             m_storage, m_executionMessageFactory, m_blockFactory, m_txPool,
             m_transactionSubmitResultFactory, m_hashImpl, m_isAuthCheck, m_isWasm,
             m_isSerialExecute, schedulerTermId, m_keyPageSize);
+        scheduler->setKeyPageFormat(m_keyPageFormat);
         scheduler->fetchConfig();
 
         scheduler->registerBlockNumberReceiver(m_blockNumberReceiver);
@@ -57,6 +58,8 @@ public:
         m_txNotifier = std::move(txNotifier);
     }
 
+    void setKeyPageFormat(bcos::storage::KeyPageFormat _format) { m_keyPageFormat = _format; }
+
     bcos::ledger::LedgerInterface::Ptr getLedger() { return m_ledger; }
 
     void stop() { m_storage->stop(); }
@@ -74,6 +77,7 @@ private:
     bool m_isWasm;
     bool m_isSerialExecute;
     size_t m_keyPageSize;
+    bcos::storage::KeyPageFormat m_keyPageFormat = bcos::storage::KeyPageFormat::ARCHIVE;
 
     std::function<void(protocol::BlockNumber blockNumber)> m_blockNumberReceiver;
     std::function<void(bcos::protocol::BlockNumber, bcos::protocol::TransactionSubmitResultsPtr,
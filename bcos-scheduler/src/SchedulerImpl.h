@@ -130,6 +130,11 @@ public:
         m_blockExecutiveFactory = blockExecutiveFactory;
     }
 
+    void setKeyPageFormat(bcos::storage::KeyPageFormat _format)
+    {
+        m_blockExecutiveFactory->setKeyPageFormat(_format);
+    }
+
     void setOnNeedSwitchEventHandler(std::function<void(int64_t)> onNeedSwitchEvent)
     {
         f_onNeedSwitchEvent = std::move(onNeedSwitchEvent);
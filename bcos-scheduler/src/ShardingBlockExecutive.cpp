@@ -282,8 +282,10 @@ std::string ShardingBlockExecutive::getContractShard(const std::string& contract
         storage::StateStorageInterface::Ptr stateStorage;
         if (m_keyPageSize > 0)
         {
-            stateStorage = std::make_shared<bcos::storage::KeyPageStorage>(getStorage(), false,
-                m_keyPageSize, m_block->blockHeader()->version(), nullptr, true);
+            auto keyPageStorage = std::make_shared<bcos::storage::KeyPageStorage>(getStorage(),
+                false, m_keyPageSize, m_block->blockHeader()->version(), nullptr, true);
+            keyPageStorage->setPageFormat(m_keyPageFormat);
+            stateStorage = std::move(keyPageStorage);
         }
         else
         {
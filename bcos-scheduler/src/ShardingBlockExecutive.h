@@ -22,6 +22,7 @@
 #pragma once
 #include "BlockExecutive.h"
 #include <bcos-table/src/ContractShardUtils.h>
+#include <bcos-table/src/KeyPageCodec.h>
 #include <bcos-utilities/BucketMap.h>
 #include <tbb/concurrent_unordered_map.h>
 
@@ -65,6 +66,8 @@ public:
         const std::string& contractAddress,
         bcos::executor::ParallelTransactionExecutorInterface::Ptr executor) override;
 
+    void setKeyPageFormat(bcos::storage::KeyPageFormat _format) { m_keyPageFormat = _format; }
+
 private:
     bool needPrepareExecutor() override { return false; }
 
@@ -75,5 +78,6 @@ private:
     std::shared_ptr<ShardCache> m_contract2ShardCache;
 
     size_t m_keyPageSize;
+    bcos::storage::KeyPageFormat m_keyPageFormat = bcos::storage::KeyPageFormat::ARCHIVE;
 };
 }  // namespace bcos::scheduler
@@ -110,5 +110,44 @@ BOOST_AUTO_TEST_CASE(deadLock)
     BOOST_CHECK(keyLocks.detectDeadLock(1001));
 }
 
+BOOST_AUTO_TEST_CASE(contentionMetrics)
+{
+    BOOST_CHECK(keyLocks.acquireKeyLock("contract1", "key1", 1000, 1));
+    BOOST_CHECK(keyLocks.acquireKeyLock("contract2", "key1", 1001, 1));
+    BOOST_CHECK(keyLocks.acquireKeyLock("contract2", "key2", 1001, 1));
+
+    // the same key of different contracts are different locks
+    BOOST_CHECK_EQUAL(keyLocks.getKeyLocksNotHoldingByContext("contract1", 1001).size(), 1U);
+    BOOST_CHECK_EQUAL(keyLocks.getKeyLocksNotHoldingByContext("contract2", 1001).size(), 0U);
+    BOOST_CHECK(keyLocks.contentionMetrics().empty());
+
+    // the retries of the same seq are counted once
+    BOOST_CHECK(!keyLocks.acquireKeyLock("contract2", "key2", 1000, 2));
+    BOOST_CHECK(!keyLocks.acquireKeyLock("contract2", "key2", 1000, 2));
+    BOOST_CHECK(!keyLocks.acquireKeyLock("contract2", "key1", 1000, 3));
+    BOOST_CHECK(!keyLocks.acquireKeyLock("contract2", "key2", 1002, 1));
+    BOOST_CHECK(!keyLocks.detectDeadLock(1000));
+
+    BOOST_CHECK(!keyLocks.acquireKeyLock("contract1", "key1", 1001, 2));
+    BOOST_CHECK(keyLocks.detectDeadLock(1000));
+
+    auto metrics = keyLocks.contentionMetrics();
+    BOOST_CHECK_EQUAL(metrics.size(), 2U);
+    BOOST_CHECK_EQUAL(metrics["contract2"].acquired, 2U);
+    BOOST_CHECK_EQUAL(metrics["contract2"].waited, 3U);
+    BOOST_CHECK_EQUAL(metrics["contract2"].deadLocks, 1U);
+    BOOST_CHECK_EQUAL(metrics["contract2"].hottestKey, "key2");
+    BOOST_CHECK_EQUAL(metrics["contract2"].hottestKeyWaited, 2U);
+    BOOST_CHECK_EQUAL(metrics["contract1"].waited, 1U);
+    BOOST_CHECK_EQUAL(metrics["contract1"].deadLocks, 0U);
+
+    // release the dead lock
+    keyLocks.releaseKeyLocks(1001, 1);
+    keyLocks.releaseKeyLocks(1001, 2);
+    BOOST_CHECK(!keyLocks.detectDeadLock(1000));
+    BOOST_CHECK(keyLocks.acquireKeyLock("contract2", "key2", 1000, 2));
+    BOOST_CHECK(keyLocks.getKeyLocksNotHoldingByContext("contract2", 1000).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace bcos::test
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief adjust the block size to the target block latency
+ * @file AdaptiveSealingPolicy.cpp
+ * @date 2026-10-19
+ */
+#include "AdaptiveSealingPolicy.h"
+#include "Common.h"
+#include <algorithm>
+
+using namespace bcos;
+using namespace bcos::sealer;
+
+AdaptiveSealingPolicy::AdaptiveSealingPolicy(uint64_t _targetLatency, size_t _minTxsLimit)
+  : m_targetLatency(_targetLatency), m_minTxsLimit(std::max<size_t>(_minTxsLimit, 1))
+{}
+
+size_t AdaptiveSealingPolicy::txsLimit(size_t _maxTxsPerBlock) const
+{
+    std::lock_guard lock(m_mutex);
+    if (m_txsLimit == 0)
+    {
+        return _maxTxsPerBlock;
+    }
+    return std::min(m_txsLimit, _maxTxsPerBlock);
+}
+
+void AdaptiveSealingPolicy::onBlockSealed(size_t _txsCount, size_t _maxTxsPerBlock)
+{
+    std::lock_guard lock(m_mutex);
+    auto limit = m_txsLimit == 0 ? _maxTxsPerBlock : std::min(m_txsLimit, _maxTxsPerBlock);
+    m_lastSealedFull = (_txsCount >= limit);
+}
+
+bool AdaptiveSealingPolicy::onBlockCommitted(bcos::protocol::BlockNumber _number,
+    int64_t _blockTimestamp, int64_t _now, uint64_t _pendingTxs, size_t _maxTxsPerBlock)
+{
+    if (_maxTxsPerBlock == 0)
+    {
+        return false;
+    }
+    std::lock_guard lock(m_mutex);
+    if (_number <= m_committedNumber)
+    {
+        return false;
+    }
+    m_committedNumber = _number;
+    auto latency = static_cast<uint64_t>(std::max<int64_t>(_now - _blockTimestamp, 0));
+    m_metrics.pendingTxs = _pendingTxs;
+    if (latency > m_targetLatency * IGNORED_LATENCY_FACTOR)
+    {
+        return false;
+    }
+    m_metrics.latency = latency;
+    m_metrics.smoothedLatency = m_metrics.smoothedLatency == 0 ?
+                                    latency :
+                                    (m_metrics.smoothedLatency * 3 + latency) / 4;
+
+    auto minLimit = std::min(m_minTxsLimit, _maxTxsPerBlock);
+    auto limit = m_txsLimit == 0 ? _maxTxsPerBlock : std::min(m_txsLimit, _maxTxsPerBlock);
+    auto newLimit = limit;
+    auto smoothedLatency = m_metrics.smoothedLatency;
+    if (smoothedLatency > m_targetLatency)
+    {
+        // shrink in proportion to the overshoot, at most by half a time
+        newLimit = std::max(limit * m_targetLatency / smoothedLatency, limit / 2);
+        newLimit = std::max(newLimit, minLimit);
+    }
+    else if (smoothedLatency * 5 < m_targetLatency * 4 &&
+             (_pendingTxs > limit || m_lastSealedFull))
+    {
+        newLimit = std::min(limit + std::max(limit / 8, minLimit), _maxTxsPerBlock);
+    }
+    m_metrics.txsLimit = newLimit;
+    if (newLimit == limit)
+    {
+        return false;
+    }
+    if (newLimit > limit)
+    {
+        ++m_metrics.increased;
+    }
+    else
+    {
+        ++m_metrics.decreased;
+    }
+    m_txsLimit = newLimit;
+    SEAL_LOG(INFO) << METRIC << LOG_DESC("AdaptiveSealingPolicy: update txs limit")
+                   << LOG_KV("number", _number) << LOG_KV("from", limit)
+                   << LOG_KV("to", newLimit) << LOG_KV("latency", latency)
+                   << LOG_KV("smoothedLatency", smoothedLatency)
+                   << LOG_KV("targetLatency", m_targetLatency)
+                   << LOG_KV("pendingTxs", _pendingTxs) << LOG_KV("maxTxs", _maxTxsPerBlock);
+    return true;
+}
+
+AdaptiveSealingPolicy::Metrics AdaptiveSealingPolicy::metrics() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_metrics;
+}
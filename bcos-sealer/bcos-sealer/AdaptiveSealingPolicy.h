@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief adjust the block size to the target block latency
+ * @file AdaptiveSealingPolicy.h
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <memory>
+#include <mutex>
+
+namespace bcos::sealer
+{
+/**
+ * The latency of a block is measured from its timestamp (the time it was sealed) to the time it
+ * was committed, so it covers the consensus, execution and commit of the block.
+ *
+ * - the limit decreases multiplicatively when the smoothed latency exceeds the target
+ * - the limit increases additively when the latency is below the target and the txpool has more
+ *   transactions than a block can take
+ * - the limit never exceeds the txs count limit of the ledger
+ */
+class AdaptiveSealingPolicy
+{
+public:
+    using Ptr = std::shared_ptr<AdaptiveSealingPolicy>;
+
+    constexpr static size_t DEFAULT_MIN_TXS_LIMIT = 100;
+    // the latency of the blocks synced from the peers is meaningless
+    constexpr static uint64_t IGNORED_LATENCY_FACTOR = 10;
+
+    struct Metrics
+    {
+        size_t txsLimit = 0;
+        uint64_t latency = 0;
+        uint64_t smoothedLatency = 0;
+        uint64_t pendingTxs = 0;
+        uint64_t increased = 0;
+        uint64_t decreased = 0;
+    };
+
+    explicit AdaptiveSealingPolicy(
+        uint64_t _targetLatency, size_t _minTxsLimit = DEFAULT_MIN_TXS_LIMIT);
+    AdaptiveSealingPolicy(const AdaptiveSealingPolicy&) = delete;
+    AdaptiveSealingPolicy(AdaptiveSealingPolicy&&) = delete;
+    AdaptiveSealingPolicy& operator=(const AdaptiveSealingPolicy&) = delete;
+    AdaptiveSealingPolicy& operator=(AdaptiveSealingPolicy&&) = delete;
+    virtual ~AdaptiveSealingPolicy() = default;
+
+    // the txs count limit of the next block
+    virtual size_t txsLimit(size_t _maxTxsPerBlock) const;
+    virtual void onBlockSealed(size_t _txsCount, size_t _maxTxsPerBlock);
+    // return true if the limit has been changed
+    virtual bool onBlockCommitted(bcos::protocol::BlockNumber _number, int64_t _blockTimestamp,
+        int64_t _now, uint64_t _pendingTxs, size_t _maxTxsPerBlock);
+
+    uint64_t targetLatency() const { return m_targetLatency; }
+    Metrics metrics() const;
+
+private:
+    uint64_t m_targetLatency;
+    size_t m_minTxsLimit;
+
+    mutable std::mutex m_mutex;
+    // 0 means the limit of the ledger
+    size_t m_txsLimit = 0;
+    bool m_lastSealedFull = false;
+    bcos::protocol::BlockNumber m_committedNumber = -1;
+    Metrics m_metrics;
+};
+}  // namespace bcos::sealer
@@ -46,6 +46,12 @@ public:
 
     virtual unsigned minSealTime() const { return m_minSealTime; }
     virtual void setMinSealTime(unsigned _minSealTime) { m_minSealTime = _minSealTime; }
+    // the expected latency from sealing a block to committing it, 0 disables adaptive sealing
+    virtual uint64_t targetBlockLatency() const { return m_targetBlockLatency; }
+    virtual void setTargetBlockLatency(uint64_t _targetBlockLatency)
+    {
+        m_targetBlockLatency = _targetBlockLatency;
+    }
     virtual void setGroupId(const std::string& _groupId) { m_groupId = _groupId; }
     virtual void setChainId(const std::string& _chainId) { m_chainId = _chainId; }
     virtual const std::string& groupId() const { return m_groupId; }
@@ -67,6 +73,7 @@ protected:
     bcos::consensus::ConsensusInterface::Ptr m_consensus;
     bcos::tool::NodeTimeMaintenance::Ptr m_nodeTimeMaintenance;
     unsigned m_minSealTime = 500;
+    uint64_t m_targetBlockLatency = 0;
     std::string m_groupId{};
     std::string m_chainId{};
 };
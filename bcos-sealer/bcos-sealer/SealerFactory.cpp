@@ -35,6 +35,7 @@ SealerFactory::SealerFactory(bcos::tool::NodeConfig::Ptr _nodeConfig,
     m_blockFactory(std::move(_blockFactory)),
     m_txpool(std::move(_txpool)),
     m_minSealTime(_nodeConfig->minSealTime()),
+    m_targetBlockLatency(_nodeConfig->targetBlockLatency()),
     m_nodeTimeMaintenance(std::move(_nodeTimeMaintenance)),
     m_keyPair(std::move(_key))
 {}
@@ -44,6 +45,7 @@ Sealer::Ptr SealerFactory::createSealer()
     auto sealerConfig =
         std::make_shared<SealerConfig>(m_blockFactory, m_txpool, m_nodeTimeMaintenance);
     sealerConfig->setMinSealTime(m_minSealTime);
+    sealerConfig->setTargetBlockLatency(m_targetBlockLatency);
     sealerConfig->setKeyPair(m_keyPair);
     sealerConfig->setGroupId(m_groupId);
     sealerConfig->setChainId(m_chainId);
@@ -55,6 +57,7 @@ VRFBasedSealer::Ptr SealerFactory::createVRFBasedSealer()
     auto sealerConfig =
         std::make_shared<SealerConfig>(m_blockFactory, m_txpool, m_nodeTimeMaintenance);
     sealerConfig->setMinSealTime(m_minSealTime);
+    sealerConfig->setTargetBlockLatency(m_targetBlockLatency);
     sealerConfig->setKeyPair(m_keyPair);
     sealerConfig->setGroupId(m_groupId);
     sealerConfig->setChainId(m_chainId);
@@ -45,6 +45,7 @@ protected:
     bcos::protocol::BlockFactory::Ptr m_blockFactory;
     bcos::txpool::TxPoolInterface::Ptr m_txpool;
     unsigned m_minSealTime;
+    uint64_t m_targetBlockLatency;
     bcos::tool::NodeTimeMaintenance::Ptr m_nodeTimeMaintenance;
     bcos::crypto::KeyPairInterface::Ptr m_keyPair;
 };
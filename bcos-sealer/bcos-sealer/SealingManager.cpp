@@ -61,7 +61,7 @@ bool SealingManager::shouldGenerateProposal()
     }
     // check the txs size
     auto txsSize = pendingTxsSize();
-    return (txsSize >= m_maxTxsPerBlock) || reachMinSealTimeCondition();
+    return (txsSize >= txsLimit()) || reachMinSealTimeCondition();
 }
 
 void SealingManager::clearPendingTxs()
@@ -139,8 +139,8 @@ std::pair<bool, bcos::protocol::Block::Ptr> SealingManager::generateProposal(
     blockHeader->setTimestamp(timestamp);
     blockHeader->calculateHash(*m_config->blockFactory()->cryptoSuite()->hashImpl());
     block->setBlockHeader(blockHeader);
-    auto txsSize =
-        std::min(m_maxTxsPerBlock.load(), (m_pendingTxs.size() + m_pendingSysTxs.size()));
+    auto limit = txsLimit();
+    auto txsSize = std::min(limit, (m_pendingTxs.size() + m_pendingSysTxs.size()));
     // prioritize seal from the system txs list
     auto systemTxsSize = std::min(txsSize, m_pendingSysTxs.size());
     if (!m_pendingSysTxs.empty())
@@ -163,7 +163,7 @@ std::pair<bool, bcos::protocol::Block::Ptr> SealingManager::generateProposal(
             if (block->transactionsMetaDataSize() > 0 || block->transactionsSize() > 0)
             {
                 containSysTxs = true;
-                if (txsSize == m_maxTxsPerBlock)
+                if (txsSize == limit)
                 {
                     txsSize--;
                 }
@@ -190,6 +190,10 @@ std::pair<bool, bcos::protocol::Block::Ptr> SealingManager::generateProposal(
         m_pendingTxs.pop_front();
     }
     m_sealingNumber++;
+    if (m_sealingPolicy)
+    {
+        m_sealingPolicy->onBlockSealed(txsSize, m_maxTxsPerBlock);
+    }
 
     m_lastSealTime = utcSteadyTime();
     // Note: When the last block(N) sealed by this node contains system transactions,
@@ -213,6 +217,43 @@ size_t SealingManager::pendingTxsSize()
     return m_pendingSysTxs.size() + m_pendingTxs.size();
 }
 
+size_t SealingManager::txsLimit() const
+{
+    if (!m_sealingPolicy)
+    {
+        return m_maxTxsPerBlock;
+    }
+    return m_sealingPolicy->txsLimit(m_maxTxsPerBlock);
+}
+
+void SealingManager::resetLatestTimestamp(int64_t _latestTimestamp)
+{
+    m_latestTimestamp = _latestTimestamp;
+    if (m_sealingPolicy)
+    {
+        updateSealingPolicy(m_latestNumber, _latestTimestamp);
+    }
+}
+
+void SealingManager::updateSealingPolicy(int64_t _latestNumber, int64_t _latestTimestamp)
+{
+    // the block timestamp is the aligned time the block was sealed
+    auto now = m_config->nodeTimeMaintenance() ?
+                   m_config->nodeTimeMaintenance()->getAlignedTime() :
+                   static_cast<int64_t>(utcTime());
+    auto self = weak_from_this();
+    m_config->txpool()->asyncGetPendingTransactionSize(
+        [self, _latestNumber, _latestTimestamp, now](Error::Ptr _error, uint64_t _pendingTxs) {
+            auto sealingManager = self.lock();
+            if (!sealingManager || _error)
+            {
+                return;
+            }
+            sealingManager->m_sealingPolicy->onBlockCommitted(_latestNumber, _latestTimestamp,
+                now, _pendingTxs, sealingManager->m_maxTxsPerBlock);
+        });
+}
+
 bool SealingManager::reachMinSealTimeCondition()
 {
     auto txsSize = pendingTxsSize();
@@ -306,7 +347,14 @@ bcos::sealer::SealingManager::FetchResult SealingManager::fetchTransactions()
 
 bcos::sealer::SealingManager::SealingManager(SealerConfig::Ptr _config)
   : m_config(std::move(_config))
-{}
+{
+    if (m_config->targetBlockLatency() > 0)
+    {
+        m_sealingPolicy = std::make_shared<AdaptiveSealingPolicy>(m_config->targetBlockLatency());
+        SEAL_LOG(INFO) << LOG_DESC("enable adaptive sealing")
+                       << LOG_KV("targetBlockLatency", m_config->targetBlockLatency());
+    }
+}
 
 void bcos::sealer::SealingManager::resetSealingInfo(
     ssize_t _startSealingNumber, ssize_t _endSealingNumber, size_t _maxTxsPerBlock)
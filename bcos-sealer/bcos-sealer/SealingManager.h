@@ -18,6 +18,7 @@
  * @date: 2021-05-14
  */
 #pragma once
+#include "AdaptiveSealingPolicy.h"
 #include "SealerConfig.h"
 #include "bcos-framework/protocol/TransactionMetaData.h"
 #include <bcos-utilities/CallbackCollectionHandler.h>
@@ -52,10 +53,7 @@ public:
 
     virtual void resetLatestNumber(int64_t _latestNumber);
     virtual void resetLatestHash(crypto::HashType _latestHash);
-    virtual void resetLatestTimestamp(int64_t _latestTimestamp)
-    {
-        m_latestTimestamp = _latestTimestamp;
-    }
+    virtual void resetLatestTimestamp(int64_t _latestTimestamp);
     virtual int64_t latestNumber() const;
     virtual crypto::HashType latestHash() const;
     virtual int64_t latestTimestamp() const { return m_latestTimestamp; }
@@ -78,6 +76,9 @@ public:
     virtual void notifyResetTxsFlag(
         const bcos::crypto::HashList& _txsHash, bool _flag, size_t _retryTime = 0);
 
+    // nullptr if the adaptive sealing is disabled
+    AdaptiveSealingPolicy::Ptr sealingPolicy() const { return m_sealingPolicy; }
+
 protected:
     virtual void appendTransactions(TxsMetaDataQueue& _txsQueue,
         const std::vector<protocol::TransactionMetaData::Ptr>& _fetchedTxs);
@@ -87,9 +88,13 @@ protected:
 
     virtual int64_t txsSizeExpectedToFetch();
     virtual size_t pendingTxsSize();
+    // the txs count limit of the next block
+    virtual size_t txsLimit() const;
+    virtual void updateSealingPolicy(int64_t _latestNumber, int64_t _latestTimestamp);
 
 private:
     SealerConfig::Ptr m_config;
+    AdaptiveSealingPolicy::Ptr m_sealingPolicy;
     TxsMetaDataQueue m_pendingTxs;
     TxsMetaDataQueue m_pendingSysTxs;
     SharedMutex x_pendingTxs;
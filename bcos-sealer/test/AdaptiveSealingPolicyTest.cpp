@@ -0,0 +1,70 @@
+#include "bcos-sealer/AdaptiveSealingPolicy.h"
+#include <boost/test/unit_test.hpp>
+
+namespace bcos::test
+{
+BOOST_AUTO_TEST_SUITE(TestAdaptiveSealingPolicy)
+
+BOOST_AUTO_TEST_CASE(adjustTxsLimit)
+{
+    size_t maxTxs = 1000;
+    sealer::AdaptiveSealingPolicy policy(1000, 100);
+    BOOST_CHECK_EQUAL(policy.txsLimit(maxTxs), maxTxs);
+
+    // the latency exceeds the target: shrink, at most by half a time
+    BOOST_CHECK(policy.onBlockCommitted(1, 0, 3000, 5000, maxTxs));
+    BOOST_CHECK_EQUAL(policy.txsLimit(maxTxs), 500U);
+    // the committed block is ignored
+    BOOST_CHECK(!policy.onBlockCommitted(1, 0, 100, 5000, maxTxs));
+    // the block synced from the peers is ignored
+    BOOST_CHECK(!policy.onBlockCommitted(2, 0, 100000, 5000, maxTxs));
+    BOOST_CHECK_EQUAL(policy.metrics().smoothedLatency, 3000U);
+
+    // the latency falls below the target and the txpool is deep: grow back to the ledger limit
+    for (protocol::BlockNumber number = 3; number < 100; ++number)
+    {
+        policy.onBlockCommitted(number, 0, 100, 5000, maxTxs);
+        BOOST_CHECK_LE(policy.txsLimit(maxTxs), maxTxs);
+        BOOST_CHECK_GE(policy.txsLimit(maxTxs), 100U);
+    }
+    BOOST_CHECK_EQUAL(policy.txsLimit(maxTxs), maxTxs);
+    // the ledger limit always bounds the policy
+    BOOST_CHECK_EQUAL(policy.txsLimit(200), 200U);
+
+    auto metrics = policy.metrics();
+    BOOST_CHECK_EQUAL(metrics.txsLimit, maxTxs);
+    BOOST_CHECK_EQUAL(metrics.latency, 100U);
+    BOOST_CHECK_GE(metrics.decreased, 1U);
+    BOOST_CHECK_GE(metrics.increased, 1U);
+}
+
+BOOST_AUTO_TEST_CASE(noBacklog)
+{
+    size_t maxTxs = 1000;
+    sealer::AdaptiveSealingPolicy policy(1000, 100);
+    policy.onBlockCommitted(1, 0, 3000, 0, maxTxs);
+    protocol::BlockNumber number = 2;
+    for (; number < 20; ++number)
+    {
+        policy.onBlockCommitted(number, 0, 100, 0, maxTxs);
+    }
+    auto limit = policy.txsLimit(maxTxs);
+    BOOST_CHECK_LT(limit, maxTxs);
+    BOOST_CHECK_GE(limit, 100U);
+
+    // the latency is low but neither the txpool nor the sealed blocks need a larger block
+    policy.onBlockSealed(10, maxTxs);
+    for (; number < 40; ++number)
+    {
+        BOOST_CHECK(!policy.onBlockCommitted(number, 0, 100, 0, maxTxs));
+    }
+    BOOST_CHECK_EQUAL(policy.txsLimit(maxTxs), limit);
+
+    // the sealed block is full
+    policy.onBlockSealed(limit, maxTxs);
+    BOOST_CHECK(policy.onBlockCommitted(number, 0, 100, 0, maxTxs));
+    BOOST_CHECK_GT(policy.txsLimit(maxTxs), limit);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the latency histogram of the storage round trips
+ * @file LatencyHistogram.h
+ * @date 2026-10-19
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <string>
+
+namespace bcos::storage
+{
+/**
+ * A lock-free histogram of latencies in milliseconds with power of two buckets: bucket 0 counts
+ * 0ms, bucket i counts [2^(i-1), 2^i) ms and the last bucket counts everything above.
+ */
+class LatencyHistogram
+{
+public:
+    constexpr static size_t BUCKETS = 18;
+
+    void observe(uint64_t _ms)
+    {
+        auto index = std::min<size_t>(std::bit_width(_ms), BUCKETS - 1);
+        m_buckets[index].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(_ms, std::memory_order_relaxed);
+        auto max = m_max.load(std::memory_order_relaxed);
+        while (_ms > max && !m_max.compare_exchange_weak(max, _ms, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+    uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+
+    // the upper bound of the bucket containing the percentile, _percent in [0, 100]
+    uint64_t percentile(double _percent) const
+    {
+        auto total = count();
+        if (total == 0)
+        {
+            return 0;
+        }
+        auto rank = static_cast<uint64_t>(static_cast<double>(total) * _percent / 100);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i)
+        {
+            seen += m_buckets[i].load(std::memory_order_relaxed);
+            if (seen > rank || seen == total)
+            {
+                // the last bucket has no upper bound
+                return i + 1 == BUCKETS ? max() :
+                                          std::min<uint64_t>((uint64_t(1) << i) - 1, max());
+            }
+        }
+        return max();
+    }
+
+    std::string toString() const
+    {
+        auto total = count();
+        return "count=" + std::to_string(total) +
+               ",avg=" + std::to_string(total == 0 ? 0 : sum() / total) +
+               ",p50=" + std::to_string(percentile(50)) +
+               ",p99=" + std::to_string(percentile(99)) + ",max=" + std::to_string(max());
+    }
+
+private:
+    std::array<std::atomic_uint64_t, BUCKETS> m_buckets{};
+    std::atomic_uint64_t m_count = 0;
+    std::atomic_uint64_t m_sum = 0;
+    std::atomic_uint64_t m_max = 0;
+};
+}  // namespace bcos::storage
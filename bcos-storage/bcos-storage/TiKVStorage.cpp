@@ -20,12 +20,14 @@
  */
 #include "TiKVStorage.h"
 #include "Common.h"
+#include "bcos-framework/Common.h"
 #include "bcos-framework/protocol/ProtocolTypeDef.h"
 #include "bcos-framework/storage/Table.h"
 #include "tikv_client.h"
 #include <bcos-utilities/Error.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 #include <atomic>
 #include <exception>
 #include <iostream>
@@ -60,9 +62,16 @@ std::shared_ptr<tikv_client::TransactionClient> newTiKVClient(
 
 TiKVStorage::TiKVStorage(
     std::shared_ptr<tikv_client::TransactionClient> _cluster, int32_t _commitTimeout)
-  : m_cluster(std::move(_cluster)), m_commitTimeout(_commitTimeout)
+  : m_cluster(std::move(_cluster)),
+    m_commitTimeout(_commitTimeout),
+    m_secondaryCommitter("tikvCommitter", 1)
 {}
 
+TiKVStorage::~TiKVStorage()
+{
+    waitForSecondaryCommit();
+}
+
 void TiKVStorage::asyncGetPrimaryKeys(std::string_view _table,
     const std::optional<Condition const>& _condition,
     std::function<void(Error::UniquePtr, std::vector<std::string>)> _callback) noexcept
@@ -201,31 +210,59 @@ void TiKVStorage::asyncGetRows(std::string_view _table,
                     realKeys[i] = toDBKey(_table, keys[i]);
                 }
             });
-        auto snap = getSnapshot();
-        auto result = snap->batch_get(realKeys);
-        auto end = utcTime();
-        size_t validCount = 0;
-        for (size_t i = 0; i < realKeys.size(); ++i)
-        {
-            auto node = result.extract(realKeys[i]);
-            if (node.empty() || node.mapped().empty())
+        std::atomic_size_t validCount = 0;
+        // read the keys in [_begin, _end) by one BatchGet request
+        auto batchGet = [&](tikv_client::Snapshot& _snapshot, size_t _begin, size_t _end) {
+            std::vector<std::string> batchKeys(std::make_move_iterator(realKeys.begin() + _begin),
+                std::make_move_iterator(realKeys.begin() + _end));
+            auto result = _snapshot.batch_get(batchKeys);
+            for (size_t i = _begin; i < _end; ++i)
             {
-                entries[i] = std::nullopt;
-                STORAGE_TIKV_LOG(TRACE) << "Multi get rows, not found key: " << keys[i];
-            }
-            else
-            {
-                ++validCount;
-                entries[i] = std::make_optional(Entry());
-                entries[i]->set(std::move(node.mapped()));
+                auto node = result.extract(batchKeys[i - _begin]);
+                if (node.empty() || node.mapped().empty())
+                {
+                    entries[i] = std::nullopt;
+                    STORAGE_TIKV_LOG(TRACE) << "Multi get rows, not found key: " << keys[i];
+                }
+                else
+                {
+                    ++validCount;
+                    entries[i] = std::make_optional(Entry());
+                    entries[i]->set(std::move(node.mapped()));
+                }
             }
+        };
+        size_t batches = (realKeys.size() + m_batchGetSize - 1) / m_batchGetSize;
+        if (batches <= 1)
+        {
+            auto snap = getSnapshot();
+            batchGet(*snap, 0, realKeys.size());
+        }
+        else
+        {
+            // all the batches read the same version, snapshot is not threadsafe so every batch
+            // creates its own
+            auto timestamp = m_cluster->current_timestamp();
+            tbb::task_arena arena(static_cast<int>(std::min(m_batchGetConcurrency, batches)));
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, batches, 1),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                        for (size_t batch = range.begin(); batch != range.end(); ++batch)
+                        {
+                            auto snap = m_cluster->snapshot(timestamp);
+                            auto begin = batch * m_batchGetSize;
+                            batchGet(
+                                *snap, begin, std::min(begin + m_batchGetSize, realKeys.size()));
+                        }
+                    });
+            });
         }
-        auto decode = utcTime();
+        auto end = utcTime();
+        m_latencies.batchGet.observe(end - start);
         STORAGE_TIKV_LOG(DEBUG) << LOG_DESC("asyncGetRows") << LOG_KV("table", _table)
                                 << LOG_KV("count", entries.size())
-                                << LOG_KV("validCount", validCount)
-                                << LOG_KV("read time(ms)", end - start)
-                                << LOG_KV("decode time(ms)", decode - end);
+                                << LOG_KV("validCount", validCount) << LOG_KV("batches", batches)
+                                << LOG_KV("read time(ms)", end - start);
         _callback(nullptr, std::move(entries));
     }
     catch (const std::exception& e)
@@ -376,6 +413,7 @@ void TiKVStorage::asyncPrepare(const TwoPCParams& params, const TraverseStorageI
                     << LOG_DESC("asyncPrepare primary") << LOG_KV("blockNumber", params.number);
                 auto result = m_committer->prewrite_primary(primaryLock);
                 auto write = utcTime();
+                m_latencies.prewrite.observe(write - encode);
                 m_currentStartTS = result.second;
                 lock.unlock();
                 callback(nullptr, result.second, result.first);
@@ -395,6 +433,7 @@ void TiKVStorage::asyncPrepare(const TwoPCParams& params, const TraverseStorageI
                 m_currentStartTS = params.timestamp;
                 m_committer->prewrite_secondary(primaryLock, m_currentStartTS);
                 auto write = utcTime();
+                m_latencies.prewrite.observe(write - encode);
                 // m_committer = nullptr;
                 STORAGE_TIKV_LOG(INFO)
                     << "asyncPrepare secondary finished" << LOG_KV("blockNumber", params.number)
@@ -434,20 +473,24 @@ void TiKVStorage::asyncCommit(
             STORAGE_TIKV_LOG(INFO)
                 << LOG_DESC("asyncCommit") << LOG_KV("blockNumber", params.number)
                 << LOG_KV("timestamp", params.timestamp);
+            // at most one block is committing its secondary keys
+            waitForSecondaryCommit();
             auto start = utcTime();
             uint64_t timestamp = 0;
             if (m_committer)
             {
                 if (params.timestamp > 0)
                 {  // secondary
-                    m_committer->commit_secondary(params.timestamp);
                     m_lastCommittedTS = params.timestamp;
+                    commitSecondaryInBackground(
+                        std::move(m_committer), params.number, params.timestamp);
                 }
                 else
-                {  // primary
+                {  // primary, the block is committed once the primary key is committed
                     timestamp = m_committer->commit_primary();
-                    m_committer->commit_secondary(timestamp);
+                    m_latencies.commitPrimary.observe(utcTime() - start);
                     m_lastCommittedTS = timestamp;
+                    commitSecondaryInBackground(std::move(m_committer), params.number, timestamp);
                 }
                 m_committer = nullptr;
             }
@@ -637,6 +680,57 @@ bcos::Error::Ptr TiKVStorage::deleteRows(std::string_view table,
     return err;
 }
 
+void TiKVStorage::waitForSecondaryCommit()
+{
+    RecursiveGuard guard(x_committer);
+    if (m_secondaryCommit.valid())
+    {
+        m_secondaryCommit.get();
+    }
+}
+
+void TiKVStorage::commitSecondaryInBackground(std::shared_ptr<tikv_client::Transaction> _committer,
+    bcos::protocol::BlockNumber _number, uint64_t _commitTS)
+{
+    // the readers and the next prewrite resolve the locks of the uncommitted secondary keys by
+    // the committed primary key, so the failure only delays the cleanup
+    auto promise = std::make_shared<std::promise<void>>();
+    m_secondaryCommit = promise->get_future();
+    m_secondaryCommitter.enqueue(
+        [this, committer = std::move(_committer), _number, _commitTS, promise]() {
+            auto start = utcTime();
+            try
+            {
+                committer->commit_secondary(_commitTS);
+            }
+            catch (const std::exception& e)
+            {
+                STORAGE_TIKV_LOG(WARNING)
+                    << LOG_DESC("commit secondary failed") << LOG_KV("blockNumber", _number)
+                    << LOG_KV("commitTS", _commitTS) << LOG_KV("message", e.what());
+            }
+            auto end = utcTime();
+            m_latencies.commitSecondary.observe(end - start);
+            STORAGE_TIKV_LOG(DEBUG)
+                << LOG_DESC("commit secondary finished") << LOG_KV("blockNumber", _number)
+                << LOG_KV("commitTS", _commitTS) << LOG_KV("time(ms)", end - start);
+            if (++m_commitCount % LATENCY_LOG_INTERVAL == 0)
+            {
+                logPhaseLatencies();
+            }
+            promise->set_value();
+        });
+}
+
+void TiKVStorage::logPhaseLatencies()
+{
+    STORAGE_TIKV_LOG(INFO) << METRIC << LOG_DESC("phase latencies(ms)")
+                           << LOG_KV("batchGet", m_latencies.batchGet.toString())
+                           << LOG_KV("prewrite", m_latencies.prewrite.toString())
+                           << LOG_KV("commitPrimary", m_latencies.commitPrimary.toString())
+                           << LOG_KV("commitSecondary", m_latencies.commitSecondary.toString());
+}
+
 void TiKVStorage::triggerSwitch()
 {
     if (f_onNeedSwitchEvent)
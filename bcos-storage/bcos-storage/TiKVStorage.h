@@ -21,9 +21,13 @@
 
 #pragma once
 
+#include "LatencyHistogram.h"
 #include <bcos-framework/storage/StorageInterface.h>
 #include <bcos-utilities/Common.h>
+#include <bcos-utilities/ThreadPool.h>
+#include <algorithm>
 #include <atomic>
+#include <future>
 #include <memory>
 #include <utility>
 
@@ -47,8 +51,28 @@ class TiKVStorage : public TransactionalStorageInterface
 {
 public:
     using Ptr = std::shared_ptr<TiKVStorage>;
+    // the keys of asyncGetRows are read by BatchGet requests of at most DEFAULT_BATCH_GET_SIZE
+    // keys, at most DEFAULT_BATCH_GET_CONCURRENCY requests are in flight
+    constexpr static size_t DEFAULT_BATCH_GET_SIZE = 512;
+    constexpr static size_t DEFAULT_BATCH_GET_CONCURRENCY = 4;
+    // log the phase latencies every LATENCY_LOG_INTERVAL commits
+    constexpr static uint64_t LATENCY_LOG_INTERVAL = 100;
+
+    struct PhaseLatencies
+    {
+        LatencyHistogram batchGet;
+        LatencyHistogram prewrite;
+        LatencyHistogram commitPrimary;
+        LatencyHistogram commitSecondary;
+    };
+
     explicit TiKVStorage(
         std::shared_ptr<tikv_client::TransactionClient> _cluster, int32_t _commitTimeout = 3000);
+    ~TiKVStorage() override;
+    TiKVStorage(const TiKVStorage&) = delete;
+    TiKVStorage(TiKVStorage&&) = delete;
+    TiKVStorage& operator=(const TiKVStorage&) = delete;
+    TiKVStorage& operator=(TiKVStorage&&) = delete;
 
     void asyncGetPrimaryKeys(std::string_view _table,
         const std::optional<Condition const>& _condition,
@@ -94,9 +118,21 @@ public:
         f_onNeedSwitchEvent = std::move(_onNeedSwitchEvent);
     }
 
+    void setBatchGetLimit(size_t _batchSize, size_t _concurrency)
+    {
+        m_batchGetSize = std::max<size_t>(_batchSize, 1);
+        m_batchGetConcurrency = std::max<size_t>(_concurrency, 1);
+    }
+    const PhaseLatencies& phaseLatencies() const { return m_latencies; }
+    // wait for the secondary keys of the last committed block to be committed
+    void waitForSecondaryCommit();
+
 private:
     void triggerSwitch();
     std::shared_ptr<tikv_client::Snapshot> getSnapshot();
+    void commitSecondaryInBackground(std::shared_ptr<tikv_client::Transaction> _committer,
+        bcos::protocol::BlockNumber _number, uint64_t _commitTS);
+    void logPhaseLatencies();
 
     std::shared_ptr<tikv_client::TransactionClient> m_cluster;
     std::shared_ptr<tikv_client::Transaction> m_committer = nullptr;
@@ -107,5 +143,15 @@ private:
     int32_t m_commitTimeout = 3000;
     std::chrono::time_point<std::chrono::system_clock> m_committerCreateTime;
     mutable RecursiveMutex x_committer;
+
+    size_t m_batchGetSize = DEFAULT_BATCH_GET_SIZE;
+    size_t m_batchGetConcurrency = DEFAULT_BATCH_GET_CONCURRENCY;
+
+    PhaseLatencies m_latencies;
+    std::atomic_uint64_t m_commitCount = 0;
+
+    // the secondary keys of block N are committed while block N+1 is executed and prewritten
+    std::future<void> m_secondaryCommit;
+    bcos::ThreadPool m_secondaryCommitter;
 };
 }  // namespace bcos::storage
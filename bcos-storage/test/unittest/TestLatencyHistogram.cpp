@@ -0,0 +1,65 @@
+#include <bcos-storage/LatencyHistogram.h>
+#include <boost/test/unit_test.hpp>
+#include <thread>
+#include <vector>
+
+using namespace bcos::storage;
+
+BOOST_AUTO_TEST_SUITE(TestLatencyHistogram)
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+    LatencyHistogram histogram;
+    BOOST_CHECK_EQUAL(histogram.count(), 0U);
+    BOOST_CHECK_EQUAL(histogram.percentile(50), 0U);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), 0U);
+    BOOST_CHECK_EQUAL(histogram.toString(), "count=0,avg=0,p50=0,p99=0,max=0");
+}
+
+BOOST_AUTO_TEST_CASE(percentile)
+{
+    LatencyHistogram histogram;
+    for (auto latency : {0, 1, 2, 3, 100})
+    {
+        histogram.observe(latency);
+    }
+    BOOST_CHECK_EQUAL(histogram.count(), 5U);
+    BOOST_CHECK_EQUAL(histogram.sum(), 106U);
+    BOOST_CHECK_EQUAL(histogram.max(), 100U);
+    // the percentile is the upper bound of its bucket, capped by the max
+    BOOST_CHECK_EQUAL(histogram.percentile(0), 0U);
+    BOOST_CHECK_EQUAL(histogram.percentile(50), 3U);
+    BOOST_CHECK_EQUAL(histogram.percentile(99), 100U);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), 100U);
+    BOOST_CHECK_EQUAL(histogram.toString(), "count=5,avg=21,p50=3,p99=100,max=100");
+
+    // the last bucket counts everything above
+    histogram.observe(uint64_t(1) << 40);
+    BOOST_CHECK_EQUAL(histogram.max(), uint64_t(1) << 40);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), uint64_t(1) << 40);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentObserve)
+{
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&histogram, i]() {
+            for (uint64_t latency = 0; latency < 1000; ++latency)
+            {
+                histogram.observe(latency + i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(histogram.count(), 4000U);
+    BOOST_CHECK_EQUAL(histogram.max(), 1002U);
+    // 4 * (0 + ... + 999) + 1000 * (0 + 1 + 2 + 3)
+    BOOST_CHECK_EQUAL(histogram.sum(), 2004000U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -377,6 +377,63 @@ BOOST_AUTO_TEST_CASE(asyncGetRows)
     cleanupTestTableData();
 }
 
+BOOST_AUTO_TEST_CASE(pipelinedCommit)
+{
+    auto tikvStorage = std::dynamic_pointer_cast<TiKVStorage>(storage);
+    tikvStorage->setBatchGetLimit(64, 4);
+
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < total; ++i)
+    {
+        keys.push_back("key" + boost::lexical_cast<std::string>(i));
+    }
+    for (bcos::protocol::BlockNumber number = 1; number <= 3; ++number)
+    {
+        auto stateStorage = std::make_shared<bcos::storage::StateStorage>(storage, false);
+        auto testTable = stateStorage->openTable(testTableName);
+        BOOST_REQUIRE(testTable);
+        for (auto& key : keys)
+        {
+            Entry entry;
+            entry.importFields({"value_" + std::to_string(number) + "_" + key});
+            testTable->setRow(key, std::move(entry));
+        }
+        auto params = bcos::protocol::TwoPCParams();
+        params.number = number;
+        params.primaryKey = testTableName + ":key0";
+        storage->asyncPrepare(
+            params, *stateStorage, [&](Error::Ptr error, uint64_t ts, const std::string&) {
+                BOOST_CHECK_EQUAL(error.get(), nullptr);
+                BOOST_CHECK_NE(ts, 0);
+            });
+        params.timestamp = 0;
+        storage->asyncCommit(
+            params, [&](Error::Ptr error, uint64_t) { BOOST_CHECK_EQUAL(error, nullptr); });
+
+        // the secondary keys may still be committing, the reads resolve them by the primary key
+        storage->asyncGetRows(testTableName, keys,
+            [&](Error::UniquePtr error, std::vector<std::optional<Entry>> entries) {
+                BOOST_CHECK_EQUAL(error.get(), nullptr);
+                BOOST_REQUIRE_EQUAL(entries.size(), keys.size());
+                for (size_t i = 0; i < keys.size(); ++i)
+                {
+                    BOOST_REQUIRE(entries[i]);
+                    BOOST_CHECK_EQUAL(
+                        entries[i]->get(), "value_" + std::to_string(number) + "_" + keys[i]);
+                }
+            });
+    }
+    tikvStorage->waitForSecondaryCommit();
+
+    auto const& latencies = tikvStorage->phaseLatencies();
+    BOOST_CHECK_EQUAL(latencies.prewrite.count(), 3U);
+    BOOST_CHECK_EQUAL(latencies.commitPrimary.count(), 3U);
+    BOOST_CHECK_EQUAL(latencies.commitSecondary.count(), 3U);
+    BOOST_CHECK_GE(latencies.batchGet.count(), 3U);
+
+    cleanupTestTableData();
+}
+
 BOOST_AUTO_TEST_CASE(asyncPrepare)
 {
     prepareTestTableData();
@@ -0,0 +1,361 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the compact encoding of the pages and table metas of KeyPageStorage
+ * @file KeyPageCodec.cpp
+ * @date: 2026-10-19
+ */
+#include "KeyPageCodec.h"
+#include <bcos-framework/storage/Common.h>
+#include <bcos-utilities/Error.h>
+#include <bcos-utilities/ZstdCompress.h>
+#include <boost/throw_exception.hpp>
+#include <algorithm>
+
+using namespace bcos;
+using namespace bcos::storage;
+
+namespace
+{
+constexpr uint8_t MAGIC = 0xFF;
+constexpr size_t MAGIC_SIZE = 4;
+
+void putFixed32(std::string& _out, uint32_t _value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        _out.push_back(static_cast<char>((_value >> (8 * i)) & 0xFF));
+    }
+}
+
+void putFixed16(std::string& _out, uint16_t _value)
+{
+    _out.push_back(static_cast<char>(_value & 0xFF));
+    _out.push_back(static_cast<char>((_value >> 8) & 0xFF));
+}
+
+void putVarint(std::string& _out, uint64_t _value)
+{
+    while (_value >= 0x80)
+    {
+        _out.push_back(static_cast<char>((_value & 0x7F) | 0x80));
+        _value >>= 7;
+    }
+    _out.push_back(static_cast<char>(_value));
+}
+
+[[noreturn]] void throwCorrupted(std::string_view _reason)
+{
+    BOOST_THROW_EXCEPTION(
+        BCOS_ERROR(StorageError::ReadError, "Corrupted key page: " + std::string(_reason)));
+}
+
+uint32_t getFixed32(std::string_view _in, size_t _offset)
+{
+    if (_offset + 4 > _in.size())
+    {
+        throwCorrupted("truncated fixed32");
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(_in[_offset + i])) << (8 * i);
+    }
+    return value;
+}
+
+uint16_t getFixed16(std::string_view _in, size_t& _offset)
+{
+    if (_offset + 2 > _in.size())
+    {
+        throwCorrupted("truncated fixed16");
+    }
+    auto value = static_cast<uint16_t>(static_cast<uint8_t>(_in[_offset]) |
+                                       (static_cast<uint8_t>(_in[_offset + 1]) << 8));
+    _offset += 2;
+    return value;
+}
+
+uint64_t getVarint(std::string_view _in, size_t& _offset)
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (_offset >= _in.size())
+        {
+            break;
+        }
+        auto byte = static_cast<uint8_t>(_in[_offset++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    throwCorrupted("truncated varint");
+}
+
+std::string_view getBytes(std::string_view _in, size_t& _offset, uint64_t _size)
+{
+    if (_size > _in.size() - std::min(_offset, _in.size()))
+    {
+        throwCorrupted("truncated bytes");
+    }
+    auto bytes = _in.substr(_offset, _size);
+    _offset += _size;
+    return bytes;
+}
+
+size_t sharedPrefix(std::string_view _lhs, std::string_view _rhs)
+{
+    auto [lhsIt, rhsIt] = std::mismatch(_lhs.begin(), _lhs.end(), _rhs.begin(), _rhs.end());
+    return lhsIt - _lhs.begin();
+}
+}  // namespace
+
+bool KeyPageCodec::isCompact(std::string_view _value)
+{
+    return _value.size() >= HEADER_SIZE &&
+           std::all_of(_value.begin(), _value.begin() + MAGIC_SIZE,
+               [](char _byte) { return static_cast<uint8_t>(_byte) == MAGIC; });
+}
+
+std::string KeyPageCodec::finish(std::string _body, bool _compress)
+{
+    std::string value;
+    value.append(MAGIC_SIZE, static_cast<char>(MAGIC));
+    value.push_back(static_cast<char>(VERSION));
+    if (_compress)
+    {
+        bytes compressed;
+        if (ZstdCompress::compress(
+                bytesConstRef((const byte*)_body.data(), _body.size()), compressed,
+                COMPRESSION_LEVEL) &&
+            compressed.size() + 4 < _body.size())
+        {
+            value.push_back(static_cast<char>(COMPRESSED));
+            value.reserve(value.size() + 4 + compressed.size());
+            putFixed32(value, static_cast<uint32_t>(_body.size()));
+            value.append((const char*)compressed.data(), compressed.size());
+            return value;
+        }
+    }
+    value.push_back(0);
+    value.append(_body);
+    return value;
+}
+
+std::string_view KeyPageCodec::body(std::string_view _value, std::string& _buffer)
+{
+    if (!isCompact(_value))
+    {
+        throwCorrupted("invalid header");
+    }
+    auto version = static_cast<uint8_t>(_value[MAGIC_SIZE]);
+    if (version != VERSION)
+    {
+        throwCorrupted("unsupported version " + std::to_string(version));
+    }
+    auto flags = static_cast<uint8_t>(_value[MAGIC_SIZE + 1]);
+    auto payload = _value.substr(HEADER_SIZE);
+    if ((flags & COMPRESSED) == 0)
+    {
+        return payload;
+    }
+    auto rawSize = getFixed32(payload, 0);
+    bytes raw;
+    if (!ZstdCompress::uncompress(
+            bytesConstRef((const byte*)payload.data() + 4, payload.size() - 4), raw) ||
+        raw.size() != rawSize)
+    {
+        throwCorrupted("uncompress failed");
+    }
+    _buffer.assign((const char*)raw.data(), raw.size());
+    return _buffer;
+}
+
+std::string KeyPageCodec::encodePage(std::vector<PageEntry> const& _entries, bool _compress)
+{
+    std::string body;
+    size_t reserve = 4 + (_entries.size() / RESTART_INTERVAL + 2) * 4;
+    for (auto const& [key, value] : _entries)
+    {
+        reserve += key.size() + value.size() + 6;
+    }
+    body.reserve(reserve);
+
+    putFixed32(body, static_cast<uint32_t>(_entries.size()));
+    std::vector<uint32_t> restarts;
+    restarts.reserve(_entries.size() / RESTART_INTERVAL + 1);
+    std::string_view lastKey;
+    for (size_t i = 0; i < _entries.size(); ++i)
+    {
+        auto const& [key, value] = _entries[i];
+        size_t shared = 0;
+        if (i % RESTART_INTERVAL == 0)
+        {
+            restarts.push_back(static_cast<uint32_t>(body.size()));
+        }
+        else
+        {
+            shared = sharedPrefix(lastKey, key);
+        }
+        putVarint(body, shared);
+        putVarint(body, key.size() - shared);
+        putVarint(body, value.size());
+        body.append(key.substr(shared));
+        body.append(value);
+        lastKey = key;
+    }
+    for (auto offset : restarts)
+    {
+        putFixed32(body, offset);
+    }
+    putFixed32(body, static_cast<uint32_t>(restarts.size()));
+    return finish(std::move(body), _compress);
+}
+
+std::string KeyPageCodec::encodeTableMeta(std::vector<PageInfoView> const& _pages, bool _compress)
+{
+    std::string body;
+    putFixed32(body, static_cast<uint32_t>(_pages.size()));
+    std::string_view lastKey;
+    for (auto const& [pageKey, count, size] : _pages)
+    {
+        auto shared = sharedPrefix(lastKey, pageKey);
+        putVarint(body, shared);
+        putVarint(body, pageKey.size() - shared);
+        body.append(pageKey.substr(shared));
+        putFixed16(body, count);
+        putFixed16(body, size);
+        lastKey = pageKey;
+    }
+    return finish(std::move(body), _compress);
+}
+
+std::vector<KeyPageCodec::PageInfoEntry> KeyPageCodec::decodeTableMeta(std::string_view _value)
+{
+    std::string buffer;
+    auto input = body(_value, buffer);
+    auto count = getFixed32(input, 0);
+    size_t offset = 4;
+    std::vector<PageInfoEntry> pages;
+    pages.reserve(std::min<size_t>(count, input.size()));
+    std::string_view lastKey;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        auto shared = getVarint(input, offset);
+        auto unshared = getVarint(input, offset);
+        if (shared > lastKey.size())
+        {
+            throwCorrupted("invalid shared prefix");
+        }
+        std::string pageKey;
+        pageKey.reserve(shared + unshared);
+        pageKey.append(lastKey.substr(0, shared));
+        pageKey.append(getBytes(input, offset, unshared));
+        auto pageCount = getFixed16(input, offset);
+        auto pageSize = getFixed16(input, offset);
+        pages.emplace_back(std::move(pageKey), pageCount, pageSize);
+        lastKey = std::get<0>(pages.back());
+    }
+    return pages;
+}
+
+KeyPageCodec::PageView::PageView(std::string_view _value) : m_body(body(_value, m_buffer))
+{
+    m_count = getFixed32(m_body, 0);
+    if (m_body.size() < ENTRIES_OFFSET + 4)
+    {
+        throwCorrupted("truncated page");
+    }
+    m_restarts = getFixed32(m_body, m_body.size() - 4);
+    auto restartsSize = static_cast<uint64_t>(m_restarts) * 4 + 4;
+    if (restartsSize > m_body.size() - ENTRIES_OFFSET ||
+        m_restarts != (m_count + RESTART_INTERVAL - 1) / RESTART_INTERVAL)
+    {
+        throwCorrupted("invalid restart array");
+    }
+    m_restartsOffset = m_body.size() - restartsSize;
+}
+
+std::string_view KeyPageCodec::PageView::readEntry(size_t& _offset, std::string& _key) const
+{
+    auto entries = m_body.substr(0, m_restartsOffset);
+    auto shared = getVarint(entries, _offset);
+    auto unshared = getVarint(entries, _offset);
+    auto valueSize = getVarint(entries, _offset);
+    if (shared > _key.size())
+    {
+        throwCorrupted("invalid shared prefix");
+    }
+    _key.resize(shared);
+    _key.append(getBytes(entries, _offset, unshared));
+    return getBytes(entries, _offset, valueSize);
+}
+
+std::string_view KeyPageCodec::PageView::restartKey(uint32_t _index) const
+{
+    size_t offset = getFixed32(m_body, m_restartsOffset + static_cast<size_t>(_index) * 4);
+    auto entries = m_body.substr(0, m_restartsOffset);
+    auto shared = getVarint(entries, offset);
+    auto unshared = getVarint(entries, offset);
+    getVarint(entries, offset);
+    if (shared != 0)
+    {
+        throwCorrupted("prefix compressed restart key");
+    }
+    return getBytes(entries, offset, unshared);
+}
+
+std::optional<std::string_view> KeyPageCodec::PageView::find(std::string_view _key) const
+{
+    if (m_count == 0)
+    {
+        return std::nullopt;
+    }
+    // the last restart whose key <= _key
+    uint32_t left = 0;
+    uint32_t right = m_restarts;
+    while (right - left > 1)
+    {
+        auto middle = left + (right - left) / 2;
+        if (restartKey(middle) <= _key)
+        {
+            left = middle;
+        }
+        else
+        {
+            right = middle;
+        }
+    }
+
+    size_t offset = getFixed32(m_body, m_restartsOffset + static_cast<size_t>(left) * 4);
+    auto end = std::min<size_t>(m_count, (static_cast<size_t>(left) + 1) * RESTART_INTERVAL);
+    std::string key;
+    for (auto i = static_cast<size_t>(left) * RESTART_INTERVAL; i < end; ++i)
+    {
+        auto value = readEntry(offset, key);
+        if (key == _key)
+        {
+            return value;
+        }
+        if (key > _key)
+        {
+            break;
+        }
+    }
+    return std::nullopt;
+}
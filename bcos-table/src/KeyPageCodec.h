@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the compact encoding of the pages and table metas of KeyPageStorage
+ * @file KeyPageCodec.h
+ * @date: 2026-10-19
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace bcos::storage
+{
+enum class KeyPageFormat : uint8_t
+{
+    // boost binary archive, the format of the existing data
+    ARCHIVE = 0,
+    COMPACT = 1,
+    // compact and compressed with zstd if it is smaller
+    COMPACT_COMPRESSED = 2,
+};
+
+/**
+ * The compact format:
+ *   header: [0xFFFFFFFF][version(1B)][flags(1B)]
+ *   body, or [rawSize(4B)][zstd(body)] with the COMPRESSED flag
+ * page body:
+ *   [count(4B)][entry]...[restart offset(4B)]...[restart count(4B)]
+ *   entry: [shared(varint)][unshared(varint)][valueSize(varint)][key suffix][value]
+ *   the key of every RESTART_INTERVAL entries is not prefix compressed (shared = 0) and its
+ *   offset is in the restart array, a lookup binary searches the restarts then scans one interval
+ * table meta body:
+ *   [count(4B)][pageInfo]...
+ *   pageInfo: [shared(varint)][unshared(varint)][key suffix][count(2B)][size(2B)]
+ *
+ * The archive of a page starts with the valid count and the archive of a table meta starts with
+ * the page count, neither of them can be 0xFFFFFFFF, so the decoder tells the formats apart by
+ * the header. Integers are little endian.
+ */
+class KeyPageCodec
+{
+public:
+    constexpr static uint8_t VERSION = 1;
+    constexpr static size_t HEADER_SIZE = 6;
+    constexpr static size_t RESTART_INTERVAL = 16;
+    constexpr static int COMPRESSION_LEVEL = 1;
+
+    enum Flag : uint8_t
+    {
+        COMPRESSED = 0x1,
+    };
+
+    using PageEntry = std::pair<std::string_view, std::string_view>;
+    // pageKey, count, size
+    using PageInfoEntry = std::tuple<std::string, uint16_t, uint16_t>;
+    using PageInfoView = std::tuple<std::string_view, uint16_t, uint16_t>;
+
+    static bool isCompact(std::string_view _value);
+
+    // the entries must be sorted by key
+    static std::string encodePage(std::vector<PageEntry> const& _entries, bool _compress);
+    static std::string encodeTableMeta(std::vector<PageInfoView> const& _pages, bool _compress);
+    static std::vector<PageInfoEntry> decodeTableMeta(std::string_view _value);
+
+    // read the encoded page without decoding all the entries
+    class PageView
+    {
+    public:
+        explicit PageView(std::string_view _value);
+        // m_body may refer to m_buffer
+        PageView(const PageView&) = delete;
+        PageView(PageView&&) = delete;
+        PageView& operator=(const PageView&) = delete;
+        PageView& operator=(PageView&&) = delete;
+        ~PageView() = default;
+
+        size_t size() const { return m_count; }
+        std::optional<std::string_view> find(std::string_view _key) const;
+        // _onEntry(key, value) in key order
+        template <class OnEntry>
+        void forEach(OnEntry&& _onEntry) const
+        {
+            std::string key;
+            auto offset = ENTRIES_OFFSET;
+            for (uint32_t i = 0; i < m_count; ++i)
+            {
+                auto value = readEntry(offset, key);
+                _onEntry(std::string_view(key), value);
+            }
+        }
+
+    private:
+        constexpr static size_t ENTRIES_OFFSET = 4;
+        // read the entry at _offset into _key, return the value and move _offset to the next
+        std::string_view readEntry(size_t& _offset, std::string& _key) const;
+        std::string_view restartKey(uint32_t _index) const;
+
+        std::string m_buffer;
+        std::string_view m_body;
+        uint32_t m_count = 0;
+        uint32_t m_restarts = 0;
+        size_t m_restartsOffset = 0;
+    };
+
+private:
+    static std::string finish(std::string _body, bool _compress);
+    static std::string_view body(std::string_view _value, std::string& _buffer);
+};
+}  // namespace bcos::storage
@@ -257,7 +257,7 @@ void KeyPageStorage::parallelTraverse(bool onlyDirty,
                         {
                             auto* meta = it.second->getTableMeta();
                             Entry entry;
-                            entry.setObject(*meta);
+                            encodeObject(entry, *meta);
                             m_size += entry.size();
                             if (!m_readOnly)
                             {
@@ -301,7 +301,7 @@ void KeyPageStorage::parallelTraverse(bool onlyDirty,
                             }
                             else
                             {
-                                entry.setObject(*page);
+                                encodeObject(entry, *page);
                                 m_size += entry.size();
                                 entry.setStatus(it.second->entry.status());
                                 if (!m_readOnly)
@@ -707,7 +707,7 @@ auto KeyPageStorage::getEntryFromPage(std::string_view table, std::string_view k
             if (data.value()->entry.dirty())
             {
                 Entry entry;
-                entry.setObject(*meta);
+                encodeObject(entry, *meta);
                 entry.setStatus(data.value()->entry.status());
                 return std::make_pair(nullptr, std::move(entry));
             }
@@ -780,7 +780,7 @@ auto KeyPageStorage::getEntryFromPage(std::string_view table, std::string_view k
                         << LOG_KV("dirty", data.value()->entry.dirty());
                 }
                 Entry entry;
-                entry.setObject(*page);
+                encodeObject(entry, *page);
                 entry.setStatus(pageData->entry.status());
                 return std::make_pair(nullptr, std::move(entry));
             }
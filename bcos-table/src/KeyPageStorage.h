@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include "KeyPageCodec.h"
 #include "StateStorageInterface.h"
 #include <boost/archive/basic_archive.hpp>
 #include <boost/archive/binary_iarchive.hpp>
@@ -146,6 +147,10 @@ public:
 
     void rollback(const Recoder& recoder) override;
 
+    // the format to write the pages and table metas, the reader accepts all the formats
+    void setPageFormat(KeyPageFormat _format) { m_pageFormat = _format; }
+    KeyPageFormat pageFormat() const { return m_pageFormat; }
+
     struct Data;
     class PageInfo
     {  // all methods is not thread safe
@@ -178,6 +183,14 @@ public:
             }
             return {};
         }
+        [[nodiscard]] auto pageKeyView() const -> std::string_view
+        {
+            if (m_data)
+            {
+                return m_data->pageKey;
+            }
+            return {};
+        }
         void setCount(uint16_t _count)
         {
             prepareMyData();
@@ -262,6 +275,17 @@ public:
             {
                 return;
             }
+            if (KeyPageCodec::isCompact(value))
+            {
+                auto pageInfos = KeyPageCodec::decodeTableMeta(value);
+                pages = std::make_unique<std::vector<PageInfo>>();
+                pages->reserve(pageInfos.size());
+                for (auto& [pageKey, count, size] : pageInfos)
+                {
+                    pages->emplace_back(std::move(pageKey), count, size, nullptr);
+                }
+                return;
+            }
             boost::iostreams::stream<boost::iostreams::array_source> inputStream(
                 value.data(), value.size());
             boost::archive::binary_iarchive archive(inputStream, ARCHIVE_FLAG);
@@ -498,6 +522,19 @@ public:
             return it != pages->end() && it->getPageKey() == pageKey;
         }
 
+        std::string encode(bool compress) const
+        {
+            auto writeLock = cleanBeforeEncode();
+            std::vector<KeyPageCodec::PageInfoView> pageInfos;
+            pageInfos.reserve(pages->size());
+            for (const auto& pageInfo : *pages)
+            {
+                pageInfos.emplace_back(
+                    pageInfo.pageKeyView(), pageInfo.getCount(), pageInfo.getSize());
+            }
+            return KeyPageCodec::encodeTableMeta(pageInfos, compress);
+        }
+
     private:
         uint32_t getPageInfoCount = 0;
         uint32_t hit = 0;
@@ -506,20 +543,9 @@ public:
         std::unique_ptr<std::vector<PageInfo>> pages = nullptr;
         friend class boost::serialization::access;
         size_t lastPageInfoIndex = 0;
-        template <class Archive>
-        void save(Archive& ar, const unsigned int version) const
+        // drop the empty pages before encoding, return the lock held during encoding
+        [[nodiscard]] std::unique_lock<std::shared_mutex> cleanBeforeEncode() const
         {
-            std::ignore = version;
-            // auto len = (uint32_t)pages->size();
-            // ar& len;
-            // for (size_t i = 0; i < pages->size(); ++i)
-            // {
-            //     if (pages->at(i).getCount() == 0)
-            //     {
-            //         continue;
-            //     }
-            //     ar & pages->at(i);
-            // }
             int invalid = 0;
             m_rows = 0;
             auto writeLock = lock();
@@ -540,9 +566,26 @@ public:
                     ++it;
                 }
             }
-            ar << *pages;
             KeyPage_LOG(DEBUG) << LOG_DESC("Serialize meta") << LOG_KV("valid", pages->size())
                                << LOG_KV("invalid", invalid);
+            return writeLock;
+        }
+        template <class Archive>
+        void save(Archive& ar, const unsigned int version) const
+        {
+            std::ignore = version;
+            // auto len = (uint32_t)pages->size();
+            // ar& len;
+            // for (size_t i = 0; i < pages->size(); ++i)
+            // {
+            //     if (pages->at(i).getCount() == 0)
+            //     {
+            //         continue;
+            //     }
+            //     ar & pages->at(i);
+            // }
+            auto writeLock = cleanBeforeEncode();
+            ar << *pages;
         }
         template <class Archive>
         void load(Archive& ar, const unsigned int version)
@@ -571,10 +614,17 @@ public:
             {
                 return;
             }
-            boost::iostreams::stream<boost::iostreams::array_source> inputStream(
-                value.data(), value.size());
-            boost::archive::binary_iarchive archive(inputStream, ARCHIVE_FLAG);
-            archive >> *this;
+            if (KeyPageCodec::isCompact(value))
+            {
+                decodeCompact(value);
+            }
+            else
+            {
+                boost::iostreams::stream<boost::iostreams::array_source> inputStream(
+                    value.data(), value.size());
+                boost::archive::binary_iarchive archive(inputStream, ARCHIVE_FLAG);
+                archive >> *this;
+            }
             if (pageKey != entries.rbegin()->first)
             {
                 KeyPage_LOG(INFO) << LOG_DESC("load page with invalid pageKey")
@@ -1008,6 +1058,21 @@ public:
                 }
             }
         }
+        std::string encode(bool compress) const
+        {
+            std::vector<KeyPageCodec::PageEntry> validEntries;
+            validEntries.reserve(m_validCount);
+            for (const auto& i : entries)
+            {
+                if (i.second.status() == Entry::Status::DELETED)
+                {  // skip deleted entry
+                    continue;
+                }
+                validEntries.emplace_back(i.first, i.second.get());
+            }
+            assert(validEntries.size() == m_validCount);
+            return KeyPageCodec::encodePage(validEntries, compress);
+        }
         auto lock() -> std::unique_lock<std::shared_mutex> { return std::unique_lock(mutex); }
         auto rLock() -> std::shared_lock<std::shared_mutex> { return std::shared_lock(mutex); }
         void setTableMeta(TableMeta* _meta) { m_meta = _meta; }
@@ -1024,6 +1089,22 @@ public:
         std::set<std::string> m_invalidPageKeys;
         TableMeta* m_meta = nullptr;
 
+        void decodeCompact(std::string_view value)
+        {
+            KeyPageCodec::PageView view(value);
+            m_validCount = view.size();
+            view.forEach([this](std::string_view key, std::string_view data) {
+                m_size += data.size();
+                m_size += key.size();
+                auto buffer = std::make_shared<std::vector<uint8_t>>(data.begin(), data.end());
+                Entry e;
+                e.setPointer(std::move(buffer));
+                e.setStatus(Entry::Status::NORMAL);
+                // the keys are sorted
+                entries.emplace_hint(entries.end(), std::string(key), std::move(e));
+            });
+        }
+
         template <class Archive>
         void save(Archive& ar, const unsigned int version) const
         {
@@ -1204,6 +1285,16 @@ public:
     virtual std::pair<size_t, Error::Ptr> count(const std::string_view& table) override;
 
 private:
+    template <class Object>
+    void encodeObject(Entry& entry, const Object& object) const
+    {
+        if (m_pageFormat == KeyPageFormat::ARCHIVE)
+        {
+            entry.setObject(object);
+            return;
+        }
+        entry.setField(0, object.encode(m_pageFormat == KeyPageFormat::COMPACT_COMPRESSED));
+    }
     auto getPrev() -> std::shared_ptr<StorageInterface>
     {
         std::shared_lock<std::shared_mutex> lock(m_prevMutex);
@@ -1307,6 +1398,7 @@ private:
         std::string_view table, std::string_view key);
     Error::UniquePtr setEntryToPage(std::string table, std::string key, Entry entry);
     uint32_t m_blockVersion = 0;
+    KeyPageFormat m_pageFormat = KeyPageFormat::ARCHIVE;
     size_t m_pageSize = 8 * 1024;
     size_t m_splitSize;
     size_t m_mergeSize;
@@ -38,6 +38,8 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 #include <mutex>
+#include <shared_mutex>
+#include <typeinfo>
 
 namespace bcos::storage
 {
@@ -70,27 +72,29 @@ public:
 
         if (m_enableTraverse)
         {
-            std::mutex mergeMutex;
+            // collect the keys of every bucket under its shared lock, then merge them
+            std::vector<decltype(localKeys)> bucketKeys(m_buckets.size());
             tbb::parallel_for(tbb::blocked_range<size_t>(0U, m_buckets.size()),
-                [this, &mergeMutex, &localKeys, &table, &condition](auto const& range) {
+                [this, &bucketKeys, &table, &condition](auto const& range) {
                     for (auto i = range.begin(); i < range.end(); ++i)
                     {
                         auto& bucket = m_buckets[i];
-                        std::unique_lock<std::mutex> lock(bucket.mutex);
+                        std::shared_lock lock(bucket.mutex);
 
-                        decltype(localKeys) bucketKeys;
                         for (auto& it : bucket.container)
                         {
                             if (it.table == table && (!condition || condition->isValid(it.key)))
                             {
-                                bucketKeys.emplace(it.key, it.entry.status());
+                                bucketKeys[i].emplace(it.key, it.entry.status());
                             }
                         }
-
-                        std::unique_lock mergeLock(mergeMutex);
-                        localKeys.merge(std::move(bucketKeys));
                     }
                 });
+            // the buckets are disjoint
+            for (auto& keys : bucketKeys)
+            {
+                localKeys.merge(std::move(keys));
+            }
         }
 
         auto prev = getPrev();
@@ -157,7 +161,7 @@ public:
     void asyncGetRow(std::string_view tableView, std::string_view keyView,
         std::function<void(Error::UniquePtr, std::optional<Entry>)> _callback) override
     {
-        auto [bucket, lock] = getBucket(tableView, keyView);
+        auto [bucket, lock] = getReadBucket(tableView, keyView);
         boost::ignore_unused(lock);
 
         auto it = bucket->container.template get<0>().find(std::make_tuple(tableView, keyView));
@@ -234,7 +238,7 @@ public:
 
         for (auto i = 0U; i < keys.size(); ++i)
         {
-            auto [bucket, lock] = getBucket(tableView, keys[i]);
+            auto [bucket, lock] = getReadBucket(tableView, keys[i]);
             boost::ignore_unused(lock);
 
             auto it = bucket->container.find(std::make_tuple(tableView, std::string_view(keys[i])));
@@ -310,42 +314,8 @@ public:
             return;
         }
 
-        ssize_t updatedCapacity = entry.size();
-        std::optional<Entry> entryOld;
-
-        if (m_setRowWithDirtyFlag && entry.status() == Entry::NORMAL)
-        {
-            entry.setStatus(Entry::MODIFIED);
-        }
         auto [bucket, lock] = getBucket(tableView, keyView);
-        auto it = bucket->container.find(std::make_tuple(tableView, keyView));
-        if (it != bucket->container.end())
-        {
-            auto& existsEntry = it->entry;
-            entryOld.emplace(std::move(existsEntry));
-
-            updatedCapacity -= entryOld->size();
-
-            bucket->container.modify(it, [&entry](Data& data) { data.entry = std::move(entry); });
-        }
-        else
-        {
-            auto [iter, _] = bucket->container.emplace(
-                Data{std::string(tableView), std::string(keyView), std::move(entry)});
-            it = iter;
-        }
-        if constexpr (enableLRU)
-        {
-            updateMRUAndCheck(*bucket, it);
-        }
-
-        if (m_recoder.local())
-        {
-            m_recoder.local()->log(
-                Recoder::Change(std::string(tableView), std::string(keyView), std::move(entryOld)));
-        }
-
-        bucket->capacity += updatedCapacity;
+        setRowNoLock(*bucket, tableView, keyView, std::move(entry));
 
         lock.unlock();
         callback(nullptr);
@@ -382,6 +352,23 @@ public:
             BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Can't merge from self!"));
         }
 
+        if (m_readOnly)
+        {
+            return;
+        }
+
+        // the subclasses may override parallelTraverse, only merge the exact types by bucket
+        if (typeid(source) == typeid(BaseStorage<false>) &&
+            mergeBuckets(onlyDirty, dynamic_cast<const BaseStorage<false>&>(source)))
+        {
+            return;
+        }
+        if (typeid(source) == typeid(BaseStorage<true>) &&
+            mergeBuckets(onlyDirty, dynamic_cast<const BaseStorage<true>&>(source)))
+        {
+            return;
+        }
+
         std::atomic_size_t count = 0;
         source.parallelTraverse(
             onlyDirty, [this, &count](const std::string_view& table, const std::string_view& key,
@@ -518,6 +505,47 @@ public:
     void setMaxCapacity(ssize_t capacity) { m_maxCapacity = capacity; }
 
 private:
+    template <bool>
+    friend class BaseStorage;
+
+    // merge bucket by bucket in parallel, every bucket of this storage is locked once, the keys
+    // of a source bucket are in the same bucket of this storage if the bucket counts are equal
+    template <bool sourceEnableLRU>
+    bool mergeBuckets(bool onlyDirty, const BaseStorage<sourceEnableLRU>& source)
+    {
+        if (source.m_buckets.size() != m_buckets.size())
+        {
+            return false;
+        }
+
+        std::atomic_size_t count = 0;
+        std::lock_guard<std::mutex> sourceLock(source.x_cacheMutex);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0U, m_buckets.size()),
+            [this, &source, &onlyDirty, &count](auto const& range) {
+                for (auto i = range.begin(); i < range.end(); ++i)
+                {
+                    auto& sourceBucket = source.m_buckets[i];
+                    std::shared_lock sourceBucketLock(sourceBucket.mutex);
+                    auto& bucket = m_buckets[i];
+                    std::unique_lock lock(bucket.mutex);
+
+                    size_t bucketCount = 0;
+                    for (auto& it : sourceBucket.container)
+                    {
+                        if (!onlyDirty || it.entry.dirty())
+                        {
+                            setRowNoLock(bucket, it.table, it.key, it.entry);
+                            ++bucketCount;
+                        }
+                    }
+                    count += bucketCount;
+                }
+            });
+
+        STORAGE_LOG(INFO) << "Successful merged records" << LOG_KV("count", count);
+        return true;
+    }
+
     Entry importExistingEntry(std::string_view table, std::string_view key, Entry entry)
     {
         if (m_readOnly)
@@ -588,22 +616,78 @@ private:
     struct Bucket
     {
         Container container;
-        std::mutex mutex;
+        mutable std::shared_mutex mutex;
         ssize_t capacity = 0;
     };
+    // the reads of LRUStateStorage update the MRU list, so they need the exclusive lock
+    using ReadLock = std::conditional_t<enableLRU, std::unique_lock<std::shared_mutex>,
+        std::shared_lock<std::shared_mutex>>;
     uint32_t m_blockVersion = 0;
     std::vector<Bucket> m_buckets;
     bool m_setRowWithDirtyFlag = false;
 
-    std::tuple<Bucket*, std::unique_lock<std::mutex>> getBucket(
-        const std::string_view& table, const std::string_view& key)
+    Bucket& bucketOf(const std::string_view& table, const std::string_view& key)
     {
         auto hash = std::hash<std::string_view>{}(table);
         boost::hash_combine(hash, std::hash<std::string_view>{}(key));
         auto index = hash % m_buckets.size();
 
-        auto& bucket = m_buckets[index];
-        return std::make_tuple(&bucket, std::unique_lock<std::mutex>(bucket.mutex));
+        return m_buckets[index];
+    }
+
+    std::tuple<Bucket*, std::unique_lock<std::shared_mutex>> getBucket(
+        const std::string_view& table, const std::string_view& key)
+    {
+        auto& bucket = bucketOf(table, key);
+        return std::make_tuple(&bucket, std::unique_lock<std::shared_mutex>(bucket.mutex));
+    }
+
+    std::tuple<Bucket*, ReadLock> getReadBucket(
+        const std::string_view& table, const std::string_view& key)
+    {
+        auto& bucket = bucketOf(table, key);
+        return std::make_tuple(&bucket, ReadLock(bucket.mutex));
+    }
+
+    // the caller holds the exclusive lock of the bucket
+    void setRowNoLock(Bucket& bucket, std::string_view tableView, std::string_view keyView,
+        Entry entry)
+    {
+        ssize_t updatedCapacity = entry.size();
+        std::optional<Entry> entryOld;
+
+        if (m_setRowWithDirtyFlag && entry.status() == Entry::NORMAL)
+        {
+            entry.setStatus(Entry::MODIFIED);
+        }
+        auto it = bucket.container.find(std::make_tuple(tableView, keyView));
+        if (it != bucket.container.end())
+        {
+            auto& existsEntry = it->entry;
+            entryOld.emplace(std::move(existsEntry));
+
+            updatedCapacity -= entryOld->size();
+
+            bucket.container.modify(it, [&entry](Data& data) { data.entry = std::move(entry); });
+        }
+        else
+        {
+            auto [iter, _] = bucket.container.emplace(
+                Data{std::string(tableView), std::string(keyView), std::move(entry)});
+            it = iter;
+        }
+        if constexpr (enableLRU)
+        {
+            updateMRUAndCheck(bucket, it);
+        }
+
+        if (m_recoder.local())
+        {
+            m_recoder.local()->log(
+                Recoder::Change(std::string(tableView), std::string(keyView), std::move(entryOld)));
+        }
+
+        bucket.capacity += updatedCapacity;
     }
 
     void updateMRUAndCheck(
@@ -93,16 +93,22 @@ public:
                                << LOG_KV("keyPageIgnoreTables size",
                                       keyPageIgnoreTables == nullptr ? 0 :
                                                                        keyPageIgnoreTables->size());
-            return std::make_shared<bcos::storage::KeyPageStorage>(storage, setRowWithDirtyFlag,
-                m_keyPageSize, compatibilityVersion, keyPageIgnoreTables, ignoreNotExist);
+            auto keyPageStorage = std::make_shared<bcos::storage::KeyPageStorage>(storage,
+                setRowWithDirtyFlag, m_keyPageSize, compatibilityVersion, keyPageIgnoreTables,
+                ignoreNotExist);
+            keyPageStorage->setPageFormat(m_keyPageFormat);
+            return keyPageStorage;
         }
 
         // Pass useHashV310 flag to hash() insted of compatibilityVersion
         return std::make_shared<bcos::storage::StateStorage>(storage, setRowWithDirtyFlag);
     }
 
+    void setKeyPageFormat(KeyPageFormat _format) { m_keyPageFormat = _format; }
+
 private:
     size_t m_keyPageSize;
+    KeyPageFormat m_keyPageFormat = KeyPageFormat::ARCHIVE;
 };
 
 }  // namespace bcos::storage
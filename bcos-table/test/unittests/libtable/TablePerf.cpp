@@ -2,8 +2,11 @@
 #include "bcos-table/src/StateStorage.h"
 #include <bcos-utilities/Common.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <boost/lexical_cast.hpp>
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <future>
 
 namespace bcos::test
@@ -130,6 +133,68 @@ BOOST_AUTO_TEST_CASE(asyncToSyncGet)
     std::cout << "asyncToSync cost: " << bcos::utcSteadyTime() - now << "\n";
 }
 
+BOOST_AUTO_TEST_CASE(parallelGet)
+{
+    // the DMC executors read the same contract table from many threads
+    tableFactory->createTable("test_table", "field1");
+    auto table = tableFactory->openTable("test_table");
+
+    auto entries = createTestData(*table);
+
+    for (auto& [key, entry] : entries)
+    {
+        table->setRow(key, entry);
+    }
+
+    constexpr size_t rounds = 16;
+    std::atomic_size_t found = 0;
+    auto now = bcos::utcSteadyTime();
+    tbb::parallel_for(tbb::blocked_range<size_t>(0U, count * rounds),
+        [this, &table, &found](auto const& range) {
+            for (auto i = range.begin(); i < range.end(); ++i)
+            {
+                auto entry =
+                    table->getRow("key_" + boost::lexical_cast<std::string>(i % count));
+                if (entry && entry->getField(0) == "value1")
+                {
+                    ++found;
+                }
+            }
+        });
+    auto cost = bcos::utcSteadyTime() - now;
+    BOOST_CHECK_EQUAL(found, count * rounds);
+
+    std::cout << "parallel get cost: " << cost << ", reads: " << count * rounds << "\n";
+}
+
+BOOST_AUTO_TEST_CASE(parallelMerge)
+{
+    auto source = std::make_shared<StateStorage>(nullptr, true);
+    source->createTable("test_table", "field1");
+    auto sourceTable = source->openTable("test_table");
+
+    auto entries = createTestData(*sourceTable);
+    for (auto& [key, entry] : entries)
+    {
+        sourceTable->setRow(key, entry);
+    }
+
+    auto now = bcos::utcSteadyTime();
+    tableFactory->merge(true, *source);
+    auto cost = bcos::utcSteadyTime() - now;
+
+    auto table = tableFactory->openTable("test_table");
+    BOOST_REQUIRE(table);
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto entry = table->getRow("key_" + boost::lexical_cast<std::string>(i));
+        BOOST_REQUIRE(entry);
+        BOOST_CHECK_EQUAL(entry->getField(0), "value1");
+    }
+
+    std::cout << "parallel merge cost: " << cost << ", records: " << count << "\n";
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace bcos::test
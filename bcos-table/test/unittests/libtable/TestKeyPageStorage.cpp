@@ -30,6 +30,7 @@
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/concurrent_vector.h>
 #include <boost/exception/diagnostic_information.hpp>
+#include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
@@ -3068,5 +3069,120 @@ BOOST_AUTO_TEST_CASE(bugfix_keypage_system_entry_hash)
     BOOST_TEST(hash0.hex() == hash1.hex());
 }
 
+BOOST_AUTO_TEST_CASE(compactPageCodec)
+{
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    for (int i = 0; i < 100; ++i)
+    {
+        keys.emplace_back("account_" + (boost::format("%05d") % (i * 2)).str());
+        values.emplace_back(i % 10, 'v');
+    }
+    std::vector<KeyPageCodec::PageEntry> entries;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        entries.emplace_back(keys[i], values[i]);
+    }
+
+    for (auto compress : {false, true})
+    {
+        auto encoded = KeyPageCodec::encodePage(entries, compress);
+        BOOST_REQUIRE(KeyPageCodec::isCompact(encoded));
+        KeyPageCodec::PageView view(encoded);
+        BOOST_REQUIRE_EQUAL(view.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            auto value = view.find(keys[i]);
+            BOOST_REQUIRE(value);
+            BOOST_REQUIRE_EQUAL(*value, values[i]);
+            // the odd keys are not in the page
+            auto missing = "account_" + (boost::format("%05d") % (i * 2 + 1)).str();
+            BOOST_REQUIRE(!view.find(missing));
+        }
+        BOOST_REQUIRE(!view.find(""));
+        BOOST_REQUIRE(!view.find("z"));
+
+        size_t index = 0;
+        view.forEach([&](std::string_view key, std::string_view value) {
+            BOOST_REQUIRE_EQUAL(key, keys[index]);
+            BOOST_REQUIRE_EQUAL(value, values[index]);
+            ++index;
+        });
+        BOOST_REQUIRE_EQUAL(index, keys.size());
+    }
+    // prefix compressed and smaller than the archive
+    KeyPageStorage::Page page;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        Entry entry;
+        entry.set(values[i]);
+        page.setEntry(keys[i], std::move(entry));
+    }
+    Entry archive;
+    archive.setObject(page);
+    BOOST_REQUIRE(!KeyPageCodec::isCompact(archive.get()));
+    BOOST_REQUIRE_LT(page.encode(false).size(), archive.size());
+    KeyPageStorage::Page decoded(page.encode(true), keys.back());
+    BOOST_REQUIRE_EQUAL(decoded.validCount(), keys.size());
+    BOOST_REQUIRE_EQUAL(decoded.size(), page.size());
+    BOOST_REQUIRE_EQUAL(decoded.getEntry(keys[10])->get(), values[10]);
+
+    KeyPageStorage::TableMeta meta;
+    for (size_t i = 0; i < keys.size(); i += 10)
+    {
+        meta.insertPageInfoNoLock(KeyPageStorage::PageInfo(
+            keys[i], static_cast<uint16_t>(i + 1), static_cast<uint16_t>(i * 10), nullptr));
+    }
+    KeyPageStorage::TableMeta decodedMeta(meta.encode(true));
+    auto& pageInfos = decodedMeta.getAllPageInfoNoLock();
+    BOOST_REQUIRE_EQUAL(pageInfos.size(), 10U);
+    BOOST_REQUIRE_EQUAL(pageInfos[3].getPageKey(), keys[30]);
+    BOOST_REQUIRE_EQUAL(pageInfos[3].getCount(), 31);
+    BOOST_REQUIRE_EQUAL(pageInfos[3].getSize(), 300);
+
+    auto corrupted = page.encode(false);
+    corrupted.resize(corrupted.size() / 2);
+    BOOST_REQUIRE_THROW(KeyPageCodec::PageView{corrupted}, bcos::Error);
+}
+
+BOOST_AUTO_TEST_CASE(compactPageFormat)
+{
+    tableFactory->setPageFormat(KeyPageFormat::COMPACT_COMPRESSED);
+    auto ret = createDefaultTable();
+    BOOST_REQUIRE(ret);
+    auto table = tableFactory->openTable(testTableName);
+    for (int i = 0; i < 500; ++i)
+    {
+        auto entry = table->newEntry();
+        entry.setField(0, "value_" + std::to_string(i));
+        table->setRow("key_" + std::to_string(i), entry);
+    }
+
+    auto backend = std::make_shared<StateStorage>(nullptr, false);
+    std::atomic_size_t archived = 0;
+    tableFactory->parallelTraverse(true, [&](auto&& tableName, auto&& key, auto&& entry) {
+        if (tableName == testTableName && entry.status() != Entry::Status::DELETED &&
+            !KeyPageCodec::isCompact(entry.get()))
+        {
+            ++archived;
+        }
+        backend->asyncSetRow(tableName, key, entry, [](Error::UniquePtr) {});
+        return true;
+    });
+    BOOST_REQUIRE_EQUAL(archived, 0U);
+
+    // the storage in the default format reads the compact pages
+    auto reader = std::make_shared<KeyPageStorage>(backend, false);
+    auto readTable = reader->openTable(testTableName);
+    BOOST_REQUIRE(readTable);
+    for (int i = 0; i < 500; ++i)
+    {
+        auto entry = readTable->getRow("key_" + std::to_string(i));
+        BOOST_REQUIRE(entry);
+        BOOST_REQUIRE_EQUAL(entry->getField(0), "value_" + std::to_string(i));
+    }
+    BOOST_REQUIRE(!readTable->getRow("key_500"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace bcos::test
@@ -8,15 +8,14 @@ bcostars::protocol::TransactionFactoryImpl::TransactionFactoryImpl(
 
 bcos::protocol::Transaction::Ptr bcostars::protocol::TransactionFactoryImpl::createTransaction()
 {
-    return std::make_shared<TransactionImpl>();
+    return TransactionImpl::create();
 }
 
 bcos::protocol::Transaction::Ptr bcostars::protocol::TransactionFactoryImpl::createTransaction(
     bcos::protocol::Transaction& input)
 {
     auto& tarsInput = dynamic_cast<bcostars::protocol::TransactionImpl&>(input);
-    auto transaction = std::make_shared<TransactionImpl>(
-        [m_inner = std::move(tarsInput.mutableInner())]() mutable { return &m_inner; });
+    auto transaction = TransactionImpl::create(std::move(tarsInput.mutableInner()));
     transaction->setSynced(input.synced());
     transaction->setSealed(input.sealed());
     transaction->setInvalid(input.invalid());
@@ -32,9 +31,7 @@ bcos::protocol::Transaction::Ptr bcostars::protocol::TransactionFactoryImpl::cre
 bcos::protocol::Transaction::Ptr bcostars::protocol::TransactionFactoryImpl::createTransaction(
     bcos::bytesConstRef txData, bool checkSig, bool checkHash)
 {
-    auto transaction = std::make_shared<TransactionImpl>(
-        [m_transaction = bcostars::Transaction()]() mutable { return &m_transaction; });
-
+    auto transaction = TransactionImpl::create();
     transaction->decode(txData);
     // check value or gasPrice or maxFeePerGas or maxPriorityFeePerGas is hex string
     if (transaction->version() >= int32_t(bcos::protocol::TransactionVersion::V1_VERSION))
@@ -100,8 +97,7 @@ bcostars::protocol::TransactionFactoryImpl::createTransaction(int32_t _version,
     std::string _gasPrice, int64_t _gasLimit, std::string _maxFeePerGas,
     std::string _maxPriorityFeePerGas)
 {
-    auto transaction = std::make_shared<bcostars::protocol::TransactionImpl>(
-        [m_transaction = bcostars::Transaction()]() mutable { return &m_transaction; });
+    auto transaction = TransactionImpl::create();
     auto& inner = transaction->mutableInner();
     inner.data.version = _version;
     inner.data.to = std::move(_to);
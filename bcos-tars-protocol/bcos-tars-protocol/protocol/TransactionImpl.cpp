@@ -43,6 +43,67 @@ bcostars::protocol::TransactionImpl::TransactionImpl()
     })
 {}
 
+namespace
+{
+// the accessor of a transaction created by create(), it points into the shared allocation
+struct HolderAccessor
+{
+    bcostars::Transaction* m_inner;
+    bcostars::Transaction* operator()() const { return m_inner; }
+};
+
+// keep the tars transaction next to its wrapper: the accessor only holds a pointer, which fits in
+// the small buffer of std::function, so a decoded transaction costs a single allocation besides
+// its fields
+struct TransactionHolder
+{
+    bcostars::Transaction m_inner;
+    TransactionImpl m_transaction;
+
+    explicit TransactionHolder(bcostars::Transaction inner)
+      : m_inner(std::move(inner)), m_transaction(HolderAccessor{std::addressof(m_inner)})
+    {}
+    TransactionHolder(const TransactionHolder&) = delete;
+    TransactionHolder(TransactionHolder&&) = delete;
+    TransactionHolder& operator=(const TransactionHolder&) = delete;
+    TransactionHolder& operator=(TransactionHolder&&) = delete;
+    ~TransactionHolder() = default;
+};
+}  // namespace
+
+std::shared_ptr<TransactionImpl> TransactionImpl::create(bcostars::Transaction inner)
+{
+    auto holder = std::make_shared<TransactionHolder>(std::move(inner));
+    return {holder, std::addressof(holder->m_transaction)};
+}
+
+std::function<bcostars::Transaction*()> TransactionImpl::rebind(
+    std::function<bcostars::Transaction*()> inner)
+{
+    if (inner.target<HolderAccessor>() == nullptr)
+    {
+        return inner;
+    }
+    // the holder may be released before the moved transaction, take the tars object over
+    return [m_transaction = std::move(*inner())]() mutable {
+        return std::addressof(m_transaction);
+    };
+}
+
+TransactionImpl::TransactionImpl(TransactionImpl&& _tx)
+  : bcos::protocol::Transaction(std::move(_tx)), m_inner(rebind(std::move(_tx.m_inner)))
+{}
+
+TransactionImpl& TransactionImpl::operator=(TransactionImpl&& _tx)
+{
+    if (this != std::addressof(_tx))
+    {
+        bcos::protocol::Transaction::operator=(std::move(_tx));
+        m_inner = rebind(std::move(_tx.m_inner));
+    }
+    return *this;
+}
+
 void TransactionImpl::decode(bcos::bytesConstRef _txData)
 {
     bcos::concepts::serialize::decode(_txData, *m_inner());
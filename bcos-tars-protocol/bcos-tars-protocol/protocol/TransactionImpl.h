@@ -42,11 +42,16 @@ public:
     ~TransactionImpl() override = default;
     TransactionImpl& operator=(const TransactionImpl& _tx) = delete;
     TransactionImpl(const TransactionImpl& _tx) = delete;
-    TransactionImpl& operator=(TransactionImpl&& _tx) = default;
-    TransactionImpl(TransactionImpl&& _tx) = default;
+    // a transaction created by create() is re-bound to a copy of its own on move, it must not
+    // refer to the allocation of the moved-from transaction
+    TransactionImpl& operator=(TransactionImpl&& _tx);
+    TransactionImpl(TransactionImpl&& _tx);
 
     friend class TransactionFactoryImpl;
 
+    // create a transaction owning inner, the wrapper and the tars object share one allocation
+    static std::shared_ptr<TransactionImpl> create(bcostars::Transaction inner = {});
+
     bool operator==(const Transaction& rhs) const { return this->hash() == rhs.hash(); }
 
     void decode(bcos::bytesConstRef _txData) override;
@@ -96,6 +101,9 @@ public:
     size_t size() const override;
 
 private:
+    static std::function<bcostars::Transaction*()> rebind(
+        std::function<bcostars::Transaction*()> inner);
+
     std::function<bcostars::Transaction*()> m_inner;
 };
 }  // namespace bcostars::protocol
@@ -21,6 +21,7 @@
 #include <bcos-utilities/DataConvertUtility.h>
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
+#include <cstdlib>
 #include <gsl/span>
 #include <memory>
 
@@ -118,6 +119,55 @@ BOOST_AUTO_TEST_CASE(transaction)
     BOOST_CHECK_EQUAL(blockTx->sender(), tx->sender());
 }
 
+BOOST_AUTO_TEST_CASE(transactionFromBlock)
+{
+    bcos::bytes input(bcos::asBytes("Arguments"));
+    bcostars::protocol::TransactionFactoryImpl factory(cryptoSuite);
+    auto keyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+    auto tx = factory.createTransaction(
+        0, "Target", input, "800", 100, "testChain", "testGroup", 1000, *keyPair);
+    bcos::bytes buffer;
+    tx->encode(buffer);
+
+    auto block = blockFactory->createBlock();
+    block->appendTransaction(factory.createTransaction(bcos::ref(buffer), true));
+    bcos::bytes blockBuffer;
+    block->encode(blockBuffer);
+    auto decodedBlock = blockFactory->createBlock(bcos::ref(blockBuffer), false, false);
+
+    // the fields decoded with the block are moved into the transaction, not copied
+    auto blockTx = decodedBlock->transactions()[0];
+    auto inputAddress = blockTx->input().data();
+    auto movedTx = factory.createTransaction(*blockTx);
+    BOOST_CHECK_EQUAL((intptr_t)movedTx->input().data(), (intptr_t)inputAddress);
+    BOOST_CHECK_EQUAL(movedTx->hash(), tx->hash());
+    BOOST_CHECK_EQUAL(movedTx->sender(), tx->sender());
+    BOOST_CHECK_EQUAL(bcos::asString(movedTx->input()), bcos::asString(input));
+
+    // the tars transaction shares the allocation of its wrapper and is owned by it
+    auto implTx = std::dynamic_pointer_cast<bcostars::protocol::TransactionImpl>(movedTx);
+    BOOST_REQUIRE(implTx);
+    auto innerAddress = (intptr_t)std::addressof(implTx->inner());
+    auto distance = std::abs(innerAddress - (intptr_t)implTx.get());
+    BOOST_CHECK_LT(distance,
+        (intptr_t)(sizeof(bcostars::Transaction) + sizeof(bcostars::protocol::TransactionImpl)));
+    BOOST_CHECK_EQUAL(implTx.use_count(), 2);
+
+    // a transaction moved out of the holder takes the tars transaction over
+    bcostars::protocol::TransactionImpl ownedTx(std::move(*implTx));
+    implTx.reset();
+    movedTx.reset();
+    BOOST_CHECK_NE((intptr_t)std::addressof(ownedTx.inner()), innerAddress);
+    BOOST_CHECK_EQUAL((intptr_t)ownedTx.input().data(), (intptr_t)inputAddress);
+    BOOST_CHECK_EQUAL(ownedTx.hash(), tx->hash());
+    BOOST_CHECK_EQUAL(bcos::asString(ownedTx.input()), bcos::asString(input));
+
+    bcostars::protocol::TransactionImpl assignedTx;
+    assignedTx = std::move(ownedTx);
+    BOOST_CHECK_EQUAL(assignedTx.hash(), tx->hash());
+    BOOST_CHECK_EQUAL(bcos::asString(assignedTx.input()), bcos::asString(input));
+}
+
 BOOST_AUTO_TEST_CASE(transactionMetaData)
 {
     bcos::h256 hash("5feceb66ffc86f38d952786c6d696c79c2dbc239dd4e91b46729d73a27fb57e9");
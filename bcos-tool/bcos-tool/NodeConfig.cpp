@@ -366,12 +366,65 @@ void NodeConfig::loadRpcConfig(boost::property_tree::ptree const& _pt)
         ; 300s
         filter_timeout=300
         filter_max_process_block=10
+        batch_request_size_limit=8
+        ; the elements of a batch request handled concurrently
+        batch_request_concurrency=8
+        ; the cached block/receipt responses, 0 disables the cache
+        block_response_cache_size=1024
+        ; build the responses of the new committed block before they are requested
+        block_response_prefill=false
+        ; the max MB waiting to be written to one websocket client, 0 means unlimited
+        session_write_queue_mb=256
+        ; disconnect the client whose write queue is full instead of rejecting the messages
+        disconnect_slow_client=false
+        ; the acceptors listening on the port with SO_REUSEPORT, each runs on its own thread
+        http_acceptor_count=1
+        ; the max pipelined http requests of one connection waiting for the responses
+        http_pipeline_limit=16
+        ; the ms an http request waits for the handler before responded with 504, 0 means unlimited
+        http_handler_timeout=0
     */
     std::string listenIP = _pt.get<std::string>("rpc.listen_ip", "0.0.0.0");
     int listenPort = _pt.get<int>("rpc.listen_port", 20200);
     int threadCount = _pt.get<int>("rpc.thread_count", 8);
     int filterTimeout = _pt.get<int>("rpc.filter_timeout", 300);
     int maxProcessBlock = _pt.get<int>("rpc.filter_max_process_block", 10);
+    int batchRequestSizeLimit = _pt.get<int>("rpc.batch_request_size_limit", 8);
+    int batchRequestConcurrency = _pt.get<int>("rpc.batch_request_concurrency", 8);
+    if (batchRequestSizeLimit <= 0 || batchRequestConcurrency <= 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set rpc.batch_request_size_limit and "
+                                  "rpc.batch_request_concurrency > 0"));
+    }
+    int blockResponseCacheSize = _pt.get<int>("rpc.block_response_cache_size", 1024);
+    if (blockResponseCacheSize < 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set rpc.block_response_cache_size >= 0"));
+    }
+    bool blockResponsePrefill = _pt.get<bool>("rpc.block_response_prefill", false);
+    int sessionWriteQueueMB = _pt.get<int>("rpc.session_write_queue_mb", 256);
+    if (sessionWriteQueueMB < 0)
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidConfig() << errinfo_comment("Please set rpc.session_write_queue_mb >= 0"));
+    }
+    bool disconnectSlowClient = _pt.get<bool>("rpc.disconnect_slow_client", false);
+    int httpAcceptorCount = _pt.get<int>("rpc.http_acceptor_count", 1);
+    int httpPipelineLimit = _pt.get<int>("rpc.http_pipeline_limit", 16);
+    if (httpAcceptorCount <= 0 || httpPipelineLimit <= 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set rpc.http_acceptor_count and "
+                                  "rpc.http_pipeline_limit > 0"));
+    }
+    int httpHandlerTimeout = _pt.get<int>("rpc.http_handler_timeout", 0);
+    if (httpHandlerTimeout < 0)
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidConfig() << errinfo_comment("Please set rpc.http_handler_timeout >= 0"));
+    }
     bool smSsl = _pt.get<bool>("rpc.sm_ssl", false);
     bool disableSsl = _pt.get<bool>("rpc.disable_ssl", false);
     // enable ssl cover disable ssl
@@ -388,11 +441,29 @@ void NodeConfig::loadRpcConfig(boost::property_tree::ptree const& _pt)
     m_rpcSmSsl = smSsl;
     m_rpcFilterTimeout = filterTimeout * 1000;  // to milliseconds
     m_rpcMaxProcessBlock = maxProcessBlock;
+    m_rpcBatchRequestSizeLimit = batchRequestSizeLimit;
+    m_rpcBatchRequestConcurrency = batchRequestConcurrency;
+    m_rpcBlockResponseCacheSize = blockResponseCacheSize;
+    m_rpcBlockResponsePrefill = blockResponsePrefill;
+    m_rpcSessionWriteQueueBytes = static_cast<uint64_t>(sessionWriteQueueMB) * 1024 * 1024;
+    m_rpcDisconnectSlowClient = disconnectSlowClient;
+    m_rpcHttpAcceptorCount = httpAcceptorCount;
+    m_rpcHttpPipelineLimit = httpPipelineLimit;
+    m_rpcHttpHandlerTimeout = httpHandlerTimeout;
     g_BCOSConfig.setNeedRetInput(needRetInput);
 
     NodeConfig_LOG(INFO) << LOG_DESC("loadRpcConfig") << LOG_KV("listenIP", listenIP)
                          << LOG_KV("listenPort", listenPort) << LOG_KV("listenPort", listenPort)
                          << LOG_KV("smSsl", smSsl) << LOG_KV("disableSsl", disableSsl)
+                         << LOG_KV("batchRequestSizeLimit", batchRequestSizeLimit)
+                         << LOG_KV("batchRequestConcurrency", batchRequestConcurrency)
+                         << LOG_KV("blockResponseCacheSize", blockResponseCacheSize)
+                         << LOG_KV("blockResponsePrefill", blockResponsePrefill)
+                         << LOG_KV("sessionWriteQueueMB", sessionWriteQueueMB)
+                         << LOG_KV("disconnectSlowClient", disconnectSlowClient)
+                         << LOG_KV("httpAcceptorCount", httpAcceptorCount)
+                         << LOG_KV("httpPipelineLimit", httpPipelineLimit)
+                         << LOG_KV("httpHandlerTimeout", httpHandlerTimeout)
                          << LOG_KV("needRetInput", needRetInput);
 }
 
@@ -408,6 +479,10 @@ void NodeConfig::loadWeb3RpcConfig(boost::property_tree::ptree const& _pt)
         filter_timeout=300
         filter_max_process_block=10
         batch_request_size_limit=8
+        ; the elements of a batch request handled concurrently
+        batch_request_concurrency=8
+        ; the cached block responses, 0 disables the cache
+        block_response_cache_size=1024
         ;request body size limit for web3 rpc, default is 10MB
         request_body_size_limit=10240000
         ; cors config for web3 rpc
@@ -426,6 +501,18 @@ void NodeConfig::loadWeb3RpcConfig(boost::property_tree::ptree const& _pt)
     const int maxProcessBlock = _pt.get<int>("web3_rpc.filter_max_process_block", 10);
     const bool enableWeb3Rpc = _pt.get<bool>("web3_rpc.enable", false);
     const int batchRequestSizeLimit = _pt.get<int>("web3_rpc.batch_request_size_limit", 8);
+    const int batchRequestConcurrency = _pt.get<int>("web3_rpc.batch_request_concurrency", 8);
+    if (batchRequestConcurrency <= 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set web3_rpc.batch_request_concurrency > 0"));
+    }
+    const int blockResponseCacheSize = _pt.get<int>("web3_rpc.block_response_cache_size", 1024);
+    if (blockResponseCacheSize < 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set web3_rpc.block_response_cache_size >= 0"));
+    }
     const int requestBodySizeLimit = _pt.get<int>("web3_rpc.request_body_size_limit", 10240000);
     const bool enableCors = _pt.get<bool>("web3_rpc.enable_cors", true);
     const bool corsAllowCredentials = _pt.get<bool>("web3_rpc.cors_allow_credentials", true);
@@ -444,6 +531,8 @@ void NodeConfig::loadWeb3RpcConfig(boost::property_tree::ptree const& _pt)
     m_web3FilterTimeout = filterTimeout * 1000;  // to milliseconds
     m_web3MaxProcessBlock = maxProcessBlock;
     m_web3BatchRequestSizeLimit = batchRequestSizeLimit;
+    m_web3BatchRequestConcurrency = batchRequestConcurrency;
+    m_web3BlockResponseCacheSize = blockResponseCacheSize;
     m_web3HttpBodySizeLimit = requestBodySizeLimit;
     m_web3EnableCors = enableCors;
     m_web3CorsAllowedOrigins = corsAllowedOrigins;
@@ -459,6 +548,8 @@ void NodeConfig::loadWeb3RpcConfig(boost::property_tree::ptree const& _pt)
                          << LOG_KV("filterTimeout", filterTimeout)
                          << LOG_KV("maxProcessBlock", maxProcessBlock)
                          << LOG_KV("batchRequestSizeLimit", batchRequestSizeLimit)
+                         << LOG_KV("batchRequestConcurrency", batchRequestConcurrency)
+                         << LOG_KV("blockResponseCacheSize", blockResponseCacheSize)
                          << LOG_KV("enableCors", enableCors)
                          << LOG_KV("corsAllowedOrigins", corsAllowedOrigins)
                          << LOG_KV("corsAllowedMethods", corsAllowedMethods)
@@ -602,6 +693,19 @@ void NodeConfig::loadTxPoolConfig(boost::property_tree::ptree const& _pt)
     m_txsExpirationTime = std::max(
         {txsExpirationTime * 1000, (int64_t)DEFAULT_MIN_CONSENSUS_TIME_MS, (int64_t)m_minSealTime});
     m_checkBlockLimit = _pt.get<bool>("txpool.check_block_limit", true);
+    m_txsPriorityPolicy = _pt.get<std::string>("txpool.priority_policy", "import_time");
+    if (m_txsPriorityPolicy != "import_time" && m_txsPriorityPolicy != "gas_price")
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set txpool.priority_policy to import_time or gas_price !"));
+    }
+    // in milliseconds, 0 means disabled
+    m_proposalPrefillWindow = checkAndGetValue(_pt, "txpool.proposal_prefill_window", "0");
+    if (m_proposalPrefillWindow < 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set txpool.proposal_prefill_window to non-negative !"));
+    }
 
     // enable free node to send transactions or not
     m_enableTxsFromFreeNode = _pt.get<bool>("txpool.enable_txs_from_free_node", false);
@@ -609,6 +713,8 @@ void NodeConfig::loadTxPoolConfig(boost::property_tree::ptree const& _pt)
                          << LOG_KV("notifierWorkers", m_notifyWorkerNum)
                          << LOG_KV("verifierWorkers", m_verifierWorkerNum)
                          << LOG_KV("checkBlockLimit", m_checkBlockLimit)
+                         << LOG_KV("priorityPolicy", m_txsPriorityPolicy)
+                         << LOG_KV("proposalPrefillWindow(ms)", m_proposalPrefillWindow)
                          << LOG_KV("txsExpirationTime(ms)", m_txsExpirationTime)
                          << LOG_KV("enableTxsFromFreeNode", m_enableTxsFromFreeNode);
 }
@@ -807,7 +913,17 @@ void NodeConfig::loadSealerConfig(boost::property_tree::ptree const& _pt)
         BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
                                   "Please set consensus.min_seal_time between 1 and 600000!"));
     }
-    NodeConfig_LOG(INFO) << LOG_DESC("loadSealerConfig") << LOG_KV("minSealTime", m_minSealTime);
+    // the expected latency from sealing a block to committing it, the sealer adjusts the block
+    // size to it, 0 seals with the txs count limit of the ledger
+    auto targetBlockLatency = _pt.get<int64_t>("consensus.target_block_latency", 0);
+    if (targetBlockLatency < 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set consensus.target_block_latency >= 0"));
+    }
+    m_targetBlockLatency = targetBlockLatency;
+    NodeConfig_LOG(INFO) << LOG_DESC("loadSealerConfig") << LOG_KV("minSealTime", m_minSealTime)
+                         << LOG_KV("targetBlockLatency", m_targetBlockLatency);
 }
 
 void NodeConfig::loadStorageSecurityConfig(boost::property_tree::ptree const& _pt)
@@ -888,6 +1004,41 @@ void NodeConfig::loadStorageConfig(boost::property_tree::ptree const& _pt)
     m_storagePath = _pt.get<std::string>("storage.data_path", "data/" + m_genesisConfig.m_groupID);
     m_storageType = _pt.get<std::string>("storage.type", "RocksDB");
     m_keyPageSize = _pt.get<int32_t>("storage.key_page_size", 10240);
+    // archive: boost archive, compact: compact page format, compact_zstd: compressed compact
+    auto keyPageFormat = _pt.get<std::string>("storage.key_page_format", "archive");
+    if (keyPageFormat == "archive")
+    {
+        m_keyPageFormat = 0;
+    }
+    else if (keyPageFormat == "compact")
+    {
+        m_keyPageFormat = 1;
+    }
+    else if (keyPageFormat == "compact_zstd")
+    {
+        m_keyPageFormat = 2;
+    }
+    else
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set storage.key_page_format to archive, compact or "
+                                  "compact_zstd"));
+    }
+    // the transactions and receipts of the blocks older than the latest cold_block_threshold
+    // blocks are moved to the segment files under cold_storage_path
+    m_coldStoragePath = _pt.get<std::string>("storage.cold_storage_path", "");
+    m_coldBlockThreshold = _pt.get<int64_t>("storage.cold_block_threshold", 1000000);
+    m_coldSegmentBlocks = _pt.get<uint64_t>("storage.cold_segment_blocks", 10000);
+    if (!m_coldStoragePath.empty() && m_coldBlockThreshold < 10000)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set storage.cold_block_threshold no less than 10000"));
+    }
+    if (m_coldSegmentBlocks == 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set storage.cold_segment_blocks larger than 0"));
+    }
     m_maxWriteBufferNumber = _pt.get<int32_t>("storage.max_write_buffer_number", 4);
     m_maxBackgroundJobs = _pt.get<int32_t>("storage.max_background_jobs", 4);
     m_writeBufferSize = _pt.get<size_t>("storage.write_buffer_size", 64 << 20);
@@ -929,7 +1080,12 @@ void NodeConfig::loadStorageConfig(boost::property_tree::ptree const& _pt)
     m_cacheSize = _pt.get<ssize_t>("storage.cache_size", DEFAULT_CACHE_SIZE);
     g_BCOSConfig.setStorageType(m_storageType);  // Set storageType to global
     NodeConfig_LOG(INFO) << LOG_DESC("loadStorageConfig") << LOG_KV("storagePath", m_storagePath)
-                         << LOG_KV("KeyPage", m_keyPageSize) << LOG_KV("storageType", m_storageType)
+                         << LOG_KV("KeyPage", m_keyPageSize)
+                         << LOG_KV("keyPageFormat", keyPageFormat)
+                         << LOG_KV("coldStoragePath", m_coldStoragePath)
+                         << LOG_KV("coldBlockThreshold", m_coldBlockThreshold)
+                         << LOG_KV("coldSegmentBlocks", m_coldSegmentBlocks)
+                         << LOG_KV("storageType", m_storageType)
                          << LOG_KV("pdAddrs", pd_addrs) << LOG_KV("pdCaPath", m_pdCaPath)
                          << LOG_KV("enableArchive", m_enableArchive)
                          << LOG_KV("enableSeparateBlockAndState", m_enableSeparateBlockAndState)
@@ -980,6 +1136,13 @@ void NodeConfig::loadOthersConfig(boost::property_tree::ptree const& _pt)
     m_baselineSchedulerConfig.maxThread = _pt.get<int>("executor.baseline_scheduler_maxthread", 16);
     m_baselineSchedulerConfig.parallel =
         _pt.get<bool>("executor.baseline_scheduler_parallel", false);
+    m_baselineSchedulerConfig.callConcurrency =
+        _pt.get<int>("executor.baseline_scheduler_call_concurrency", 8);
+    if (m_baselineSchedulerConfig.callConcurrency <= 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set executor.baseline_scheduler_call_concurrency > 0"));
+    }
 
     m_tarsRPCConfig.host = _pt.get<std::string>("rpc.tars_rpc_host", "127.0.0.1");
     m_tarsRPCConfig.port = _pt.get<int>("rpc.tars_rpc_port", 0);
@@ -1020,9 +1183,22 @@ void NodeConfig::loadConsensusConfig(boost::property_tree::ptree const& _pt)
                                   "Please set consensus.pipeline_size to no less than " +
                                   std::to_string(DEFAULT_PIPELINE_SIZE)));
     }
+    // the threads verifying the signatures of the consensus messages, 0 verifies them on the
+    // consensus thread
+    auto verifyThreads = _pt.get<int>("consensus.signature_verify_threads", 4);
+    if (verifyThreads < 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set consensus.signature_verify_threads >= 0"));
+    }
+    m_signatureVerifyThreads = verifyThreads;
+    // prepare the proposal for execution once its pre-prepare is verified
+    m_speculativePreApply = _pt.get<bool>("consensus.speculative_pre_apply", true);
     NodeConfig_LOG(INFO) << LOG_DESC("loadConsensusConfig")
                          << LOG_KV("checkPointTimeoutInterval", m_checkPointTimeoutInterval)
-                         << LOG_KV("pipeline_size", m_pipelineSize);
+                         << LOG_KV("pipeline_size", m_pipelineSize)
+                         << LOG_KV("signatureVerifyThreads", m_signatureVerifyThreads)
+                         << LOG_KV("speculativePreApply", m_speculativePreApply);
 }
 
 void NodeConfig::loadLedgerConfig(boost::property_tree::ptree const& _genesisConfig)
@@ -110,6 +110,10 @@ public:
     size_t verifierWorkerNum() const { return m_verifierWorkerNum; }
     int64_t txsExpirationTime() const { return m_txsExpirationTime; }
     bool checkBlockLimit() const { return m_checkBlockLimit; }
+    // the order to seal txs: import_time or gas_price
+    std::string const& txsPriorityPolicy() const { return m_txsPriorityPolicy; }
+    // push the txs received from local clients within this window (ms) along with the proposal
+    int64_t proposalPrefillWindow() const { return m_proposalPrefillWindow; }
 
     bool smCryptoType() const { return m_genesisConfig.m_smCrypto; }
     std::string const& chainId() const { return m_genesisConfig.m_chainID; }
@@ -123,15 +127,24 @@ public:
     std::string const& password() const { return m_password; }
 
     size_t minSealTime() const { return m_minSealTime; }
+    uint64_t targetBlockLatency() const { return m_targetBlockLatency; }
     bool allowFreeNodeSync() const { return m_allowFreeNode; }
     size_t checkPointTimeoutInterval() const { return m_checkPointTimeoutInterval; }
     size_t pipelineSize() const { return m_pipelineSize; }
+    size_t signatureVerifyThreads() const { return m_signatureVerifyThreads; }
+    bool speculativePreApply() const { return m_speculativePreApply; }
 
     std::string const& storagePath() const { return m_storagePath; }
     std::string const& stateDBPath() const { return m_stateDBPath; }
     std::string const& blockDBPath() const { return m_blockDBPath; }
     std::string const& storageType() const { return m_storageType; }
     size_t keyPageSize() const { return m_keyPageSize; }
+    // the value of bcos::storage::KeyPageFormat
+    uint8_t keyPageFormat() const { return m_keyPageFormat; }
+    // empty if the cold block store is disabled
+    std::string const& coldStoragePath() const { return m_coldStoragePath; }
+    int64_t coldBlockThreshold() const { return m_coldBlockThreshold; }
+    uint64_t coldSegmentBlocks() const { return m_coldSegmentBlocks; }
     int maxWriteBufferNumber() const { return m_maxWriteBufferNumber; }
     bool enableStatistics() const { return m_enableDBStatistics; }
     int maxBackgroundJobs() const { return m_maxBackgroundJobs; }
@@ -187,6 +200,15 @@ public:
     uint32_t rpcThreadPoolSize() const { return m_rpcThreadPoolSize; }
     uint32_t rpcFilterTimeout() const { return m_rpcFilterTimeout; }
     uint32_t rpcMaxProcessBlock() const { return m_rpcMaxProcessBlock; }
+    uint32_t rpcBatchRequestSizeLimit() const { return m_rpcBatchRequestSizeLimit; }
+    uint32_t rpcBatchRequestConcurrency() const { return m_rpcBatchRequestConcurrency; }
+    uint32_t rpcBlockResponseCacheSize() const { return m_rpcBlockResponseCacheSize; }
+    bool rpcBlockResponsePrefill() const { return m_rpcBlockResponsePrefill; }
+    uint64_t rpcSessionWriteQueueBytes() const { return m_rpcSessionWriteQueueBytes; }
+    bool rpcDisconnectSlowClient() const { return m_rpcDisconnectSlowClient; }
+    size_t rpcHttpAcceptorCount() const { return m_rpcHttpAcceptorCount; }
+    size_t rpcHttpPipelineLimit() const { return m_rpcHttpPipelineLimit; }
+    uint32_t rpcHttpHandlerTimeout() const { return m_rpcHttpHandlerTimeout; }
     bool rpcSmSsl() const { return m_rpcSmSsl; }
     bool rpcDisableSsl() const { return m_rpcDisableSsl; }
 
@@ -198,6 +220,8 @@ public:
     uint32_t web3FilterTimeout() const { return m_web3FilterTimeout; }
     uint32_t web3MaxProcessBlock() const { return m_web3MaxProcessBlock; }
     uint32_t web3BatchRequestSizeLimit() const { return m_web3BatchRequestSizeLimit; }
+    uint32_t web3BatchRequestConcurrency() const { return m_web3BatchRequestConcurrency; }
+    uint32_t web3BlockResponseCacheSize() const { return m_web3BlockResponseCacheSize; }
     uint32_t web3HttpBodySizeLimit() const { return m_web3HttpBodySizeLimit; }
     bool web3EnableCors() const { return m_web3EnableCors; }
     std::string web3CorsAllowedOrigins() const { return m_web3CorsAllowedOrigins; }
@@ -293,6 +317,7 @@ public:
         bool parallel = false;
         int grainSize = 0;
         int maxThread = 0;
+        int callConcurrency = 0;
     };
     BaselineSchedulerConfig const& baselineSchedulerConfig() const
     {
@@ -384,6 +409,8 @@ private:
     size_t m_verifierWorkerNum{};
     int64_t m_txsExpirationTime{};
     bool m_checkBlockLimit = true;
+    std::string m_txsPriorityPolicy = "import_time";
+    int64_t m_proposalPrefillWindow = 0;
     // permit txs from free node or not
     bool m_enableTxsFromFreeNode = false;
     // TODO: the block sync module need some configurations?
@@ -393,9 +420,12 @@ private:
 
     // sealer configuration
     size_t m_minSealTime = 0;
+    uint64_t m_targetBlockLatency = 0;
     bool m_allowFreeNode = false;
     size_t m_checkPointTimeoutInterval{};
     size_t m_pipelineSize = 50;
+    size_t m_signatureVerifyThreads = 4;
+    bool m_speculativePreApply = true;
 
     // for security
     std::string m_privateKeyPath;
@@ -432,6 +462,10 @@ private:
     std::string m_storagePath;
     std::string m_storageType = "RocksDB";
     size_t m_keyPageSize = 10240;
+    uint8_t m_keyPageFormat = 0;
+    std::string m_coldStoragePath;
+    int64_t m_coldBlockThreshold = 1000000;
+    uint64_t m_coldSegmentBlocks = 10000;
     std::vector<std::string> m_pd_addrs;
     std::string m_pdCaPath;
     std::string m_pdCertPath;
@@ -481,6 +515,16 @@ private:
     uint32_t m_rpcThreadPoolSize{};
     uint32_t m_rpcFilterTimeout{};
     uint32_t m_rpcMaxProcessBlock{};
+    uint32_t m_rpcBatchRequestSizeLimit{};
+    uint32_t m_rpcBatchRequestConcurrency{};
+    uint32_t m_rpcBlockResponseCacheSize{};
+    bool m_rpcBlockResponsePrefill = false;
+    uint64_t m_rpcSessionWriteQueueBytes{};
+    bool m_rpcDisconnectSlowClient = false;
+    size_t m_rpcHttpAcceptorCount = 1;
+    size_t m_rpcHttpPipelineLimit = 16;
+    // milliseconds, 0 means the http requests wait for the handlers without limit
+    uint32_t m_rpcHttpHandlerTimeout = 0;
     bool m_rpcSmSsl{};
     bool m_rpcDisableSsl = false;
 
@@ -492,6 +536,8 @@ private:
     uint32_t m_web3FilterTimeout{};
     uint32_t m_web3MaxProcessBlock{};
     uint32_t m_web3BatchRequestSizeLimit{};
+    uint32_t m_web3BatchRequestConcurrency{};
+    uint32_t m_web3BlockResponseCacheSize{};
     uint32_t m_web3HttpBodySizeLimit{};
     // cors config for web3 rpc
     bool m_web3EnableCors = true;
@@ -54,6 +54,8 @@ bcos::txpool::TxPool::TxPool(TxPoolConfig::Ptr config, TxPoolStorageInterface::P
     m_verifier = std::make_shared<ThreadPool>("verifier", 2);
     // worker to pre-store-txs
     m_txsPreStore = std::make_shared<ThreadPool>("txsPreStore", 1);
+    // worker to push the prefilled txs, keep the encoding and sending out of the seal path
+    m_txsPrefill = std::make_shared<ThreadPool>("txsPrefill", 1);
     TXPOOL_LOG(INFO) << LOG_DESC("create TxPool") << LOG_KV("submitterNum", verifierWorkerNum);
 }
 
@@ -86,6 +88,10 @@ void TxPool::stop()
     {
         m_txsPreStore->stop();
     }
+    if (m_txsPrefill)
+    {
+        m_txsPrefill->stop();
+    }
     if (m_verifier)
     {
         m_verifier->stop();
@@ -195,9 +201,55 @@ TxPool::sealTxs(uint64_t _txsLimit)
     std::vector<protocol::TransactionMetaData::Ptr> sysTxs;
 
     m_txpoolStorage->batchSealTransactions(fetchedTxs, sysTxs, _txsLimit);
+    if (m_config->proposalPrefillWindow() > 0 && !fetchedTxs.empty())
+    {
+        auto self = weak_from_this();
+        m_txsPrefill->enqueue([self, sealedTxs = fetchedTxs]() {
+            try
+            {
+                auto txpool = self.lock();
+                if (!txpool)
+                {
+                    return;
+                }
+                txpool->pushPrefilledTxs(sealedTxs);
+            }
+            catch (std::exception const& e)
+            {
+                TXPOOL_LOG(WARNING) << LOG_DESC("pushPrefilledTxs exception")
+                                    << LOG_KV("message", boost::diagnostic_information(e));
+            }
+        });
+    }
     return {std::move(fetchedTxs), std::move(sysTxs)};
 }
 
+void TxPool::pushPrefilledTxs(std::vector<protocol::TransactionMetaData::Ptr> const& _sealedTxs)
+{
+    if (_sealedTxs.empty())
+    {
+        return;
+    }
+    // the txs submitted by local clients just before sealing may not have reached the other
+    // consensus nodes by broadcast, push their hashes ahead of the proposal so that the peers
+    // fetch the missing ones before verifying it
+    auto txsHash = ::ranges::views::transform(_sealedTxs, [](auto const& metaData) {
+        return metaData->hash();
+    }) | ::ranges::to<HashList>();
+    auto freshTime = utcTime() - m_config->proposalPrefillWindow();
+    HashList prefilledTxs;
+    for (auto&& tx : m_txpoolStorage->getTransactions(txsHash))
+    {
+        if (tx && !tx->synced() && tx->importTime() >= freshTime)
+        {
+            prefilledTxs.emplace_back(tx->hash());
+        }
+    }
+    TXPOOL_LOG(DEBUG) << LOG_DESC("pushPrefilledTxs") << LOG_KV("sealedTxs", _sealedTxs.size())
+                      << LOG_KV("prefilledTxs", prefilledTxs.size());
+    m_transactionSync->pushPrefilledTxs(prefilledTxs);
+}
+
 void TxPool::asyncNotifyBlockResult(BlockNumber _blockNumber, TransactionSubmitResultsPtr txsResult,
     std::function<void(Error::Ptr)> _onNotifyFinished)
 {
@@ -147,6 +147,10 @@ protected:
 
     virtual void storeVerifiedBlock(bcos::protocol::Block::ConstPtr _block);
 
+    // push the hashes of the fresh txs of local clients in the sealed txs to the consensus nodes
+    virtual void pushPrefilledTxs(
+        std::vector<protocol::TransactionMetaData::Ptr> const& _sealedTxs);
+
 private:
     TxPoolConfig::Ptr m_config;
     TxPoolStorageInterface::Ptr m_txpoolStorage;
@@ -159,6 +163,7 @@ private:
 
     ThreadPool::Ptr m_verifier;
     ThreadPool::Ptr m_txsPreStore;
+    ThreadPool::Ptr m_txsPrefill;
     tool::TreeTopology::Ptr m_treeRouter = nullptr;
     std::atomic_bool m_running = {false};
     bool m_checkBlockLimit = true;
@@ -59,3 +59,19 @@ bool bcos::txpool::TxPoolConfig::checkTransactionSignature() const
 {
     return m_checkTransactionSignature;
 }
+bcos::txpool::TxPriorityPolicy bcos::txpool::TxPoolConfig::txPriorityPolicy() const
+{
+    return m_txPriorityPolicy;
+}
+void bcos::txpool::TxPoolConfig::setTxPriorityPolicy(TxPriorityPolicy _policy)
+{
+    m_txPriorityPolicy = _policy;
+}
+int64_t bcos::txpool::TxPoolConfig::proposalPrefillWindow() const
+{
+    return m_proposalPrefillWindow;
+}
+void bcos::txpool::TxPoolConfig::setProposalPrefillWindow(int64_t _window)
+{
+    m_proposalPrefillWindow = _window;
+}
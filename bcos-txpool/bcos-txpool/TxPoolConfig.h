@@ -58,6 +58,14 @@ public:
 
     bool checkTransactionSignature() const;
 
+    TxPriorityPolicy txPriorityPolicy() const;
+    void setTxPriorityPolicy(TxPriorityPolicy _policy);
+
+    // the txs submitted by local clients within the window (ms) before sealing are pushed to the
+    // consensus nodes with the proposal, 0 means disabled
+    int64_t proposalPrefillWindow() const;
+    void setProposalPrefillWindow(int64_t _window);
+
 private:
     TxValidatorInterface::Ptr m_txValidator;
     bcos::protocol::TransactionSubmitResultFactory::Ptr m_txResultFactory;
@@ -67,5 +75,7 @@ private:
     int64_t m_blockLimit = DEFAULT_BLOCK_LIMIT;
     size_t m_poolLimit = DEFAULT_POOL_LIMIT;
     bool m_checkTransactionSignature;
+    TxPriorityPolicy m_txPriorityPolicy = TxPriorityPolicy::ImportTime;
+    int64_t m_proposalPrefillWindow = 0;
 };
 }  // namespace bcos::txpool
\ No newline at end of file
@@ -59,6 +59,8 @@ TxPool::Ptr TxPoolFactory::createTxPool(
     auto web3NonceChecker = std::make_shared<Web3NonceChecker>(m_ledger);
     auto validator = std::make_shared<TxValidator>(txpoolNonceChecker, std::move(web3NonceChecker),
         m_cryptoSuite, m_groupId, m_chainId, m_scheduler);
+    auto senderCache = std::make_shared<SenderCache>(m_cryptoSuite);
+    validator->setSenderCache(senderCache);
 
     TXPOOL_LOG(INFO) << LOG_DESC("create transaction config");
     auto txpoolConfig = std::make_shared<TxPoolConfig>(validator, m_txResultFactory, m_blockFactory,
@@ -74,6 +76,7 @@ TxPool::Ptr TxPoolFactory::createTxPool(
         m_nodeId, m_frontService, txpoolStorage, syncMsgFactory, m_blockFactory, m_ledger);
     TXPOOL_LOG(INFO) << LOG_DESC("create sync engine");
     auto txsSync = std::make_shared<TransactionSync>(txsSyncConfig, m_checkTransactionSignature);
+    txsSync->setSenderCache(std::move(senderCache));
 
     TXPOOL_LOG(INFO) << LOG_DESC("create txpool") << LOG_KV("submitWorkerNum", _verifierWorkerNum)
                      << LOG_KV("notifyWorkerNum", _notifyWorkerNum);
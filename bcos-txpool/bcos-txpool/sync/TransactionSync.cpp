@@ -419,6 +419,8 @@ bool TransactionSync::importDownloadedTxs(TransactionsPtr _txs, Block::ConstPtr
                     tx->setBatchId(_verifiedProposal->blockHeader()->number());
                     tx->setBatchHash(_verifiedProposal->blockHeader()->hash());
                 }
+                // received from the peers, never prefilled into the proposals of this node
+                tx->setSynced(true);
                 if (m_config->txpoolStorage()->exists(tx->hash()))
                 {
                     continue;
@@ -430,7 +432,14 @@ bool TransactionSync::importDownloadedTxs(TransactionsPtr _txs, Block::ConstPtr
                         // force sender to empty for the txs verification
                         tx->forceSender({});
                         // verify failed, it will throw exception
-                        tx->verify(*m_hashImpl, *m_signatureImpl);
+                        if (m_senderCache)
+                        {
+                            m_senderCache->verify(*tx);
+                        }
+                        else
+                        {
+                            tx->verify(*m_hashImpl, *m_signatureImpl);
+                        }
                     }
                     catch (std::exception const& e)
                     {
@@ -478,7 +487,7 @@ bool TransactionSync::importDownloadedTxs(TransactionsPtr _txs, Block::ConstPtr
 void TransactionSync::onPeerTxsStatus(NodeIDPtr _fromNode, TxsSyncMsgInterface::Ptr _txsStatus)
 {
     // Note: after txpool broadcast every tx before submit, this method only used for onEmptyTx
-    // status response
+    // status response and the hashes pushed by the leader along with its proposal
     if (_txsStatus->txsHash().empty())
     {
         responseTxsStatus(std::move(_fromNode));
@@ -535,6 +544,26 @@ void TransactionSync::onEmptyTxs()
     }(std::move(packetData), m_config->frontService()));
 }
 
+void TransactionSync::pushPrefilledTxs(HashList const& _txsHash)
+{
+    if (_txsHash.empty())
+    {
+        return;
+    }
+    // most of the txs have been broadcast to the consensus nodes already, only push the hashes,
+    // the peers request the bodies they miss through onPeerTxsStatus
+    auto txsStatus =
+        m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsStatusPacket, _txsHash);
+    auto packetData = txsStatus->encode();
+    SYNC_LOG(DEBUG) << LOG_DESC("pushPrefilledTxs") << LOG_KV("txsSize", _txsHash.size())
+                    << LOG_KV("packetSize", packetData->size());
+    task::wait([](decltype(packetData) packetData,
+                   bcos::front::FrontServiceInterface::Ptr front) -> task::Task<void> {
+        co_await front->broadcastMessage(bcos::protocol::NodeType::CONSENSUS_NODE,
+            ModuleID::TxsSync, ::ranges::views::single(ref(*packetData)));
+    }(std::move(packetData), m_config->frontService()));
+}
+
 void TransactionSync::stop()
 {
     SYNC_LOG(INFO) << LOG_DESC("stop TransactionSync");
@@ -23,6 +23,7 @@
 #include "bcos-crypto/interfaces/crypto/Signature.h"
 #include "bcos-txpool/sync/TransactionSyncConfig.h"
 #include "bcos-txpool/sync/interfaces/TransactionSyncInterface.h"
+#include "bcos-txpool/txpool/validator/SenderCache.h"
 #include <bcos-framework/protocol/Protocol.h>
 #include <bcos-utilities/ThreadPool.h>
 #include <bcos-utilities/Worker.h>
@@ -59,8 +60,15 @@ public:
 
     void onEmptyTxs() override;
 
+    void pushPrefilledTxs(bcos::crypto::HashList const& _txsHash) override;
+
     void stop() override;
 
+    void setSenderCache(bcos::txpool::SenderCache::Ptr _senderCache)
+    {
+        m_senderCache = std::move(_senderCache);
+    }
+
 protected:
     virtual void responseTxsStatus(bcos::crypto::NodeIDPtr _fromNode);
 
@@ -94,6 +102,8 @@ protected:
 private:
     bcos::crypto::Hash::Ptr m_hashImpl;
     bcos::crypto::SignatureCrypto::Ptr m_signatureImpl;
+    // the senders already recovered by the txpool when the txs were gossiped
+    bcos::txpool::SenderCache::Ptr m_senderCache;
 
     bool m_checkTransactionSignature;
 };
@@ -43,6 +43,10 @@ public:
     virtual void onRecvSyncMessage(bcos::Error::Ptr _error, bcos::crypto::NodeIDPtr _nodeID,
         bytesConstRef _data, std::function<void(bytesConstRef)> _sendResponse) = 0;
 
+    // push the hashes of the proposal txs that the consensus nodes may not have received yet, they
+    // fetch the missing bodies ahead of the proposal instead of when verifying it
+    virtual void pushPrefilledTxs(bcos::crypto::HashList const& _txsHash) = 0;
+
     virtual TransactionSyncConfig::Ptr config() { return m_config; }
     virtual void onEmptyTxs() = 0;
     virtual void stop() = 0;
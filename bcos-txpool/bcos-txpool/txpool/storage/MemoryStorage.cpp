@@ -58,6 +58,11 @@ MemoryStorage::MemoryStorage(
     // Trigger a transaction cleanup operation every 3s
     m_cleanUpTimer->registerTimeoutHandler([this] { cleanUpExpiredTransactions(); });
     m_txsSizeNotifierTimer->registerTimeoutHandler([this] { notifyTxsSize(); });
+    // the ledger nonce cache has been filled by the web3 nonce check before the tx is indexed
+    m_txQueue.setNonceResolver([this](std::string_view sender) -> std::optional<u256> {
+        return task::syncWait(
+            m_config->txValidator()->web3NonceChecker()->getLedgerNonce(sender));
+    });
     TXPOOL_LOG(INFO) << LOG_DESC("init MemoryStorage of txpool")
                      << LOG_KV("txNotifierWorkerNum", _notifyWorkerNum)
                      << LOG_KV("txsExpirationTime", m_txsExpirationTime)
@@ -66,6 +71,7 @@ MemoryStorage::MemoryStorage(
 
 void MemoryStorage::start()
 {
+    m_txQueue.setPolicy(m_config->txPriorityPolicy());
     m_cleanUpTimer->start();
     m_txsSizeNotifierTimer->start();
 }
@@ -253,6 +259,7 @@ TransactionStatus MemoryStorage::enforceSubmitTransaction(Transaction::Ptr _tx)
                 {
                     m_bcosTransactions.unsealTransactions.remove(accessor);
                 }
+                m_txQueue.erase(*tx);
                 TxsMap::WriteAccessor accessor;
                 m_bcosTransactions.sealedTransactions.insert(
                     accessor, std::make_pair(tx->hash(), tx));
@@ -370,19 +377,23 @@ TransactionStatus MemoryStorage::verifyAndSubmitTransaction(
 
 TransactionStatus MemoryStorage::insert(Transaction::Ptr transaction)
 {
-    auto* toMap = transaction->sealed() ? &m_bcosTransactions.sealedTransactions :
-                                          &m_bcosTransactions.unsealTransactions;
-    auto* ptr = transaction.get();
+    auto sealed = transaction->sealed();
+    auto* toMap = sealed ? &m_bcosTransactions.sealedTransactions :
+                           &m_bcosTransactions.unsealTransactions;
     if (TxsMap::WriteAccessor accessor;
-        !toMap->insert(accessor, {transaction->hash(), std::move(transaction)}))
+        !toMap->insert(accessor, {transaction->hash(), transaction}))
     {
-        if (ptr->submitCallback() && !accessor.value()->submitCallback())
+        if (transaction->submitCallback() && !accessor.value()->submitCallback())
         {
-            accessor.value()->setSubmitCallback(ptr->submitCallback());
+            accessor.value()->setSubmitCallback(transaction->submitCallback());
             return TransactionStatus::None;
         }
         return TransactionStatus::AlreadyInTxPool;
     }
+    if (!sealed)
+    {
+        m_txQueue.push(transaction);
+    }
     return TransactionStatus::None;
 }
 
@@ -534,6 +545,13 @@ void MemoryStorage::batchRemoveSealedTxs(
     startT = utcTime();
     task::syncWait(m_config->txValidator()->web3NonceChecker()->updateNonceCache(
         ::ranges::views::all(web3NonceMap)));
+    for (auto const& [sender, nonceSet] : web3NonceMap)
+    {
+        if (!nonceSet.empty())
+        {
+            m_txQueue.updateNonce(sender, *nonceSet.rbegin() + 1);
+        }
+    }
     auto updateWeb3NonceT = utcTime() - startT;
 
     startT = utcTime();
@@ -586,18 +604,17 @@ bool MemoryStorage::batchSealTransactions(std::vector<protocol::TransactionMetaD
     std::vector<Transaction::Ptr> invalidTxs;
     auto handleTx = [&](const Transaction::Ptr& tx) {
         traverseCount++;
-        auto txHash = tx->hash();
         // the transaction has already been sealed for newer proposal
         if (tx->sealed())
         {
             ++sealed;
-            return false;
+            return TxSealResult::Skipped;
         }
 
         if (currentTime > (tx->importTime() + m_txsExpirationTime))
         {
             invalidTxs.emplace_back(tx);
-            return false;
+            return TxSealResult::Invalid;
         }
 
         /// check nonce again when obtain transactions
@@ -615,7 +632,7 @@ bool MemoryStorage::batchSealTransactions(std::vector<protocol::TransactionMetaD
             transaction->takeSubmitCallback();
             // add to m_invalidTxs to be deleted
             invalidTxs.emplace_back(tx);
-            return false;
+            return TxSealResult::Invalid;
         }
         // blockLimit expired
         if (result == TransactionStatus::BlockLimitCheckFail)
@@ -623,7 +640,7 @@ bool MemoryStorage::batchSealTransactions(std::vector<protocol::TransactionMetaD
             TXPOOL_LOG(WARNING) << "txPool blocklimit check failed, hash:" << tx->hash()
                                 << " blockLimit:" << tx->blockLimit() << " nonce:" << tx->nonce();
             invalidTxs.emplace_back(tx);
-            return false;
+            return TxSealResult::Invalid;
         }
         auto txMetaData = m_config->blockFactory()->createTransactionMetaData();
         txMetaData->setHash(tx->hash());
@@ -647,19 +664,13 @@ bool MemoryStorage::batchSealTransactions(std::vector<protocol::TransactionMetaD
         tx->setSealed(true);
         tx->setBatchId(-1);
         tx->setBatchHash(HashType());
-        m_knownLatestSealedTxHash = txHash;
-        return true;
+        return TxSealResult::Sealed;
     };
 
-    for (auto& accessor : m_bcosTransactions.unsealTransactions.rangeByKey<TxsMap::ReadAccessor>(
-             m_knownLatestSealedTxHash))
+    // only the ready txs are popped from the queue, no need to traverse the whole txpool
+    if (auto fetchedSize = _txsList.size() + _sysTxsList.size(); fetchedSize < _txsLimit)
     {
-        const auto& tx = accessor.value();
-        handleTx(tx);
-        if (!((_txsList.size() + _sysTxsList.size()) < _txsLimit))
-        {
-            break;
-        }
+        m_txQueue.seal(_txsLimit - fetchedSize, handleTx);
     }
     auto invalidTxsSize = invalidTxs.size();
     removeInvalidTxs(invalidTxs);
@@ -692,7 +703,8 @@ bool MemoryStorage::batchSealTransactions(std::vector<protocol::TransactionMetaD
                      << LOG_KV("pendingTxs", m_bcosTransactions.unsealTransactions.size())
                      << LOG_KV("limit", _txsLimit) << LOG_KV("fetchTxsT", fetchTxsT)
                      << LOG_KV("lockT", lockT) << LOG_KV("invalidBefore", invalidTxsSize)
-                     << LOG_KV("sealed", sealed) << LOG_KV("traverseCount", traverseCount);
+                     << LOG_KV("sealed", sealed) << LOG_KV("traverseCount", traverseCount)
+                     << LOG_KV("readyQueueSize", m_txQueue.size());
     return true;
 }
 
@@ -733,6 +745,7 @@ void MemoryStorage::removeInvalidTxs(std::span<bcos::protocol::Transaction::Ptr>
 
         for (const auto& tx2Remove : txs2Remove | ::ranges::views::keys)
         {
+            m_txQueue.erase(*txs2Remove[tx2Remove]);
             if (decltype(m_bcosTransactions.unsealTransactions)::WriteAccessor accessor;
                 m_bcosTransactions.unsealTransactions.find(accessor, tx2Remove))
             {
@@ -773,6 +786,7 @@ void MemoryStorage::clear()
 {
     m_bcosTransactions.sealedTransactions.clear();
     m_bcosTransactions.unsealTransactions.clear();
+    m_txQueue.clear();
 }
 
 HashList MemoryStorage::filterUnknownTxs(crypto::HashListView _txsHashList, NodeIDPtr _peer)
@@ -802,7 +816,6 @@ bool MemoryStorage::batchMarkTxs(crypto::HashListView _txsHashList, BlockNumber
     std::atomic_size_t successCount = 0;
     std::atomic_size_t notFound = 0;
     std::atomic_size_t reSealed = 0;
-    std::atomic_int64_t knownLatestSealedTxIndex = -1;
 
     TxsMap* fromMap = _sealFlag ? std::addressof(m_bcosTransactions.unsealTransactions) :
                                   std::addressof(m_bcosTransactions.sealedTransactions);
@@ -814,7 +827,6 @@ bool MemoryStorage::batchMarkTxs(crypto::HashListView _txsHashList, BlockNumber
             size_t localNotFound = 0;
             size_t localReSealed = 0;
             size_t localSuccess = 0;
-            int64_t localKnownLatestSealedTxIndex = -1;
             for (auto index : range)
             {
                 auto hash = _txsHashList[index];
@@ -850,30 +862,13 @@ bool MemoryStorage::batchMarkTxs(crypto::HashListView _txsHashList, BlockNumber
                 {
                     transaction->setBatchId(_batchId);
                     transaction->setBatchHash(_batchHash);
-                    if (static_cast<int64_t>(index) > localKnownLatestSealedTxIndex)
-                    {
-                        localKnownLatestSealedTxIndex = index;
-                    }
                 }
             }
 
             successCount += localSuccess;
             notFound += localNotFound;
             reSealed += localReSealed;
-            if (localKnownLatestSealedTxIndex > 0)
-            {
-                auto current = knownLatestSealedTxIndex.load();
-                while (localKnownLatestSealedTxIndex > current &&
-                       !knownLatestSealedTxIndex.compare_exchange_strong(
-                           current, localKnownLatestSealedTxIndex))
-                {
-                }
-            }
         });
-    if (knownLatestSealedTxIndex > 0)
-    {
-        m_knownLatestSealedTxHash = _txsHashList[knownLatestSealedTxIndex];
-    }
 
     auto removedEnd =
         ::ranges::remove_if(moveTransactions, [](const auto& tx) { return tx == nullptr; });
@@ -882,6 +877,17 @@ bool MemoryStorage::batchMarkTxs(crypto::HashListView _txsHashList, BlockNumber
         ::ranges::views::transform(removedRange, [](const auto& tx) { return tx->hash(); }));
     toMap->batchInsert(::ranges::views::transform(
         removedRange, [](const auto& tx) { return std::make_pair(tx->hash(), tx); }));
+    for (const auto& tx : removedRange)
+    {
+        if (_sealFlag)
+        {
+            m_txQueue.erase(*tx);
+        }
+        else
+        {
+            m_txQueue.push(tx);
+        }
+    }
 
     TXPOOL_LOG(INFO) << LOG_DESC("batchMarkTxs") << LOG_KV("txsSize", _txsHashList.size())
                      << LOG_KV("batchId", _batchId) << LOG_KV("hash", _batchHash.abridged())
@@ -917,6 +923,17 @@ void MemoryStorage::batchMarkAllTxs(bool _sealFlag)
             tx->setBatchHash(HashType());
         }
     }
+    for (const auto& tx : ::ranges::views::values(moveTxs))
+    {
+        if (_sealFlag)
+        {
+            m_txQueue.erase(*tx);
+        }
+        else
+        {
+            m_txQueue.push(tx);
+        }
+    }
 }
 
 std::shared_ptr<HashList> MemoryStorage::batchVerifyProposal(Block::ConstPtr _block)
@@ -1203,6 +1220,7 @@ void MemoryStorage::remove(crypto::HashType const& _txHash)
     }
     else if (m_bcosTransactions.unsealTransactions.find(accessor, _txHash))
     {
+        m_txQueue.erase(*accessor.value());
         m_bcosTransactions.unsealTransactions.remove(accessor);
     }
 }
@@ -24,6 +24,7 @@
 #include "bcos-framework/protocol/TransactionMetaData.h"
 #include "bcos-task/Task.h"
 #include "bcos-txpool/TxPoolConfig.h"
+#include "bcos-txpool/txpool/storage/TxPriorityQueue.h"
 #include "bcos-txpool/txpool/utilities/Common.h"
 #include "txpool/interfaces/TxPoolStorageInterface.h"
 #include <bcos-utilities/BucketMap.h>
@@ -125,6 +126,8 @@ protected:
         {}
     };
     BcosTransactions m_bcosTransactions;
+    // the ready-queue index over unsealTransactions, used to seal txs without rescanning the pool
+    TxPriorityQueue m_txQueue;
 
     std::atomic<bcos::protocol::BlockNumber> m_blockNumber = {0};
     uint64_t m_blockNumberUpdatedTime;
@@ -135,6 +138,5 @@ protected:
     std::shared_ptr<Timer> m_cleanUpTimer;
     // timer to notify txs size
     std::shared_ptr<Timer> m_txsSizeNotifierTimer;
-    bcos::crypto::HashType m_knownLatestSealedTxHash;
 };
 }  // namespace bcos::txpool
\ No newline at end of file
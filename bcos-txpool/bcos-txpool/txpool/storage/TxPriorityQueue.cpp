@@ -0,0 +1,469 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the ready-queue index over the unsealed transactions of the txpool
+ * @file TxPriorityQueue.cpp
+ * @date 2026-10-19
+ */
+#include "bcos-txpool/txpool/storage/TxPriorityQueue.h"
+#include <bcos-framework/txpool/TxPoolTypeDef.h>
+#include <algorithm>
+
+using namespace bcos;
+using namespace bcos::txpool;
+using namespace bcos::protocol;
+using namespace bcos::crypto;
+
+namespace
+{
+bool isWeb3Transaction(const Transaction& _tx)
+{
+    return _tx.type() == static_cast<uint8_t>(TransactionType::Web3Transaction);
+}
+
+std::optional<u256> parseU256(std::string_view _value)
+{
+    if (_value.empty())
+    {
+        return std::nullopt;
+    }
+    try
+    {
+        return u256(std::string(_value));
+    }
+    catch (std::exception const&)
+    {
+        return std::nullopt;
+    }
+}
+}  // namespace
+
+void TxPriorityQueue::setPolicy(TxPriorityPolicy _policy)
+{
+    std::unique_lock lock(m_mutex);
+    m_policy = _policy;
+}
+
+TxPriorityPolicy TxPriorityQueue::policy() const
+{
+    std::unique_lock lock(m_mutex);
+    return m_policy;
+}
+
+void TxPriorityQueue::setNonceResolver(NonceResolver _resolver)
+{
+    std::unique_lock lock(m_mutex);
+    m_nonceResolver = std::move(_resolver);
+}
+
+u256 TxPriorityQueue::calculatePriority(const Transaction& _tx) const
+{
+    if (m_policy != TxPriorityPolicy::GasPrice)
+    {
+        return 0;
+    }
+    if (auto priorityFee = parseU256(_tx.maxPriorityFeePerGas()))
+    {
+        return *priorityFee;
+    }
+    return parseU256(_tx.gasPrice()).value_or(0);
+}
+
+void TxPriorityQueue::pushHeap(const Transaction::Ptr& _tx, uint64_t _sequence)
+{
+    m_heap.push(HeapItem{.priority = calculatePriority(*_tx),
+        .importTime = _tx->importTime(),
+        .sequence = _sequence,
+        .tx = _tx});
+}
+
+bool TxPriorityQueue::isReady(const SenderQueue& _queue, const u256& _nonce) const
+{
+    if (_queue.txs.empty())
+    {
+        return false;
+    }
+    return _nonce == _queue.nextNonce.value_or(_queue.txs.begin()->first);
+}
+
+void TxPriorityQueue::scheduleSender(SenderQueue& _queue)
+{
+    if (_queue.txs.empty())
+    {
+        return;
+    }
+    auto& [nonce, tx] = *_queue.txs.begin();
+    if (!isReady(_queue, nonce))
+    {
+        return;
+    }
+    if (auto it = m_entries.find(tx->hash()); it != m_entries.end())
+    {
+        pushHeap(tx, it->second.sequence);
+    }
+}
+
+void TxPriorityQueue::push(const Transaction::Ptr& _tx)
+{
+    auto hash = _tx->hash();
+    auto web3 = isWeb3Transaction(*_tx);
+    u256 nonce = 0;
+    if (web3)
+    {
+        auto parsedNonce = parseU256(_tx->nonce());
+        if (!parsedNonce)
+        {
+            TXPOOL_LOG(WARNING) << LOG_DESC("TxPriorityQueue: ignore tx with invalid nonce")
+                                << LOG_KV("hash", hash.abridged())
+                                << LOG_KV("nonce", _tx->nonce());
+            return;
+        }
+        nonce = *parsedNonce;
+    }
+
+    std::unique_lock lock(m_mutex);
+    auto [entryIt, inserted] = m_entries.try_emplace(
+        hash, Entry{.sequence = m_sequence, .web3 = web3, .nonce = nonce});
+    if (!inserted)
+    {
+        return;
+    }
+    ++m_sequence;
+    if (!web3)
+    {
+        pushHeap(_tx, entryIt->second.sequence);
+        return;
+    }
+
+    auto sender = _tx->sender();
+    auto senderIt = m_senders.find(sender);
+    if (senderIt == m_senders.end())
+    {
+        // the ledger nonce is resolved lazily by the sealer, keep the submit path cheap
+        senderIt = m_senders.emplace(std::string(sender), SenderQueue{}).first;
+    }
+    auto& queue = senderIt->second;
+    if (auto [it, success] = queue.txs.try_emplace(nonce, _tx); !success)
+    {
+        // another tx with the same nonce is queued, keep the first one
+        m_entries.erase(entryIt);
+        return;
+    }
+    // the tx has been unsealed again, roll back the frontier to reseal it
+    if (queue.nextNonce && nonce < *queue.nextNonce)
+    {
+        queue.nextNonce = nonce;
+    }
+    if (isReady(queue, nonce))
+    {
+        pushHeap(_tx, entryIt->second.sequence);
+    }
+}
+
+void TxPriorityQueue::eraseUnlocked(const HashType& _hash, std::string_view _sender)
+{
+    auto it = m_entries.find(_hash);
+    if (it == m_entries.end())
+    {
+        return;
+    }
+    auto entry = it->second;
+    m_entries.erase(it);
+    if (!entry.web3)
+    {
+        return;
+    }
+    auto senderIt = m_senders.find(_sender);
+    if (senderIt == m_senders.end())
+    {
+        return;
+    }
+    auto& queue = senderIt->second;
+    auto wasReady = isReady(queue, entry.nonce);
+    queue.txs.erase(entry.nonce);
+    if (queue.txs.empty())
+    {
+        m_senders.erase(senderIt);
+        return;
+    }
+    if (wasReady)
+    {
+        scheduleSender(queue);
+    }
+}
+
+void TxPriorityQueue::erase(const Transaction& _tx)
+{
+    std::unique_lock lock(m_mutex);
+    eraseUnlocked(_tx.hash(), _tx.sender());
+}
+
+void TxPriorityQueue::updateNonce(std::string_view _sender, const u256& _nextNonce)
+{
+    std::unique_lock lock(m_mutex);
+    auto senderIt = m_senders.find(_sender);
+    if (senderIt == m_senders.end())
+    {
+        return;
+    }
+    auto& queue = senderIt->second;
+    if (!queue.nextNonce || *queue.nextNonce < _nextNonce)
+    {
+        queue.nextNonce = _nextNonce;
+    }
+    // the committed nonces can never be sealed again
+    for (auto it = queue.txs.begin(); it != queue.txs.end() && it->first < _nextNonce;)
+    {
+        m_entries.erase(it->second->hash());
+        it = queue.txs.erase(it);
+    }
+    if (queue.txs.empty())
+    {
+        m_senders.erase(senderIt);
+        return;
+    }
+    scheduleSender(queue);
+}
+
+size_t TxPriorityQueue::seal(size_t _limit, const SealHandler& _handler)
+{
+    size_t sealedCount = 0;
+    while (sealedCount < _limit)
+    {
+        // pop a batch of candidates under the lock, the nonce resolver and the handler may query
+        // the ledger so they run without the lock
+        std::vector<Candidate> candidates;
+        std::vector<std::string> unresolvedSenders;
+        {
+            std::unique_lock lock(m_mutex);
+            popCandidates(_limit - sealedCount, candidates, unresolvedSenders);
+        }
+        if (candidates.empty())
+        {
+            break;
+        }
+        if (!unresolvedSenders.empty())
+        {
+            NonceResolver resolver;
+            {
+                std::unique_lock lock(m_mutex);
+                resolver = m_nonceResolver;
+            }
+            std::vector<std::optional<u256>> nonces;
+            nonces.reserve(unresolvedSenders.size());
+            for (auto const& sender : unresolvedSenders)
+            {
+                nonces.emplace_back(resolver(sender));
+            }
+            std::unique_lock lock(m_mutex);
+            applyResolvedNonces(unresolvedSenders, nonces, candidates);
+        }
+
+        for (auto& candidate : candidates)
+        {
+            if (candidate.ready)
+            {
+                candidate.result = _handler(candidate.item.tx);
+                if (candidate.result == TxSealResult::Sealed)
+                {
+                    ++sealedCount;
+                }
+            }
+        }
+
+        std::unique_lock lock(m_mutex);
+        applySealResults(candidates);
+    }
+    std::unique_lock lock(m_mutex);
+    compactHeap();
+    return sealedCount;
+}
+
+void TxPriorityQueue::popCandidates(size_t _limit, std::vector<Candidate>& _candidates,
+    std::vector<std::string>& _unresolvedSenders)
+{
+    while (_candidates.size() < _limit && !m_heap.empty())
+    {
+        auto item = m_heap.top();
+        m_heap.pop();
+
+        auto entryIt = m_entries.find(item.tx->hash());
+        // stale item: the tx has been erased, pushed again or is being sealed
+        if (entryIt == m_entries.end() || entryIt->second.sequence != item.sequence ||
+            entryIt->second.sealing)
+        {
+            continue;
+        }
+        auto& entry = entryIt->second;
+        if (entry.web3)
+        {
+            auto senderIt = m_senders.find(item.tx->sender());
+            if (senderIt == m_senders.end())
+            {
+                continue;
+            }
+            auto& queue = senderIt->second;
+            if (!queue.nextNonce && m_nonceResolver)
+            {
+                if (std::find(_unresolvedSenders.begin(), _unresolvedSenders.end(),
+                        senderIt->first) == _unresolvedSenders.end())
+                {
+                    _unresolvedSenders.emplace_back(senderIt->first);
+                }
+            }
+            // the gap before the nonce will be filled by the tx to be pushed later
+            else if (!isReady(queue, entry.nonce))
+            {
+                continue;
+            }
+        }
+        entry.sealing = true;
+        _candidates.emplace_back(Candidate{.item = std::move(item), .entry = entry});
+    }
+}
+
+void TxPriorityQueue::applyResolvedNonces(std::vector<std::string> const& _senders,
+    std::vector<std::optional<u256>> const& _nonces, std::vector<Candidate>& _candidates)
+{
+    for (size_t i = 0; i < _senders.size(); ++i)
+    {
+        auto senderIt = m_senders.find(_senders[i]);
+        if (senderIt == m_senders.end() || senderIt->second.nextNonce || !_nonces[i])
+        {
+            continue;
+        }
+        auto& queue = senderIt->second;
+        queue.nextNonce = _nonces[i];
+        // the nonces below the ledger nonce have been committed and can never be sealed
+        for (auto it = queue.txs.begin(); it != queue.txs.end() && it->first < *_nonces[i];)
+        {
+            m_entries.erase(it->second->hash());
+            it = queue.txs.erase(it);
+        }
+        scheduleSender(queue);
+    }
+    for (auto& candidate : _candidates)
+    {
+        if (!candidate.entry.web3)
+        {
+            continue;
+        }
+        auto senderIt = m_senders.find(candidate.item.tx->sender());
+        if (senderIt != m_senders.end() && isReady(senderIt->second, candidate.entry.nonce))
+        {
+            continue;
+        }
+        // not ready with the resolved frontier, the tx is pushed again once the gap is filled
+        candidate.ready = false;
+        if (auto entryIt = m_entries.find(candidate.item.tx->hash());
+            entryIt != m_entries.end() && entryIt->second.sequence == candidate.item.sequence)
+        {
+            entryIt->second.sealing = false;
+        }
+    }
+}
+
+void TxPriorityQueue::applySealResults(std::vector<Candidate> const& _candidates)
+{
+    for (auto const& candidate : _candidates)
+    {
+        if (!candidate.ready)
+        {
+            continue;
+        }
+        auto const& tx = candidate.item.tx;
+        // the tx may have been erased while being sealed
+        if (auto entryIt = m_entries.find(tx->hash());
+            entryIt != m_entries.end() && entryIt->second.sequence == candidate.item.sequence)
+        {
+            m_entries.erase(entryIt);
+        }
+        if (!candidate.entry.web3)
+        {
+            continue;
+        }
+        auto senderIt = m_senders.find(tx->sender());
+        if (senderIt == m_senders.end())
+        {
+            continue;
+        }
+        auto& queue = senderIt->second;
+        auto nonce = candidate.entry.nonce;
+        if (auto it = queue.txs.find(nonce); it != queue.txs.end() && it->second == tx)
+        {
+            queue.txs.erase(it);
+        }
+        // the nonce has been consumed by this or another proposal, the next one becomes ready,
+        // unless the frontier has been moved while the tx was being sealed
+        if (candidate.result != TxSealResult::Invalid)
+        {
+            if (!queue.nextNonce || *queue.nextNonce == nonce)
+            {
+                queue.nextNonce = nonce + 1;
+            }
+        }
+        else if (!queue.nextNonce)
+        {
+            // pin the frontier, the following nonces wait for the nonce to be resubmitted
+            queue.nextNonce = nonce;
+        }
+        // keep the empty sender queue to remember the frontier until the block is committed
+        scheduleSender(queue);
+    }
+}
+
+void TxPriorityQueue::compactHeap()
+{
+    if (m_heap.size() <= m_entries.size() + TX_QUEUE_COMPACT_THRESHOLD)
+    {
+        return;
+    }
+    auto originSize = m_heap.size();
+    std::vector<HeapItem> items;
+    items.reserve(m_entries.size());
+    while (!m_heap.empty())
+    {
+        auto& item = m_heap.top();
+        if (auto it = m_entries.find(item.tx->hash());
+            it != m_entries.end() && it->second.sequence == item.sequence)
+        {
+            items.emplace_back(item);
+        }
+        m_heap.pop();
+    }
+    m_heap = decltype(m_heap)(HeapItemCompare{}, std::move(items));
+    TXPOOL_LOG(DEBUG) << LOG_DESC("TxPriorityQueue: compact heap") << LOG_KV("before", originSize)
+                      << LOG_KV("after", m_heap.size()) << LOG_KV("entries", m_entries.size());
+}
+
+size_t TxPriorityQueue::size() const
+{
+    std::unique_lock lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t TxPriorityQueue::sendersSize() const
+{
+    std::unique_lock lock(m_mutex);
+    return m_senders.size();
+}
+
+void TxPriorityQueue::clear()
+{
+    std::unique_lock lock(m_mutex);
+    m_entries.clear();
+    m_senders.clear();
+    m_heap = {};
+}
@@ -0,0 +1,165 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the ready-queue index over the unsealed transactions of the txpool
+ * @file TxPriorityQueue.h
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include "bcos-txpool/txpool/utilities/Common.h"
+#include <bcos-framework/protocol/Transaction.h>
+#include <bcos-utilities/BucketMap.h>
+#include <bcos-utilities/Common.h>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+
+namespace bcos::txpool
+{
+enum class TxSealResult : int8_t
+{
+    Sealed = 0,
+    // the tx is no longer sealable by this node (e.g. sealed by another proposal), drop it
+    Skipped,
+    // the tx failed the seal-time check and will be removed from the txpool
+    Invalid,
+};
+
+/**
+ * Index of the unsealed transactions that lets the sealer pull ready transactions in
+ * O(k log n) without rescanning the whole txpool.
+ *
+ * - BCOS transactions use random nonces and are always ready, they enter the global heap directly.
+ * - Web3 transactions are kept in a per-sender queue ordered by nonce, only the transaction whose
+ *   nonce equals the next expected nonce of the sender is placed in the global heap, so gapped
+ *   nonces are never sealed.
+ *
+ * Entries are invalidated lazily: erase() only drops the index entry, stale heap items are
+ * discarded when popped and the heap is compacted when it holds too many of them.
+ */
+class TxPriorityQueue
+{
+public:
+    using SealHandler = std::function<TxSealResult(const protocol::Transaction::Ptr&)>;
+    // return the ledger nonce of the web3 sender, std::nullopt if unknown
+    using NonceResolver = std::function<std::optional<u256>(std::string_view)>;
+
+    TxPriorityQueue() = default;
+    ~TxPriorityQueue() = default;
+    TxPriorityQueue(const TxPriorityQueue&) = delete;
+    TxPriorityQueue(TxPriorityQueue&&) = delete;
+    TxPriorityQueue& operator=(const TxPriorityQueue&) = delete;
+    TxPriorityQueue& operator=(TxPriorityQueue&&) = delete;
+
+    void setPolicy(TxPriorityPolicy _policy);
+    TxPriorityPolicy policy() const;
+    void setNonceResolver(NonceResolver _resolver);
+
+    // index an unsealed transaction, called when the tx enters the txpool or is unsealed again
+    void push(const protocol::Transaction::Ptr& _tx);
+    // drop the index entry of the tx, called when the tx is sealed, removed or committed
+    void erase(const protocol::Transaction& _tx);
+    // the ledger nonce of the web3 sender has been advanced to _nextNonce by a committed block
+    void updateNonce(std::string_view _sender, const u256& _nextNonce);
+
+    /**
+     * pop at most _limit ready transactions in priority order
+     * @param _handler: decide whether the popped tx is sealed, the handler and the nonce resolver
+     * are called without holding the lock of the queue
+     * @return the number of sealed transactions
+     */
+    size_t seal(size_t _limit, const SealHandler& _handler);
+
+    // the number of indexed transactions
+    size_t size() const;
+    // the number of web3 senders with pending transactions
+    size_t sendersSize() const;
+    void clear();
+
+private:
+    struct HeapItem
+    {
+        u256 priority;
+        int64_t importTime;
+        uint64_t sequence;
+        protocol::Transaction::Ptr tx;
+    };
+    struct HeapItemCompare
+    {
+        // std::priority_queue pops the largest element: higher priority, then earlier import time
+        // and earlier push order
+        bool operator()(const HeapItem& _lhs, const HeapItem& _rhs) const
+        {
+            if (_lhs.priority != _rhs.priority)
+            {
+                return _lhs.priority < _rhs.priority;
+            }
+            if (_lhs.importTime != _rhs.importTime)
+            {
+                return _lhs.importTime > _rhs.importTime;
+            }
+            return _lhs.sequence > _rhs.sequence;
+        }
+    };
+    struct Entry
+    {
+        uint64_t sequence;
+        bool web3;
+        u256 nonce;
+        // popped by the sealer and being checked outside the lock
+        bool sealing = false;
+    };
+    struct Candidate
+    {
+        HeapItem item;
+        Entry entry;
+        bool ready = true;
+        TxSealResult result = TxSealResult::Skipped;
+    };
+    struct SenderQueue
+    {
+        std::map<u256, protocol::Transaction::Ptr> txs;
+        // the next nonce expected to be sealed, resolved from the ledger nonce when the sender is
+        // first popped; std::nullopt if unknown, in which case the lowest pending nonce is ready
+        std::optional<u256> nextNonce;
+    };
+
+    u256 calculatePriority(const protocol::Transaction& _tx) const;
+    void pushHeap(const protocol::Transaction::Ptr& _tx, uint64_t _sequence);
+    // push the head of the sender queue into the heap if it is ready
+    void scheduleSender(SenderQueue& _queue);
+    bool isReady(const SenderQueue& _queue, const u256& _nonce) const;
+    void eraseUnlocked(const crypto::HashType& _hash, std::string_view _sender);
+    void popCandidates(size_t _limit, std::vector<Candidate>& _candidates,
+        std::vector<std::string>& _unresolvedSenders);
+    void applyResolvedNonces(std::vector<std::string> const& _senders,
+        std::vector<std::optional<u256>> const& _nonces, std::vector<Candidate>& _candidates);
+    void applySealResults(std::vector<Candidate> const& _candidates);
+    void compactHeap();
+
+    TxPriorityPolicy m_policy = TxPriorityPolicy::ImportTime;
+    NonceResolver m_nonceResolver;
+
+    std::unordered_map<crypto::HashType, Entry, std::hash<crypto::HashType>> m_entries;
+    std::unordered_map<std::string, SenderQueue, bcos::StringHash, std::equal_to<>> m_senders;
+    std::priority_queue<HeapItem, std::vector<HeapItem>, HeapItemCompare> m_heap;
+    uint64_t m_sequence = 0;
+    mutable std::mutex m_mutex;
+};
+}  // namespace bcos::txpool
@@ -1,5 +1,6 @@
 #include "Web3Transactions.h"
 #include <charconv>
+#include <limits>
 
 int64_t bcos::txpool::TransactionData::importTime() const
 {
@@ -30,6 +31,14 @@ bcos::txpool::TransactionData::TransactionData(protocol::Transaction::Ptr transa
         return nonce;
     }())
 {}
+std::string_view bcos::txpool::SenderFrontier::sender() const
+{
+    return m_sender;
+}
+bool bcos::txpool::SenderFrontier::idle(uint64_t epoch) const
+{
+    return m_committedNonce && m_pendingNonce == *m_committedNonce && m_refreshedEpoch == epoch;
+}
 void bcos::txpool::Web3Transactions::add(protocol::Transaction::Ptr transaction)
 {
     auto& nonceIndex = m_transactions.get<0>();
@@ -52,6 +61,71 @@ void bcos::txpool::Web3Transactions::add(protocol::Transaction::Ptr transaction)
     }
     else
     {
-        nonceIndex.emplace_hint(it, std::move(transactionData));
+        it = nonceIndex.emplace_hint(it, std::move(transactionData));
+    }
+
+    auto& senderIndex = m_senders.get<0>();
+    auto frontierIt = senderIndex.find(it->sender());
+    if (frontierIt == senderIndex.end())
+    {
+        m_senders.get<1>().push_back(SenderFrontier{.m_sender = std::string(it->sender())});
+        return;
+    }
+    if (frontierIt->m_committedNonce && it->nonce() == frontierIt->m_pendingNonce)
+    {
+        extendPendingNonce(*frontierIt);
+    }
+}
+void bcos::txpool::Web3Transactions::extendPendingNonce(const SenderFrontier& frontier)
+{
+    auto& nonceIndex = m_transactions.get<0>();
+    for (auto it = nonceIndex.lower_bound(
+             std::make_tuple(frontier.sender(), frontier.m_pendingNonce));
+        it != nonceIndex.end() && it->sender() == frontier.sender() &&
+        it->nonce() == frontier.m_pendingNonce;
+        ++it)
+    {
+        ++frontier.m_pendingNonce;
+    }
+}
+void bcos::txpool::Web3Transactions::updateFrontier(std::string_view sender, int64_t committedNonce)
+{
+    auto& senderIndex = m_senders.get<0>();
+    auto frontierIt = senderIndex.find(sender);
+    if (frontierIt == senderIndex.end())
+    {
+        return;
+    }
+    auto& nonceIndex = m_transactions.get<0>();
+    if (auto it =
+            nonceIndex.lower_bound(std::make_tuple(sender, std::numeric_limits<int64_t>::min()));
+        it == nonceIndex.end() || it->sender() != sender)
+    {
+        senderIndex.erase(frontierIt);
+        return;
+    }
+    frontierIt->m_committedNonce =
+        std::max(frontierIt->m_committedNonce.value_or(committedNonce), committedNonce);
+    frontierIt->m_pendingNonce = *frontierIt->m_committedNonce;
+    extendPendingNonce(*frontierIt);
+}
+void bcos::txpool::Web3Transactions::refreshFrontier(
+    const SenderFrontier& frontier, int64_t ledgerNonce)
+{
+    // both the local commit notifications and the ledger only move the nonce forward
+    frontier.m_committedNonce =
+        std::max(frontier.m_committedNonce.value_or(ledgerNonce), ledgerNonce);
+    frontier.m_pendingNonce = *frontier.m_committedNonce;
+    frontier.m_refreshedEpoch = m_commitEpoch;
+    extendPendingNonce(frontier);
+}
+std::optional<int64_t> bcos::txpool::Web3Transactions::pendingNonce(std::string_view sender)
+{
+    std::unique_lock lock(m_mutex);
+    auto& senderIndex = m_senders.get<0>();
+    if (auto it = senderIndex.find(sender); it != senderIndex.end() && it->m_committedNonce)
+    {
+        return it->m_pendingNonce;
     }
+    return std::nullopt;
 }
\ No newline at end of file
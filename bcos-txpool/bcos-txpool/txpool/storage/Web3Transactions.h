@@ -34,6 +34,25 @@ struct TransactionData
     TransactionData(protocol::Transaction::Ptr transaction);
 };
 
+// The executable frontier of one sender, maintained incrementally on add and on commit
+// notifications, so that seal and pending nonce queries do not scan the transactions.
+struct SenderFrontier
+{
+    std::string m_sender;
+    // the next nonce expected by the ledger, known after the first commit notification or seal
+    mutable std::optional<int64_t> m_committedNonce;
+    // the end of the contiguous nonces in the pool starting from m_committedNonce
+    mutable int64_t m_pendingNonce{};
+    // the commit epoch in which m_committedNonce was read from the ledger
+    mutable std::optional<uint64_t> m_refreshedEpoch;
+
+    std::string_view sender() const;
+    // true if no transaction in the pool can be executed on top of the ledger state, only valid
+    // within the commit epoch the ledger nonce was read in: a block sealed by another node can
+    // advance the ledger nonce over a transaction this pool never held
+    bool idle(uint64_t epoch) const;
+};
+
 template <class TransactionsType>
 concept InputTransactions =
     ::ranges::input_range<TransactionsType> &&
@@ -99,23 +118,45 @@ private:
                 std::string_view, &TransactionData::sender>>,
             boost::multi_index::sequenced<>>>;
 
+    // Senders: one SenderFrontier per sender with transactions in the pool
+    //   0 -> hashed_unique by sender, O(1) lookup of the frontier
+    //   1 -> sequenced, the senders are sealed in the order they first entered the pool
+    using Senders = boost::multi_index_container<SenderFrontier,
+        boost::multi_index::indexed_by<
+            boost::multi_index::hashed_unique<boost::multi_index::const_mem_fun<SenderFrontier,
+                std::string_view, &SenderFrontier::sender>>,
+            boost::multi_index::sequenced<>>>;
+
     Transactions m_transactions;
+    Senders m_senders;
     std::mutex m_mutex;
     bool m_rawAddress{};
+    // advanced on every commit notification, invalidates the idle frontiers
+    uint64_t m_commitEpoch = 0;
 
     void add(protocol::Transaction::Ptr transaction);
+    // extend the pending nonce over the contiguous nonces in the pool
+    void extendPendingNonce(const SenderFrontier& frontier);
+    // the nonces up to committedNonce - 1 are on chain, drop the frontier if the sender is gone
+    void updateFrontier(std::string_view sender, int64_t committedNonce);
+    // the ledger nonce has been read in the current commit epoch
+    void refreshFrontier(const SenderFrontier& frontier, int64_t ledgerNonce);
     void remove(SenderNonces auto senderNonces)
     {
+        ++m_commitEpoch;
         auto& senderNonceIndex = m_transactions.get<0>();
 
-        for (auto&& [sender, nonce] : senderNonces)
+        for (auto&& [senderView, nonce] : senderNonces)
         {
+            // the sender may be owned by the erased transaction
+            std::string sender(senderView);
             auto start = senderNonceIndex.lower_bound(std::make_tuple(sender, 0));
             auto end = senderNonceIndex.upper_bound(std::make_tuple(sender, nonce));
             for (auto it = start; it != end;)
             {
                 it = senderNonceIndex.erase(it);
             }
+            updateFrontier(sender, nonce + 1);
         }
     }
 
@@ -136,10 +177,14 @@ public:
         int64_t count = 0;
         std::unique_lock lock(m_mutex);
         auto& senderNonceIndex = m_transactions.get<0>();
-        auto& senderIndex = m_transactions.get<2>();
-        for (const auto& data : senderIndex)
+        for (const auto& frontier : m_senders.get<1>())
         {
-            auto sender = data.sender();
+            // nothing executable since the last commit, skip reading the account
+            if (frontier.idle(m_commitEpoch))
+            {
+                continue;
+            }
+            auto sender = frontier.sender();
             ledger::account::EVMAccount account(state, sender, m_rawAddress);
 
             int64_t currentNonce = 0;
@@ -154,6 +199,7 @@ public:
             }
 
             auto startNonce = currentNonce;
+            refreshFrontier(frontier, currentNonce);
             for (auto nonceIt = senderNonceIndex.lower_bound(std::make_tuple(sender, currentNonce));
                 nonceIt != senderNonceIndex.end() && nonceIt->sender() == sender &&
                 nonceIt->nonce() == currentNonce;
@@ -182,11 +228,9 @@ public:
     task::Task<void> remove(storage2::ReadableStorage<executor_v1::StateKeyView> auto& state)
     {
         std::unique_lock lock(m_mutex);
-        auto& senderNonceIndex = m_transactions.get<0>();
-        auto& senderIndex = m_transactions.get<2>();
 
-        auto senderNonces = ::ranges::views::transform(senderIndex, [](auto& data) {
-            return std::make_tuple(data.sender(), 0L);
+        auto senderNonces = ::ranges::views::transform(m_senders.get<1>(), [](auto& frontier) {
+            return std::make_tuple(std::string(frontier.sender()), 0L);
         }) | ::ranges::to<std::vector>();
 
         for (auto& [sender, nonce] : senderNonces)
@@ -228,6 +272,10 @@ public:
         remove(::ranges::views::all(senderNonceMap));
     }
 
+    // the nonce to be used by the next transaction of the sender (eth_getTransactionCount with
+    // pending tag), std::nullopt if the sender has no frontier yet
+    std::optional<int64_t> pendingNonce(std::string_view sender);
+
     template <InputHashes TransactionHashes>
     std::vector<protocol::Transaction::Ptr> get(TransactionHashes hashes)
     {
@@ -37,4 +37,17 @@ static constexpr const size_t MAX_RETRY_NOTIFY_TIME = 3;
 static constexpr const size_t DEFAULT_POOL_LIMIT = 15000;
 static constexpr const int64_t DEFAULT_BLOCK_LIMIT = 600;
 static constexpr const uint64_t DEFAULT_WEB3_NONCE_CHECK_LIMIT = DEFAULT_BLOCK_LIMIT * 1000;
+// compact the ready-queue heap once the stale items exceed the live ones by this amount
+static constexpr const size_t TX_QUEUE_COMPACT_THRESHOLD = 4096;
+// bytes of signatures and senders kept by the sender recovery cache, about 190k transactions
+static constexpr const int64_t SENDER_CACHE_CAPACITY = 16 * 1024 * 1024;
+
+// the order in which the sealer pulls ready transactions out of the txpool
+enum class TxPriorityPolicy : int8_t
+{
+    // first come first served
+    ImportTime = 0,
+    // higher gasPrice (maxPriorityFeePerGas for EIP-1559 transactions) first
+    GasPrice = 1,
+};
 }  // namespace bcos::txpool
@@ -0,0 +1,69 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief cache of the transaction senders recovered from signatures
+ * @file SenderCache.cpp
+ * @date 2026-10-19
+ */
+#include "SenderCache.h"
+#include "bcos-task/Wait.h"
+#include <bcos-crypto/hash/Keccak256.h>
+#include <bcos-framework/storage2/Storage.h>
+#include <algorithm>
+
+using namespace bcos;
+using namespace bcos::txpool;
+using namespace bcos::protocol;
+
+SenderCache::SenderCache(bcos::crypto::CryptoSuite::Ptr _cryptoSuite, int64_t _capacity)
+  : m_cryptoSuite(std::move(_cryptoSuite)), m_senders(0, _capacity)
+{}
+
+bcos::crypto::HashType SenderCache::signedHash(const Transaction& _tx) const
+{
+    if (_tx.type() == static_cast<uint8_t>(TransactionType::Web3Transaction))
+    {
+        return bcos::crypto::keccak256Hash(_tx.extraTransactionBytes());
+    }
+    return _tx.hash();
+}
+
+void SenderCache::verify(const Transaction& _tx)
+{
+    // The tx has already been verified
+    if (!_tx.sender().empty())
+    {
+        return;
+    }
+    auto hash = signedHash(_tx);
+    auto signature = _tx.signatureData();
+    if (auto entry = task::syncWait(storage2::readOne(m_senders, hash));
+        entry && std::equal(signature.begin(), signature.end(), entry->signature.begin(),
+                     entry->signature.end()))
+    {
+        ++m_hits;
+        _tx.forceSender(entry->sender);
+        return;
+    }
+    ++m_misses;
+    // throw if the signature is invalid
+    auto sender = m_cryptoSuite->signatureImpl()
+                      ->recoverAddress(*m_cryptoSuite->hashImpl(), hash, signature)
+                      .second;
+    _tx.forceSender(sender);
+    task::syncWait(storage2::writeOne(m_senders, hash,
+        Entry{.signature = bcos::bytes(signature.begin(), signature.end()),
+            .sender = std::move(sender)}));
+}
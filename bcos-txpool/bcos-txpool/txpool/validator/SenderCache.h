@@ -0,0 +1,74 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief cache of the transaction senders recovered from signatures
+ * @file SenderCache.h
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-txpool/txpool/utilities/Common.h"
+#include <bcos-crypto/interfaces/crypto/CryptoSuite.h>
+#include <bcos-framework/protocol/Transaction.h>
+#include <bcos-framework/storage2/MemoryStorage.h>
+#include <atomic>
+
+namespace bcos::txpool
+{
+/**
+ * Senders recovered from the transaction signatures, shared by the txpool validator and the
+ * transaction sync, so that a tx received by gossip and again in a proposal or a missed-txs
+ * response is recovered only once by the node.
+ *
+ * The cache is keyed by the hash covered by the signature, and an entry is only used when the
+ * signature matches the cached one. Failed recoveries are not cached.
+ */
+class SenderCache
+{
+public:
+    using Ptr = std::shared_ptr<SenderCache>;
+    explicit SenderCache(
+        bcos::crypto::CryptoSuite::Ptr _cryptoSuite, int64_t _capacity = SENDER_CACHE_CAPACITY);
+    SenderCache(const SenderCache&) = delete;
+    SenderCache(SenderCache&&) = delete;
+    SenderCache& operator=(const SenderCache&) = delete;
+    SenderCache& operator=(SenderCache&&) = delete;
+    ~SenderCache() = default;
+
+    // same as Transaction::verify: set the sender of the tx, throw if the signature is invalid
+    void verify(const bcos::protocol::Transaction& _tx);
+
+    uint64_t hits() const { return m_hits; }
+    uint64_t misses() const { return m_misses; }
+
+private:
+    struct Entry
+    {
+        bcos::bytes signature;
+        bcos::bytes sender;
+
+        // accounted by the LRU capacity
+        size_t size() const { return signature.size() + sender.size(); }
+    };
+    bcos::crypto::HashType signedHash(const bcos::protocol::Transaction& _tx) const;
+
+    bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
+    bcos::storage2::memory_storage::MemoryStorage<bcos::crypto::HashType, Entry,
+        storage2::memory_storage::LRU | storage2::memory_storage::CONCURRENT,
+        std::hash<bcos::crypto::HashType>>
+        m_senders;
+    std::atomic_uint64_t m_hits = 0;
+    std::atomic_uint64_t m_misses = 0;
+};
+}  // namespace bcos::txpool
@@ -57,7 +57,14 @@ TransactionStatus TxValidator::verify(const bcos::protocol::Transaction& _tx)
     // remove in front module check signature
     try
     {
-        _tx.verify(*m_cryptoSuite->hashImpl(), *m_cryptoSuite->signatureImpl());
+        if (m_senderCache)
+        {
+            m_senderCache->verify(_tx);
+        }
+        else
+        {
+            _tx.verify(*m_cryptoSuite->hashImpl(), *m_cryptoSuite->signatureImpl());
+        }
     }
     catch (...)
     {
@@ -25,6 +25,7 @@
 #include <bcos-framework/executor/PrecompiledTypeDef.h>
 #include <bcos-framework/ledger/LedgerInterface.h>
 #include <bcos-task/Task.h>
+#include <bcos-txpool/txpool/validator/SenderCache.h>
 #include <bcos-txpool/txpool/validator/Web3NonceChecker.h>
 #include <bcos-utilities/DataConvertUtility.h>
 
@@ -76,6 +77,8 @@ public:
         m_scheduler = std::move(_scheduler);
     }
 
+    void setSenderCache(SenderCache::Ptr _senderCache) { m_senderCache = std::move(_senderCache); }
+
 protected:
     virtual bool isSystemTransaction(const bcos::protocol::Transaction& _tx)
     {
@@ -94,5 +97,7 @@ private:
     std::string m_groupId;
     std::string m_chainId;
     std::weak_ptr<bcos::scheduler::SchedulerInterface> m_scheduler;
+    // shared with the transaction sync, recover the sender of every tx once
+    SenderCache::Ptr m_senderCache;
 };
 }  // namespace bcos::txpool
\ No newline at end of file
@@ -131,6 +131,11 @@ task::Task<std::optional<u256>> Web3NonceChecker::getPendingNonce(std::string_vi
     co_return std::nullopt;
 }
 
+task::Task<std::optional<u256>> Web3NonceChecker::getLedgerNonce(std::string_view sender)
+{
+    co_return co_await storage2::readOne(m_ledgerStateNonces, sender);
+}
+
 // only for test, inset nonce into ledgerStateNonces
 void Web3NonceChecker::insert(std::string sender, u256 nonce)
 {
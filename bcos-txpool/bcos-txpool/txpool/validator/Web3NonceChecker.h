@@ -176,6 +176,13 @@ public:
 
     virtual task::Task<std::optional<u256>> getPendingNonce(std::string_view sender);
 
+    /**
+     * get the cached ledger nonce of the sender, which is the next nonce expected on chain
+     * @param sender eoa address, bytes string
+     * @return std::nullopt if the nonce of the sender has not been cached
+     */
+    virtual task::Task<std::optional<u256>> getLedgerNonce(std::string_view sender);
+
     // only for test, inset nonce into ledgerStateNonces
     virtual void insert(std::string sender, u256 nonce);
 
@@ -0,0 +1,75 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief unit test for the sender recovery cache
+ * @file SenderCacheTest.cpp
+ * @date 2026-10-19
+ */
+#include "bcos-txpool/txpool/validator/SenderCache.h"
+#include "bcos-framework/bcos-framework/testutils/faker/FakeTransaction.h"
+#include <bcos-crypto/hash/Keccak256.h>
+#include <bcos-crypto/signature/secp256k1/Secp256k1Crypto.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::txpool;
+using namespace bcos::protocol;
+using namespace bcos::crypto;
+
+namespace bcos::test
+{
+BOOST_AUTO_TEST_SUITE(SenderCacheTest)
+
+BOOST_AUTO_TEST_CASE(recoverOnce)
+{
+    auto cryptoSuite = std::make_shared<CryptoSuite>(
+        std::make_shared<Keccak256>(), std::make_shared<Secp256k1Crypto>(), nullptr);
+    SenderCache cache(cryptoSuite);
+
+    auto keyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+    auto tx = fakeTransaction(
+        cryptoSuite, keyPair, "", asBytes("senderCache"), "100", 1000, "chainId", "groupId");
+    std::string sender(tx->sender());
+
+    tx->forceSender({});
+    cache.verify(*tx);
+    BOOST_CHECK_EQUAL(tx->sender(), sender);
+    BOOST_CHECK_EQUAL(cache.misses(), 1U);
+
+    // the sender is cleared again by the next module, it is served from the cache
+    tx->forceSender({});
+    cache.verify(*tx);
+    BOOST_CHECK_EQUAL(tx->sender(), sender);
+    BOOST_CHECK_EQUAL(cache.hits(), 1U);
+
+    // the tx has already been verified
+    cache.verify(*tx);
+    BOOST_CHECK_EQUAL(cache.hits(), 1U);
+
+    // same hash signed by another key, the cached sender must not be used
+    auto otherKeyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+    auto otherTx = fakeTransaction(
+        cryptoSuite, otherKeyPair, "", asBytes("senderCache"), "100", 1000, "chainId", "groupId");
+    BOOST_REQUIRE(otherTx->hash() == tx->hash());
+    std::string otherSender(otherTx->sender());
+    otherTx->forceSender({});
+    cache.verify(*otherTx);
+    BOOST_CHECK_EQUAL(otherTx->sender(), otherSender);
+    BOOST_CHECK(otherSender != sender);
+    BOOST_CHECK_EQUAL(cache.misses(), 2U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -0,0 +1,210 @@
+/**
+ *  Copyright (C) 2026 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ */
+#include "bcos-txpool/txpool/storage/TxPriorityQueue.h"
+#include "bcos-crypto/hash/Keccak256.h"
+#include "bcos-tars-protocol/protocol/TransactionImpl.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::txpool;
+using namespace bcos::protocol;
+using namespace bcos::crypto;
+
+namespace bcos::test
+{
+static Transaction::Ptr makeQueueTx(std::string nonce, int64_t importTime,
+    std::string_view sender = {}, std::string gasPrice = {})
+{
+    auto tx = std::make_shared<bcostars::protocol::TransactionImpl>();
+    tx->setNonce(std::move(nonce));
+    tx->setImportTime(importTime);
+    tx->mutableInner().data.gasPrice = std::move(gasPrice);
+    if (!sender.empty())
+    {
+        tx->mutableInner().type = static_cast<uint8_t>(TransactionType::Web3Transaction);
+        tx->mutableInner().sender.assign(sender.begin(), sender.end());
+    }
+    HashType extraHash = HashType::generateRandomFixedBytes();
+    tx->mutableInner().extraTransactionHash.assign(extraHash.begin(), extraHash.end());
+    Keccak256 keccak;
+    tx->calculateHash(keccak);
+    return tx;
+}
+
+static std::vector<Transaction::Ptr> sealAll(
+    TxPriorityQueue& queue, size_t limit, TxSealResult result = TxSealResult::Sealed)
+{
+    std::vector<Transaction::Ptr> sealed;
+    queue.seal(limit, [&](const Transaction::Ptr& tx) {
+        sealed.emplace_back(tx);
+        return result;
+    });
+    return sealed;
+}
+
+BOOST_AUTO_TEST_SUITE(TxPriorityQueueTest)
+
+BOOST_AUTO_TEST_CASE(sealByImportTime)
+{
+    TxPriorityQueue queue;
+    auto tx1 = makeQueueTx("n1", 3);
+    auto tx2 = makeQueueTx("n2", 1);
+    auto tx3 = makeQueueTx("n3", 2);
+    queue.push(tx1);
+    queue.push(tx2);
+    queue.push(tx3);
+    // duplicated push is ignored
+    queue.push(tx2);
+    BOOST_CHECK_EQUAL(queue.size(), 3);
+
+    auto sealed = sealAll(queue, 2);
+    BOOST_CHECK_EQUAL(sealed.size(), 2);
+    BOOST_CHECK(sealed[0] == tx2);
+    BOOST_CHECK(sealed[1] == tx3);
+    BOOST_CHECK_EQUAL(queue.size(), 1);
+
+    // erased txs are never popped
+    queue.erase(*tx1);
+    BOOST_CHECK(sealAll(queue, 10).empty());
+    BOOST_CHECK_EQUAL(queue.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(sealByGasPrice)
+{
+    TxPriorityQueue queue;
+    queue.setPolicy(TxPriorityPolicy::GasPrice);
+    auto cheap = makeQueueTx("n1", 1, {}, "10");
+    auto expensive = makeQueueTx("n2", 2, {}, "0x100");
+    auto noPrice = makeQueueTx("n3", 0);
+    queue.push(cheap);
+    queue.push(expensive);
+    queue.push(noPrice);
+
+    auto sealed = sealAll(queue, 10);
+    BOOST_REQUIRE_EQUAL(sealed.size(), 3);
+    BOOST_CHECK(sealed[0] == expensive);
+    BOOST_CHECK(sealed[1] == cheap);
+    BOOST_CHECK(sealed[2] == noPrice);
+}
+
+BOOST_AUTO_TEST_CASE(web3NonceGap)
+{
+    TxPriorityQueue queue;
+    std::string sender(20, 'a');
+    queue.setNonceResolver([&](std::string_view _sender) -> std::optional<u256> {
+        BOOST_CHECK(_sender == sender);
+        return u256(1);
+    });
+    auto tx2 = makeQueueTx("0x2", 1, sender);
+    auto tx1 = makeQueueTx("0x1", 2, sender);
+    auto tx4 = makeQueueTx("0x4", 0, sender);
+    auto stale = makeQueueTx("0x0", 0, sender);
+    queue.push(tx2);
+    queue.push(tx1);
+    queue.push(tx4);
+
+    // nonce 4 is gapped and must wait for nonce 3
+    auto sealed = sealAll(queue, 10);
+    BOOST_REQUIRE_EQUAL(sealed.size(), 2);
+    BOOST_CHECK(sealed[0] == tx1);
+    BOOST_CHECK(sealed[1] == tx2);
+    BOOST_CHECK_EQUAL(queue.size(), 1);
+
+    auto tx3 = makeQueueTx("0x3", 3, sender);
+    queue.push(tx3);
+    sealed = sealAll(queue, 10);
+    BOOST_REQUIRE_EQUAL(sealed.size(), 2);
+    BOOST_CHECK(sealed[0] == tx3);
+    BOOST_CHECK(sealed[1] == tx4);
+
+    // the committed nonce drops the sender queue
+    queue.updateNonce(sender, 5);
+    BOOST_CHECK_EQUAL(queue.sendersSize(), 0);
+    queue.push(stale);
+    queue.updateNonce(sender, 5);
+    BOOST_CHECK_EQUAL(queue.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(web3Unseal)
+{
+    TxPriorityQueue queue;
+    std::string sender(20, 'b');
+    auto tx5 = makeQueueTx("5", 1, sender);
+    auto tx6 = makeQueueTx("6", 2, sender);
+    queue.push(tx5);
+    queue.push(tx6);
+
+    // the ledger nonce is unknown, start from the lowest pending nonce
+    auto sealed = sealAll(queue, 1);
+    BOOST_REQUIRE_EQUAL(sealed.size(), 1);
+    BOOST_CHECK(sealed[0] == tx5);
+
+    // the proposal is discarded and nonce 5 is unsealed, it must be resealed before nonce 6
+    queue.push(tx5);
+    sealed = sealAll(queue, 10);
+    BOOST_REQUIRE_EQUAL(sealed.size(), 2);
+    BOOST_CHECK(sealed[0] == tx5);
+    BOOST_CHECK(sealed[1] == tx6);
+}
+
+BOOST_AUTO_TEST_CASE(web3InvalidBlocksSender)
+{
+    TxPriorityQueue queue;
+    std::string sender(20, 'c');
+    auto tx1 = makeQueueTx("1", 1, sender);
+    auto tx2 = makeQueueTx("2", 2, sender);
+    queue.push(tx1);
+    queue.push(tx2);
+
+    // nonce 1 is invalid, nonce 2 can not be sealed until nonce 1 is resubmitted
+    auto sealed = sealAll(queue, 1, TxSealResult::Invalid);
+    BOOST_REQUIRE_EQUAL(sealed.size(), 1);
+    BOOST_CHECK(sealAll(queue, 10).empty());
+    BOOST_CHECK_EQUAL(queue.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(sealWithoutLock)
+{
+    TxPriorityQueue queue;
+    std::string sender(20, 'd');
+    size_t resolved = 0;
+    // the resolver and the handler may block on the ledger, they run without the queue lock
+    queue.setNonceResolver([&](std::string_view) -> std::optional<u256> {
+        ++resolved;
+        BOOST_CHECK_EQUAL(queue.sendersSize(), 1);
+        return u256(2);
+    });
+    auto tx1 = makeQueueTx("1", 1, sender);
+    auto tx2 = makeQueueTx("2", 2, sender);
+    auto tx3 = makeQueueTx("3", 3, sender);
+    auto bcosTx = makeQueueTx("n", 4);
+    queue.push(tx1);
+    queue.push(tx2);
+    queue.push(tx3);
+    queue.push(bcosTx);
+
+    std::vector<Transaction::Ptr> sealed;
+    auto count = queue.seal(10, [&](const Transaction::Ptr& tx) {
+        sealed.emplace_back(tx);
+        // a tx submitted while sealing is indexed and sealed in a later round
+        if (tx == tx2)
+        {
+            queue.push(makeQueueTx("4", 5, sender));
+        }
+        return TxSealResult::Sealed;
+    });
+    BOOST_CHECK_EQUAL(resolved, 1);
+    // nonce 1 is below the ledger nonce, it is dropped and never sealed
+    BOOST_CHECK_EQUAL(count, 4);
+    BOOST_REQUIRE_EQUAL(sealed.size(), 4);
+    BOOST_CHECK(sealed[0] == bcosTx);
+    BOOST_CHECK(sealed[1] == tx2);
+    BOOST_CHECK(sealed[2] == tx3);
+    BOOST_CHECK_EQUAL(sealed[3]->nonce(), "4");
+    BOOST_CHECK_EQUAL(queue.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
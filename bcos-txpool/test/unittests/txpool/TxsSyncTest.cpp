@@ -277,6 +277,121 @@ BOOST_AUTO_TEST_CASE(testOnPeerTxsStatus)
     testTransactionSync(true);
 }
 
+void waitForTxpoolSize(const TxPoolFixture::Ptr& _faker, size_t _size)
+{
+    auto startT = utcTime();
+    while (_faker->txpool()->txpoolStorage()->size() < _size && (utcTime() - startT <= 10000))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testPrefilledTxs)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    auto signatureImpl = std::make_shared<Secp256k1Crypto>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+    std::string groupId = "test-group";
+    std::string chainId = "test-chain";
+    int64_t blockLimit = 15;
+    auto fakeGateWay = std::make_shared<FakeGateWay>();
+    auto createFaker = [&]() {
+        return std::make_shared<TxPoolFixture>(signatureImpl->generateKeyPair()->publicKey(),
+            cryptoSuite, groupId, chainId, blockLimit, fakeGateWay, false, false);
+    };
+    auto leader = createFaker();
+    auto follower = createFaker();
+    // connected, but not in the group
+    auto outsider = createFaker();
+    leader->appendSealer(leader->nodeID());
+    leader->appendSealer(follower->nodeID());
+
+    size_t nonce = 0;
+    auto createTxs = [&](size_t _txsNum) {
+        bcos::protocol::ConstTransactions transactions;
+        for (size_t i = 0; i < _txsNum; i++)
+        {
+            transactions.emplace_back(fakeTransaction(cryptoSuite,
+                std::to_string(utcTime() + 20000 + (nonce++)), leader->ledger()->blockNumber() + 1,
+                chainId, groupId));
+        }
+        return transactions;
+    };
+    auto submitTxs = [](const TxPoolFixture::Ptr& _faker,
+                         bcos::protocol::ConstTransactions const& _txs) {
+        for (auto const& tx : _txs)
+        {
+            task::wait(_faker->txpool()->submitTransaction(
+                std::const_pointer_cast<bcos::protocol::Transaction>(tx), true));
+        }
+        waitForTxpoolSize(_faker, _txs.size());
+    };
+    auto hashes = [](bcos::protocol::ConstTransactions const& _txs) {
+        HashList txsHash;
+        for (auto const& tx : _txs)
+        {
+            txsHash.emplace_back(tx->hash());
+        }
+        return txsHash;
+    };
+    auto requestsToLeader = [&]() {
+        return follower->frontService()->getAsyncSendSizeByNodeID(leader->nodeID());
+    };
+    auto waitForRequests = [&](size_t _requests) {
+        auto startT = utcTime();
+        while (requestsToLeader() < _requests && (utcTime() - startT <= 10000))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    };
+
+    // the hashes pushed by the nodes outside the group are ignored
+    auto outsiderTxs = createTxs(3);
+    submitTxs(outsider, outsiderTxs);
+    outsider->sync()->pushPrefilledTxs(hashes(outsiderTxs));
+
+    // the missing txs of the hashes pushed by the consensus nodes are fetched, the follower
+    // handles the packets in order, so the outsider packet has been dropped once these arrive
+    auto leaderTxs = createTxs(3);
+    submitTxs(leader, leaderTxs);
+    leader->sync()->pushPrefilledTxs(hashes(leaderTxs));
+    waitForRequests(1);
+    waitForTxpoolSize(follower, leaderTxs.size());
+    BOOST_CHECK_EQUAL(requestsToLeader(), 1U);
+    BOOST_CHECK_EQUAL(follower->txpool()->txpoolStorage()->size(), leaderTxs.size());
+    for (auto const& tx : outsiderTxs)
+    {
+        BOOST_CHECK(!follower->txpool()->txpoolStorage()->exists(tx->hash()));
+    }
+
+    // the fresh txs submitted by the local clients are pushed when sealed, only the txs the
+    // follower misses are requested
+    leader->txpool()->txpoolConfig()->setProposalPrefillWindow(10000);
+    auto freshTxs = createTxs(5);
+    for (auto const& tx : freshTxs)
+    {
+        task::wait(leader->txpool()->submitTransaction(
+            std::const_pointer_cast<bcos::protocol::Transaction>(tx), true));
+    }
+    waitForTxpoolSize(leader, leaderTxs.size() + freshTxs.size());
+    auto [sealedTxs, _] = leader->txpool()->sealTxs(100);
+    BOOST_CHECK_EQUAL(sealedTxs.size(), leaderTxs.size() + freshTxs.size());
+    waitForRequests(2);
+    waitForTxpoolSize(follower, leaderTxs.size() + freshTxs.size());
+    BOOST_CHECK_EQUAL(requestsToLeader(), 2U);
+    BOOST_CHECK_EQUAL(
+        follower->txpool()->txpoolStorage()->size(), leaderTxs.size() + freshTxs.size());
+
+    // nothing is requested when the follower has all the pushed txs
+    leader->sync()->pushPrefilledTxs(hashes(freshTxs));
+    auto lastTxs = createTxs(1);
+    submitTxs(leader, lastTxs);
+    leader->sync()->pushPrefilledTxs(hashes(lastTxs));
+    waitForRequests(3);
+    waitForTxpoolSize(follower, leaderTxs.size() + freshTxs.size() + lastTxs.size());
+    BOOST_CHECK_EQUAL(requestsToLeader(), 3U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
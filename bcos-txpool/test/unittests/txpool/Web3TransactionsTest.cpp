@@ -442,6 +442,95 @@ BOOST_AUTO_TEST_CASE(remove_by_hashes_respects_per_sender_max)
     BOOST_CHECK(aHas4 && aHas5 && bHas2);
 }
 
+BOOST_AUTO_TEST_CASE(pending_nonce_follows_commit)
+{
+    Web3Transactions pool;
+    constexpr int kSenderBytes = 20;
+    std::string sender("KKKKKKKKKKKKKKKKKKKK", kSenderBytes);
+
+    // 0..2 and 4, gap at 3
+    std::vector<protocol::Transaction::Ptr> txs{
+        makeTx(sender, 0), makeTx(sender, 1), makeTx(sender, 2), makeTx(sender, 4)};
+    pool.add(txs);
+    // no commit notification yet
+    BOOST_CHECK(!pool.pendingNonce(sender).has_value());
+
+    // commit 0 and 1, the frontier continues over 2 and stops at the gap
+    std::vector<crypto::HashType> committed{txs[0]->hash(), txs[1]->hash()};
+    pool.remove(crypto::HashListView{committed});
+    BOOST_CHECK_EQUAL(pool.pendingNonce(sender).value_or(-1), 3);
+
+    // filling the gap extends the frontier over 4
+    constexpr int64_t kNonce3 = 3;
+    pool.add(std::vector{makeTx(sender, kNonce3)});
+    BOOST_CHECK_EQUAL(pool.pendingNonce(sender).value_or(-1), 5);
+
+    // all txs committed, the sender leaves the pool
+    std::vector<crypto::HashType> rest{txs[3]->hash()};
+    pool.remove(crypto::HashListView{rest});
+    BOOST_CHECK(!pool.pendingNonce(sender).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(seal_skips_idle_senders)
+{
+    Web3Transactions pool;
+    constexpr int kSenderBytes = 20;
+    constexpr int kSealLimit = 100;
+    std::string sender("QQQQQQQQQQQQQQQQQQQQ", kSenderBytes);
+
+    auto tx0 = makeTx(sender, 0);
+    pool.add(std::vector{tx0, makeTx(sender, 2)});
+    std::vector<crypto::HashType> committed{tx0->hash()};
+    pool.remove(crypto::HashListView{committed});
+
+    // nonce 1 is missing, the account is read once and the sender is idle
+    MapStateStorage state{};
+    setNonce(state, sender, "1");
+    std::vector<protocol::Transaction::Ptr> out;
+    task::syncWait(pool.seal(kSealLimit, state, std::back_inserter(out)));
+    BOOST_CHECK(out.empty());
+    BOOST_CHECK_EQUAL(pool.pendingNonce(sender).value_or(-1), 1);
+
+    // the idle sender is skipped until the next commit notification
+    setNonce(state, sender, "2");
+    task::syncWait(pool.seal(kSealLimit, state, std::back_inserter(out)));
+    BOOST_CHECK(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(seal_after_nonce_committed_by_other_node)
+{
+    Web3Transactions pool;
+    constexpr int kSenderBytes = 20;
+    constexpr int kSealLimit = 100;
+    std::string sender("RRRRRRRRRRRRRRRRRRRR", kSenderBytes);
+    std::string otherSender("SSSSSSSSSSSSSSSSSSSS", kSenderBytes);
+
+    auto tx0 = makeTx(sender, 0);
+    auto tx2 = makeTx(sender, 2);
+    auto otherTx = makeTx(otherSender, 0);
+    pool.add(std::vector{tx0, tx2, otherTx});
+    std::vector<crypto::HashType> committed{tx0->hash()};
+    pool.remove(crypto::HashListView{committed});
+
+    MapStateStorage state{};
+    setNonce(state, sender, "1");
+    std::vector<protocol::Transaction::Ptr> out;
+    task::syncWait(pool.seal(1, state, std::back_inserter(out)));
+    BOOST_REQUIRE_EQUAL(out.size(), 1);
+    BOOST_CHECK(out[0] == otherTx);
+
+    // nonce 1, never held by this pool, is sealed by another node and committed with otherTx
+    setNonce(state, sender, "2");
+    std::vector<crypto::HashType> nextBlock{otherTx->hash()};
+    pool.remove(crypto::HashListView{nextBlock});
+
+    out.clear();
+    task::syncWait(pool.seal(kSealLimit, state, std::back_inserter(out)));
+    BOOST_REQUIRE_EQUAL(out.size(), 1);
+    BOOST_CHECK(out[0] == tx2);
+    BOOST_CHECK_EQUAL(readNonce(state, sender).value_or(""), "3");
+}
+
 BOOST_AUTO_TEST_CASE(get_returns_in_order_with_null_for_missing)
 {
     Web3Transactions pool;
@@ -21,9 +21,73 @@
  */
 #include "ZstdCompress.h"
 #include "BoostLog.h"
+#include "Exceptions.h"
+#include "zdict.h"
 
 namespace bcos
 {
+namespace
+{
+// creating a zstd context allocates several hundred KB, reuse one context per thread
+struct ZstdContexts
+{
+    ZstdContexts() : cctx(ZSTD_createCCtx()), dctx(ZSTD_createDCtx()) {}
+    ~ZstdContexts()
+    {
+        ZSTD_freeCCtx(cctx);
+        ZSTD_freeDCtx(dctx);
+    }
+    ZstdContexts(const ZstdContexts&) = delete;
+    ZstdContexts(ZstdContexts&&) = delete;
+    ZstdContexts& operator=(const ZstdContexts&) = delete;
+    ZstdContexts& operator=(ZstdContexts&&) = delete;
+
+    ZSTD_CCtx* cctx;
+    ZSTD_DCtx* dctx;
+};
+
+ZstdContexts& zstdContexts()
+{
+    thread_local ZstdContexts contexts;
+    return contexts;
+}
+
+size_t uncompressedSize(bytesConstRef compressedData)
+{
+    size_t const cBuffSize = ZSTD_getFrameContentSize(compressedData.data(), compressedData.size());
+    if (0 == cBuffSize || ZSTD_CONTENTSIZE_UNKNOWN == cBuffSize ||
+        ZSTD_CONTENTSIZE_ERROR == cBuffSize)
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdUncompress")
+                        << LOG_DESC("compress failed, compressedData size error")
+                        << LOG_KV("compressedData size", cBuffSize);
+        return 0;
+    }
+    return cBuffSize;
+}
+}  // namespace
+
+ZstdDictionary::ZstdDictionary(bytes content, int compressionLevel)
+  : m_content(std::move(content)),
+    m_id(ZSTD_getDictID_fromDict(m_content.data(), m_content.size())),
+    m_cdict(ZSTD_createCDict(m_content.data(), m_content.size(), compressionLevel)),
+    m_ddict(ZSTD_createDDict(m_content.data(), m_content.size()))
+{
+    // the raw content dictionaries have no ID and can not be looked up by the receiver
+    if (m_id == 0 || m_cdict == nullptr || m_ddict == nullptr)
+    {
+        ZSTD_freeCDict(m_cdict);
+        ZSTD_freeDDict(m_ddict);
+        BOOST_THROW_EXCEPTION(InvalidParameter() << errinfo_comment("invalid zstd dictionary"));
+    }
+}
+
+ZstdDictionary::~ZstdDictionary()
+{
+    ZSTD_freeCDict(m_cdict);
+    ZSTD_freeDDict(m_ddict);
+}
+
 bool ZstdCompress::compress(bytesConstRef inputData, bytes& compressedData, int compressionLevel)
 {
     // auto start_t = utcTimeUs();
@@ -31,8 +95,8 @@ bool ZstdCompress::compress(bytesConstRef inputData, bytes& compressedData, int
     compressedData.resize(cBuffSize);
     auto compressedDataPtr = const_cast<void*>(static_cast<const void*>(&compressedData[0]));
     auto inputDataPtr = static_cast<const void*>(inputData.data());
-    size_t const compressedSize = ZSTD_compress(
-        compressedDataPtr, cBuffSize, inputDataPtr, inputData.size(), compressionLevel);
+    size_t const compressedSize = ZSTD_compressCCtx(zstdContexts().cctx, compressedDataPtr,
+        cBuffSize, inputDataPtr, inputData.size(), compressionLevel);
     auto code = ZSTD_isError(compressedSize);
     if (code)
     {
@@ -56,21 +120,17 @@ bool ZstdCompress::compress(bytesConstRef inputData, bytes& compressedData, int
 bool ZstdCompress::uncompress(bytesConstRef compressedData, bytes& uncompressedData)
 {
     // auto start_t = utcTimeUs();
-    size_t const cBuffSize = ZSTD_getFrameContentSize(compressedData.data(), compressedData.size());
-    if (0 == cBuffSize || ZSTD_CONTENTSIZE_UNKNOWN == cBuffSize ||
-        ZSTD_CONTENTSIZE_ERROR == cBuffSize)
+    size_t const cBuffSize = uncompressedSize(compressedData);
+    if (cBuffSize == 0)
     {
-        BCOS_LOG(ERROR) << LOG_BADGE("ZstdUncompress")
-                        << LOG_DESC("compress failed, compressedData size error")
-                        << LOG_KV("compressedData size", cBuffSize);
         return false;
     }
 
     uncompressedData.resize(cBuffSize);
     auto uncompressedDataPtr = const_cast<void*>(static_cast<const void*>(&uncompressedData[0]));
     auto compressedDataPtr = static_cast<const void*>(compressedData.data());
-    size_t const uncompressSize =
-        ZSTD_decompress(uncompressedDataPtr, cBuffSize, compressedDataPtr, compressedData.size());
+    size_t const uncompressSize = ZSTD_decompressDCtx(zstdContexts().dctx, uncompressedDataPtr,
+        cBuffSize, compressedDataPtr, compressedData.size());
     auto code = ZSTD_isError(uncompressSize);
     if (code)
     {
@@ -91,4 +151,77 @@ bool ZstdCompress::uncompress(bytesConstRef compressedData, bytes& uncompressedD
 
     return true;
 }
+
+bool ZstdCompress::compress(
+    bytesConstRef inputData, bytes& compressedData, const ZstdDictionary& dictionary)
+{
+    size_t const cBuffSize = ZSTD_compressBound(inputData.size());
+    compressedData.resize(cBuffSize);
+    size_t const compressedSize = ZSTD_compress_usingCDict(zstdContexts().cctx,
+        compressedData.data(), cBuffSize, inputData.data(), inputData.size(), dictionary.cdict());
+    if (ZSTD_isError(compressedSize))
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdCompress") << LOG_DESC("compress with dictionary failed")
+                        << LOG_KV("dictionary", dictionary.id())
+                        << LOG_KV("error", ZSTD_getErrorName(compressedSize));
+        return false;
+    }
+    compressedData.resize(compressedSize);
+    return true;
+}
+
+bool ZstdCompress::uncompress(
+    bytesConstRef compressedData, bytes& uncompressedData, const ZstdDictionary& dictionary)
+{
+    size_t const cBuffSize = uncompressedSize(compressedData);
+    if (cBuffSize == 0)
+    {
+        return false;
+    }
+    uncompressedData.resize(cBuffSize);
+    size_t const uncompressSize = ZSTD_decompress_usingDDict(zstdContexts().dctx,
+        uncompressedData.data(), cBuffSize, compressedData.data(), compressedData.size(),
+        dictionary.ddict());
+    if (ZSTD_isError(uncompressSize))
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdUncompress")
+                        << LOG_DESC("uncompress with dictionary failed")
+                        << LOG_KV("dictionary", dictionary.id())
+                        << LOG_KV("error", ZSTD_getErrorName(uncompressSize));
+        return false;
+    }
+    uncompressedData.resize(uncompressSize);
+    return true;
+}
+
+uint32_t ZstdCompress::dictionaryID(bytesConstRef compressedData)
+{
+    return ZSTD_getDictID_fromFrame(compressedData.data(), compressedData.size());
+}
+
+bool ZstdCompress::trainDictionary(
+    const std::vector<bytes>& _samples, size_t _capacity, bytes& _dictionary)
+{
+    bytes samplesBuffer;
+    std::vector<size_t> samplesSizes;
+    samplesSizes.reserve(_samples.size());
+    for (auto const& sample : _samples)
+    {
+        samplesBuffer.insert(samplesBuffer.end(), sample.begin(), sample.end());
+        samplesSizes.emplace_back(sample.size());
+    }
+    _dictionary.resize(_capacity);
+    auto dictionarySize = ZDICT_trainFromBuffer(_dictionary.data(), _capacity,
+        samplesBuffer.data(), samplesSizes.data(), static_cast<unsigned>(samplesSizes.size()));
+    if (ZDICT_isError(dictionarySize))
+    {
+        BCOS_LOG(INFO) << LOG_BADGE("ZstdCompress") << LOG_DESC("train dictionary failed")
+                       << LOG_KV("samples", _samples.size())
+                       << LOG_KV("samplesBytes", samplesBuffer.size())
+                       << LOG_KV("error", ZDICT_getErrorName(dictionarySize));
+        return false;
+    }
+    _dictionary.resize(dictionarySize);
+    return true;
+}
 }  // namespace bcos
@@ -22,15 +22,59 @@
 #pragma once
 #include "Common.h"
 #include "zstd.h"
+#include <memory>
+#include <vector>
 
 namespace bcos
 {
+/**
+ * a trained zstd dictionary, the digested compression and decompression dictionaries are built
+ * once and shared by all the threads
+ */
+class ZstdDictionary
+{
+public:
+    using Ptr = std::shared_ptr<const ZstdDictionary>;
+
+    ZstdDictionary(bytes content, int compressionLevel);
+    ~ZstdDictionary();
+    ZstdDictionary(const ZstdDictionary&) = delete;
+    ZstdDictionary(ZstdDictionary&&) = delete;
+    ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+    ZstdDictionary& operator=(ZstdDictionary&&) = delete;
+
+    // the dictionary ID written into every frame compressed with the dictionary
+    uint32_t id() const { return m_id; }
+    const bytes& content() const { return m_content; }
+
+    const ZSTD_CDict* cdict() const { return m_cdict; }
+    const ZSTD_DDict* ddict() const { return m_ddict; }
+
+private:
+    bytes m_content;
+    uint32_t m_id = 0;
+    ZSTD_CDict* m_cdict = nullptr;
+    ZSTD_DDict* m_ddict = nullptr;
+};
 
 class ZstdCompress
 {
 public:
     static bool compress(bytesConstRef inputData, bytes& compressedData, int compressionLevel);
     static bool uncompress(bytesConstRef compressedData, bytes& uncompressedData);
+
+    // compress with the dictionary, the compression level is the one the dictionary is built with
+    static bool compress(
+        bytesConstRef inputData, bytes& compressedData, const ZstdDictionary& dictionary);
+    static bool uncompress(
+        bytesConstRef compressedData, bytes& uncompressedData, const ZstdDictionary& dictionary);
+    // the dictionary ID of the compressed frame, 0 if the frame is compressed without dictionary
+    static uint32_t dictionaryID(bytesConstRef compressedData);
+
+    // train a dictionary of at most _capacity bytes from the samples, return false if the samples
+    // are too few or too random to train a dictionary
+    static bool trainDictionary(
+        const std::vector<bytes>& _samples, size_t _capacity, bytes& _dictionary);
 };
 
 }  // namespace bcos
@@ -17,6 +17,7 @@
  * @file ZstdCompressTest.cpp
  */
 #include "bcos-utilities/ZstdCompress.h"
+#include "bcos-utilities/Exceptions.h"
 #include "bcos-utilities/testutils/TestPromptFixture.h"
 #include <boost/test/unit_test.hpp>
 #include <iostream>
@@ -48,6 +49,42 @@ BOOST_AUTO_TEST_CASE(testZstdCompress)
     BOOST_CHECK(!retUncompressFail);
 }
 
+BOOST_AUTO_TEST_CASE(testZstdDictionaryCompress)
+{
+    // small and repetitive messages with a few varying fields
+    std::vector<bytes> samples;
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        auto sample = "{\"groupID\":\"group0\",\"chainID\":\"chain0\",\"nonce\":\"" +
+                      std::to_string(i * 7919) + "\",\"blockLimit\":" + std::to_string(i) +
+                      ",\"to\":\"0x0000000000000000000000000000000000001000\"}";
+        samples.emplace_back(sample.begin(), sample.end());
+    }
+    bytes content;
+    BOOST_REQUIRE(ZstdCompress::trainDictionary(samples, 4096, content));
+    BOOST_CHECK_LE(content.size(), 4096U);
+    ZstdDictionary dictionary(content, 1);
+    BOOST_CHECK_NE(dictionary.id(), 0U);
+
+    auto const& payload = samples[1234];
+    bytes compressData;
+    BOOST_REQUIRE(ZstdCompress::compress(ref(payload), compressData, dictionary));
+    BOOST_CHECK_EQUAL(ZstdCompress::dictionaryID(ref(compressData)), dictionary.id());
+    bytes plainCompressData;
+    BOOST_REQUIRE(ZstdCompress::compress(ref(payload), plainCompressData, 1));
+    BOOST_CHECK_EQUAL(ZstdCompress::dictionaryID(ref(plainCompressData)), 0U);
+    BOOST_CHECK_LT(compressData.size(), plainCompressData.size());
+
+    bytes uncompressData;
+    BOOST_REQUIRE(ZstdCompress::uncompress(ref(compressData), uncompressData, dictionary));
+    BOOST_CHECK(uncompressData == payload);
+    // the frame can not be decompressed without the dictionary
+    BOOST_CHECK(!ZstdCompress::uncompress(ref(compressData), uncompressData));
+
+    // raw content without dictionary header is rejected
+    BOOST_CHECK_THROW(ZstdDictionary(bytes(1024, 'a'), 1), InvalidParameter);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
@@ -148,6 +148,8 @@ void ExecutorServiceApp::createAndInitExecutor()
         std::make_shared<bcostars::protocol::ExecutionMessageFactoryImpl>();
     auto stateStorageFactory =
         std::make_shared<bcos::storage::StateStorageFactory>(m_nodeConfig->keyPageSize());
+    stateStorageFactory->setKeyPageFormat(
+        static_cast<bcos::storage::KeyPageFormat>(m_nodeConfig->keyPageFormat()));
 
     auto blockFactory = m_protocolInitializer->blockFactory();
     auto ledger = std::make_shared<bcos::ledger::Ledger>(
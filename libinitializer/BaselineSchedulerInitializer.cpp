@@ -54,7 +54,8 @@ bcos::scheduler_v1::BaselineSchedulerInitializer::build(::rocksdb::DB& rocksDB,
                 decltype(data->m_transactionExecutor), decltype(*scheduler),
                 ledger::LedgerInterface>>(data->m_multiLayerStorage, *scheduler,
                 data->m_transactionExecutor, *blockFactory, *ledger, *txpool,
-                *transactionSubmitResultFactory, *blockFactory->cryptoSuite()->hashImpl());
+                *transactionSubmitResultFactory, *blockFactory->cryptoSuite()->hashImpl(),
+                config.callConcurrency);
         baselineScheduler->registerTransactionNotifier(
             [txpool](bcos::protocol::BlockNumber blockNumber,
                 bcos::protocol::TransactionSubmitResultsPtr result,
@@ -76,7 +77,8 @@ bcos::scheduler_v1::BaselineSchedulerInitializer::build(::rocksdb::DB& rocksDB,
 
     INITIALIZER_LOG(INFO) << "Initialize baseline scheduler, parallel: " << config.parallel
                           << ", grainSize: " << config.grainSize
-                          << ", maxThread: " << config.maxThread;
+                          << ", maxThread: " << config.maxThread
+                          << ", callConcurrency: " << config.callConcurrency;
 
     if (config.parallel)
     {
@@ -206,6 +206,8 @@ void FrontServiceInitializer::initMsgHandlers(bcos::consensus::ConsensusInterfac
                                   << LOG_KV("messageID", messageID);
             }
             transaction->forceSender({});  // must clear sender here for future verify
+            // received from the peers, never prefilled into the proposals of this node
+            transaction->setSynced(true);
             task::wait(
                 [](decltype(txpool) txpool, decltype(transaction) transaction) -> task::Task<void> {
                     try
@@ -244,6 +246,7 @@ void FrontServiceInitializer::initMsgHandlers(bcos::consensus::ConsensusInterfac
                 }
                 return;
             }
+            transaction->setSynced(true);
             task::wait([](decltype(txpool) txpool, decltype(transaction) transaction,
                            decltype(data) data, decltype(nodeID) nodeID) -> task::Task<void> {
                 try
@@ -233,6 +233,13 @@ void Initializer::init(bcos::protocol::NodeArchitectureType _nodeArchType,
     auto ledger = LedgerInitializer::build(
         m_protocolInitializer->blockFactory(), m_storage, m_nodeConfig, m_blockStorage);
     ledger->setKeyPageSize(m_nodeConfig->keyPageSize());
+    if (!m_nodeConfig->coldStoragePath().empty())
+    {
+        ledger->setColdBlockStore(
+            std::make_shared<ledger::ColdBlockStore>(
+                m_nodeConfig->coldStoragePath(), m_nodeConfig->coldSegmentBlocks()),
+            m_nodeConfig->coldBlockThreshold());
+    }
     m_ledger = ledger;
 
     bcos::protocol::ExecutionMessageFactory::Ptr executionMessageFactory = nullptr;
@@ -273,6 +280,7 @@ void Initializer::init(bcos::protocol::NodeArchitectureType _nodeArchType,
         m_txpoolInitializer->txpool(), m_protocolInitializer->txResultFactory(),
         m_protocolInitializer->cryptoSuite()->hashImpl(), m_nodeConfig->isAuthCheck(),
         m_nodeConfig->isWasm(), m_nodeConfig->isSerialExecute(), m_nodeConfig->keyPageSize());
+    factory->setKeyPageFormat(static_cast<storage::KeyPageFormat>(m_nodeConfig->keyPageFormat()));
 
     int64_t schedulerSeq = 0;  // In Max node, this seq will be update after consensus module
                                // switch to a leader during startup
@@ -347,6 +355,8 @@ void Initializer::init(bcos::protocol::NodeArchitectureType _nodeArchType,
         // Note: ensure that there has at least one executor before pbft/sync execute block
         auto storageFactory =
             std::make_shared<storage::StateStorageFactory>(m_nodeConfig->keyPageSize());
+        storageFactory->setKeyPageFormat(
+            static_cast<storage::KeyPageFormat>(m_nodeConfig->keyPageFormat()));
         std::string executorName = "executor-local";
         auto executorFactory = std::make_shared<bcos::executor::TransactionExecutorFactory>(
             m_ledger, m_txpoolInitializer->txpool(), cacheFactory, airExecutorStorage,
@@ -448,6 +448,12 @@ void PBFTInitializer::createPBFT()
     pbftConfig->setCheckPointTimeoutInterval(m_nodeConfig->checkPointTimeoutInterval());
     pbftConfig->setMinSealTime(m_nodeConfig->minSealTime());
     pbftConfig->setPipeLineSize(m_nodeConfig->pipelineSize());
+    pbftConfig->setSpeculativePreApply(m_nodeConfig->speculativePreApply());
+    if (m_nodeConfig->signatureVerifyThreads() > 0)
+    {
+        m_pbft->pbftEngine()->setMsgVerifier(std::make_shared<PBFTMsgVerifier>(
+            pbftConfig, m_nodeConfig->signatureVerifyThreads()));
+    }
 
     if (m_nodeConfig->singlePointConsensus())
     {
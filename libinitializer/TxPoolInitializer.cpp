@@ -48,6 +48,10 @@ TxPoolInitializer::TxPoolInitializer(bcos::tool::NodeConfig::Ptr _nodeConfig,
     m_txpool = m_txpoolFactory->createTxPool(m_nodeConfig->notifyWorkerNum(),
         m_nodeConfig->verifierWorkerNum(), m_nodeConfig->txsExpirationTime());
     m_txpool->setCheckBlockLimit(m_nodeConfig->checkBlockLimit());
+    m_txpool->txpoolConfig()->setTxPriorityPolicy(
+        m_nodeConfig->txsPriorityPolicy() == "gas_price" ? TxPriorityPolicy::GasPrice :
+                                                           TxPriorityPolicy::ImportTime);
+    m_txpool->txpoolConfig()->setProposalPrefillWindow(m_nodeConfig->proposalPrefillWindow());
     if (m_nodeConfig->enableSendTxByTree())
     {
         INITIALIZER_LOG(INFO) << LOG_DESC("enableSendTxByTree");
@@ -1362,6 +1362,19 @@ generate_config_ini() {
     ; enable_rip_protocol=false
     ; enable compression for p2p message, default: true
     ; enable_compression=false
+    ; the size(KB) of the zstd dictionaries trained from the p2p traffic to compress the small
+    ; messages, all the gateways exchange their dictionaries, default: 0(disabled)
+    ; compression_dictionary_size=16
+    ; the number of parallel connections to each peer, consensus messages keep the first one
+    ; and the sync/AMOP traffic is spread over the others, the smaller value of the two
+    ; gateways is used, default: 1
+    ; connections_per_peer=1
+    ; the KB each traffic class writes to a connection in one round before the next class is
+    ; served, a large consensus proposal can not hold back the other traffic for longer
+    ; consensus_write_budget=512
+    ; txs_sync_write_budget=256
+    ; block_sync_write_budget=256
+    ; amop_write_budget=128
     ; enable p2p ssl verify, default is true
     enable_ssl_verify = ${p2p_enable_ssl}
 
@@ -1452,6 +1465,8 @@ generate_common_ini() {
     ; The granularity of the storage page, in bytes, must not be less than 4096 Bytes, the default is 10240 Bytes (10KB)
     ; if modify key_page_size value to 0, should clear the data directory
     key_page_size=${key_page_size}
+    ; the format to write the pages: archive, compact or compact_zstd, all formats can be read
+    ;key_page_format=archive
     pd_ssl_ca_path=
     pd_ssl_cert_path=
     pd_ssl_key_path=
@@ -1461,6 +1476,10 @@ generate_common_ini() {
     ; if modify enable_separate_block_state, should clear the data directory
     ;enable_separate_block_state=false
     ;sync_archived_blocks=false
+    ; move the transactions and receipts older than cold_block_threshold blocks to cold_storage_path
+    ;cold_storage_path=
+    ;cold_block_threshold=1000000
+    ;cold_segment_blocks=10000
 
 [txpool]
     ; size of the txpool, default is 15000
@@ -1471,6 +1490,12 @@ generate_common_ini() {
     ;verify_worker_num=2
     ; txs expiration time, in seconds, default is 10 minutes
     txs_expiration_time = 600
+    ; the order to seal txs, import_time or gas_price, default is import_time
+    ;priority_policy = import_time
+    ; push the hashes of the txs received from local clients within this window (ms) to the
+    ; consensus nodes along with the proposal, so that followers fetch the txs they miss ahead
+    ; of verifying it, default is 0 (disabled)
+    ;proposal_prefill_window = 0
     ; permit txs from free node or not, default is false
     enable_txs_from_free_node = false
 
@@ -1594,6 +1619,19 @@ generate_sm_config_ini() {
     ; enable_rip_protocol=false
     ; enable compression for p2p message, default: true
     ; enable_compression=false
+    ; the size(KB) of the zstd dictionaries trained from the p2p traffic to compress the small
+    ; messages, all the gateways exchange their dictionaries, default: 0(disabled)
+    ; compression_dictionary_size=16
+    ; the number of parallel connections to each peer, consensus messages keep the first one
+    ; and the sync/AMOP traffic is spread over the others, the smaller value of the two
+    ; gateways is used, default: 1
+    ; connections_per_peer=1
+    ; the KB each traffic class writes to a connection in one round before the next class is
+    ; served, a large consensus proposal can not hold back the other traffic for longer
+    ; consensus_write_budget=512
+    ; txs_sync_write_budget=256
+    ; block_sync_write_budget=256
+    ; amop_write_budget=128
     ; enable p2p ssl verify, default is true
     enable_ssl_verify = ${p2p_enable_ssl}
 
@@ -250,6 +250,24 @@ private:
     std::mutex m_commitMutex;
     tbb::task_group m_asyncGroup;
 
+    /**
+     * The read-only context shared by all the calls on the latest committed block, built on the
+     * first call after a block is committed instead of on every call
+     */
+    struct CallContext
+    {
+        protocol::BlockNumber m_blockNumber{};
+        std::shared_ptr<const ledger::LedgerConfig> m_ledgerConfig;
+        protocol::BlockHeader::Ptr m_blockHeader;
+    };
+    std::shared_ptr<const CallContext> m_callContext;
+    // bumped before and after merging a committed block, odd while the merge is in progress
+    uint64_t m_callContextVersion = 0;
+    std::mutex m_callContextMutex;
+    // the calls run in a low priority arena with bounded concurrency, never starve the execution
+    tbb::task_arena m_callArena;
+    tbb::task_group m_callGroup;
+
     struct ExecuteResult
     {
         protocol::ConstTransactionsPtr m_transactions;
@@ -261,6 +279,62 @@ private:
     std::deque<ExecuteResult> m_results;
     std::mutex m_resultsMutex;
 
+    /**
+     * Returns the call context of the latest committed block, build and cache it if the cached one
+     * has been invalidated by a commit.
+     *
+     * @param view The view forked from the multi layer storage to build the context.
+     * @param version The context version when the view was forked, a context built on an outdated
+     * view or on a view forked during a merge is returned but not cached.
+     * @return A task that resolves to the call context.
+     */
+    task::Task<std::shared_ptr<const CallContext>> buildCallContext(auto& view, uint64_t version)
+    {
+        auto callContext = std::make_shared<CallContext>();
+        callContext->m_blockNumber =
+            co_await ledger::getCurrentBlockNumber(view, ledger::fromStorage);
+        callContext->m_ledgerConfig = co_await ledger::getLedgerConfig(
+            view, callContext->m_blockNumber, m_blockFactory.get());
+        auto block = co_await ledger::getBlockData(
+            view, callContext->m_blockNumber, ledger::HEADER, m_blockFactory.get());
+        callContext->m_blockHeader = block->blockHeader();
+
+        std::unique_lock lock(m_callContextMutex);
+        if (version == m_callContextVersion && version % 2 == 0)
+        {
+            m_callContext = callContext;
+        }
+        co_return callContext;
+    }
+
+    /**
+     * Forks a view of the multi layer storage together with the cached call context.
+     *
+     * @return A task that resolves to the view and the call context matching the view.
+     */
+    task::Task<std::tuple<typename MultiLayerStorage::ViewType, std::shared_ptr<const CallContext>>>
+    forkCallView()
+    {
+        std::unique_lock lock(m_callContextMutex);
+        auto view = m_multiLayerStorage.get().fork();
+        auto callContext = m_callContext;
+        auto version = m_callContextVersion;
+        lock.unlock();
+
+        if (!callContext)
+        {
+            callContext = co_await buildCallContext(view, version);
+        }
+        co_return {std::move(view), std::move(callContext)};
+    }
+
+    void invalidateCallContext()
+    {
+        std::unique_lock lock(m_callContextMutex);
+        ++m_callContextVersion;
+        m_callContext.reset();
+    }
+
     /**
      * Executes a block and returns a tuple containing an error (if any), the block header, and
      * a boolean indicating success.
@@ -475,8 +549,12 @@ private:
                 [&]() {
                     ittapi::Report report(ittapi::ITT_DOMAINS::instance().BASE_SCHEDULER,
                         ittapi::ITT_DOMAINS::instance().MERGE_STATE);
+                    // the committed block number and header change with the merge, the calls
+                    // forked in between neither use nor cache a context of the last block
+                    invalidateCallContext();
                     task::tbb::syncWait(
                         m_multiLayerStorage.get().mergeBackStorage(prewriteStorage));
+                    invalidateCallContext();
                 },
                 [&]() {
                     ittapi::Report report(ittapi::ITT_DOMAINS::instance().BASE_SCHEDULER,
@@ -551,7 +629,7 @@ public:
         Executor& executor, protocol::BlockFactory& blockFactory, Ledger& ledger,
         txpool::TxPoolInterface& txPool,
         protocol::TransactionSubmitResultFactory& transactionSubmitResultFactory,
-        crypto::Hash const& hashImpl)
+        crypto::Hash const& hashImpl, int callConcurrency = DEFAULT_CALL_CONCURRENCY)
       : m_multiLayerStorage(multiLayerStorage),
         m_schedulerImpl(schedulerImpl),
         m_executor(executor),
@@ -559,13 +637,20 @@ public:
         m_ledger(ledger),
         m_txpool(txPool),
         m_transactionSubmitResultFactory(transactionSubmitResultFactory),
-        m_hashImpl(hashImpl)
+        m_hashImpl(hashImpl),
+        m_callArena(callConcurrency, 1, tbb::task_arena::priority::low)
     {}
     BaselineScheduler(const BaselineScheduler&) = delete;
     BaselineScheduler(BaselineScheduler&&) noexcept = default;
     BaselineScheduler& operator=(const BaselineScheduler&) = delete;
     BaselineScheduler& operator=(BaselineScheduler&&) noexcept = default;
-    ~BaselineScheduler() noexcept override { m_asyncGroup.wait(); }
+    ~BaselineScheduler() noexcept override
+    {
+        m_callArena.execute([&]() { m_callGroup.wait(); });
+        m_asyncGroup.wait();
+    }
+
+    constexpr static int DEFAULT_CALL_CONCURRENCY = 8;
 
     void executeBlock(bcos::protocol::Block::Ptr block, bool verify,
         std::function<void(bcos::Error::Ptr, bcos::protocol::BlockHeader::Ptr, bool sysBlock)>
@@ -595,20 +680,32 @@ public:
     void call(protocol::Transaction::Ptr transaction,
         std::function<void(Error::Ptr, protocol::TransactionReceipt::Ptr)> callback) override
     {
-        task::wait([](decltype(this) self, protocol::Transaction::Ptr transaction,
-                       decltype(callback) callback) -> task::Task<void> {
-            auto view = self->m_multiLayerStorage.get().fork();
-            view.newMutable();
-            auto blockNumber = co_await ledger::getCurrentBlockNumber(view, ledger::fromStorage);
-            auto ledgerConfig =
-                co_await ledger::getLedgerConfig(view, blockNumber, self->m_blockFactory.get());
-            auto block = co_await ledger::getBlockData(
-                view, blockNumber, ledger::HEADER, self->m_blockFactory.get());
-            auto receipt = co_await self->m_executor.get().executeTransaction(
-                view, *block->blockHeader(), *transaction, 0, *ledgerConfig, true);
-
-            callback(nullptr, std::move(receipt));
-        }(this, std::move(transaction), std::move(callback)));
+        m_callArena.execute([&]() {
+            m_callGroup.run([this, transaction = std::move(transaction),
+                                callback = std::move(callback)]() {
+                task::syncWait([](decltype(this) self, protocol::Transaction::Ptr transaction,
+                                   decltype(callback) callback) -> task::Task<void> {
+                    try
+                    {
+                        auto [view, callContext] = co_await self->forkCallView();
+                        view.newMutable();
+                        auto receipt = co_await self->m_executor.get().executeTransaction(view,
+                            *callContext->m_blockHeader, *transaction, 0,
+                            *callContext->m_ledgerConfig, true);
+
+                        callback(nullptr, std::move(receipt));
+                    }
+                    catch (std::exception& e)
+                    {
+                        auto message =
+                            fmt::format("Call failed! {}", boost::diagnostic_information(e));
+                        BASELINE_SCHEDULER_LOG(WARNING) << message;
+                        callback(
+                            BCOS_ERROR_PTR(scheduler::SchedulerError::UnknownError, message), {});
+                    }
+                }(this, transaction, callback));
+            });
+        });
     }
 
     void reset([[maybe_unused]] std::function<void(Error::Ptr)> callback) override
@@ -621,14 +718,12 @@ public:
     {
         task::wait([](decltype(this) self, std::string_view contract,
                        decltype(callback) callback) -> task::Task<void> {
-            auto view = self->m_multiLayerStorage.get().fork();
+            auto [view, callContext] = co_await self->forkCallView();
             auto contractAddress = unhexAddress(contract);
-            auto blockNumber = co_await ledger::getCurrentBlockNumber(view, ledger::fromStorage);
-            auto ledgerConfig =
-                co_await ledger::getLedgerConfig(view, blockNumber, self->m_blockFactory.get());
 
             ledger::account::EVMAccount account(view, contractAddress,
-                ledgerConfig->features().get(ledger::Features::Flag::feature_raw_address));
+                callContext->m_ledgerConfig->features().get(
+                    ledger::Features::Flag::feature_raw_address));
             auto code = co_await account.code();
 
             if (!code)
@@ -646,14 +741,12 @@ public:
     {
         task::wait([](decltype(this) self, std::string_view contract,
                        decltype(callback) callback) -> task::Task<void> {
-            auto view = self->m_multiLayerStorage.get().fork();
+            auto [view, callContext] = co_await self->forkCallView();
             auto contractAddress = unhexAddress(contract);
-            auto blockNumber = co_await ledger::getCurrentBlockNumber(view, ledger::fromStorage);
-            auto ledgerConfig =
-                co_await ledger::getLedgerConfig(view, blockNumber, self->m_blockFactory.get());
 
             ledger::account::EVMAccount account(view, contractAddress,
-                ledgerConfig->features().get(ledger::Features::Flag::feature_raw_address));
+                callContext->m_ledgerConfig->features().get(
+                    ledger::Features::Flag::feature_raw_address));
             auto abi = co_await account.abi();
 
             if (!abi)
@@ -668,8 +761,12 @@ public:
     task::Task<std::optional<bcos::storage::Entry>> getPendingStorageAt(
         std::string_view address, std::string_view key, bcos::protocol::BlockNumber number) override
     {
-        auto view = m_multiLayerStorage.get().fork();
-        auto ledgerConfig = co_await ledger::getLedgerConfig(view, number, m_blockFactory.get());
+        auto [view, callContext] = co_await forkCallView();
+        auto ledgerConfig = callContext->m_ledgerConfig;
+        if (callContext->m_blockNumber != number)
+        {
+            ledgerConfig = co_await ledger::getLedgerConfig(view, number, m_blockFactory.get());
+        }
 
         ledger::account::EVMAccount account(view, address,
             ledgerConfig->features().get(ledger::Features::Flag::feature_raw_address));
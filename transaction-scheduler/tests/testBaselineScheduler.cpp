@@ -40,12 +40,14 @@ struct MockExecutorBaseline
         protocol::BlockHeader const& blockHeader, protocol::Transaction const& transaction,
         int contextID, ledger::LedgerConfig const& ledgerConfig, bool call)
     {
-        if (transaction.version() == 99)
+        if (call)
         {
-            BOOST_CHECK_EQUAL(blockHeader.timestamp(), 10088);
+            callTimestamp = blockHeader.timestamp();
         }
         co_return {};
     }
+    // the timestamp of the block header the last call was executed on
+    int64_t callTimestamp = -1;
 
     template <class Storage>
     struct ExecuteContext
@@ -110,6 +112,16 @@ static bcos::task::Task<std::vector<bcos::protocol::Transaction::ConstPtr>> empt
     co_return std::vector<bcos::protocol::Transaction::ConstPtr>{};
 }
 
+static bcos::task::Task<bcos::ledger::SystemConfigs> emptySystemConfigsTask()
+{
+    co_return bcos::ledger::SystemConfigs{};
+}
+
+static bcos::task::Task<bcos::ledger::Features> emptyFeaturesTask()
+{
+    co_return bcos::ledger::Features{};
+}
+
 class TestBaselineSchedulerFixture
 {
 public:
@@ -445,6 +457,101 @@ BOOST_AUTO_TEST_CASE(call)
         });
 
     end.get_future().get();
+    BOOST_CHECK_EQUAL(mockExecutor.callTimestamp, 10088);
+}
+
+BOOST_AUTO_TEST_CASE(callContext)
+{
+    writeBlock(111, 10088);
+    task::syncWait(storage2::writeOne(backendStorage,
+        StateKey{ledger::SYS_CURRENT_STATE, ledger::SYS_KEY_CURRENT_NUMBER},
+        storage::Entry{"111"}));
+
+    bcos::bytes input;
+    auto transaction =
+        transactionFactory->createTransaction(99, "to", input, "12345", 100, "chain", "group", 0);
+    auto call = [&]() {
+        std::promise<void> end;
+        baselineScheduler.call(
+            transaction, [&](Error::Ptr&& error, protocol::TransactionReceipt::Ptr&& receipt) {
+                BOOST_CHECK(!error);
+                end.set_value();
+            });
+        end.get_future().get();
+        return mockExecutor.callTimestamp;
+    };
+    BOOST_CHECK_EQUAL(call(), 10088);
+
+    // the header of the committed block is cached, the executor still sees the timestamp 10088
+    writeBlock(111, 1);
+    BOOST_CHECK_EQUAL(call(), 10088);
+
+    // execute and commit the next block
+    auto block = std::make_shared<bcostars::protocol::BlockImpl>();
+    auto blockHeader = block->blockHeader();
+    blockHeader->setNumber(112);
+    blockHeader->setVersion(200);
+    blockHeader->setTimestamp(20000);
+    blockHeader->calculateHash(*hashImpl);
+    block->appendTransaction(
+        transactionFactory->createTransaction(0, "to", input, "12345", 100, "chain", "group", 0));
+    // the ledger config is read from the ledger at the end of the commit
+    fakeit::When(Method(mockLedger, asyncGetNodeListByType))
+        .AlwaysDo([](std::string_view const&,
+                      std::function<void(Error::Ptr, consensus::ConsensusNodeList)> callback) {
+            callback(nullptr, {});
+        });
+    fakeit::When(Method(mockLedger, asyncGetBlockNumber))
+        .AlwaysDo([](std::function<void(Error::Ptr, protocol::BlockNumber)> callback) {
+            callback(nullptr, 112);
+        });
+    fakeit::When(Method(mockLedger, asyncGetBlockDataByNumber))
+        .AlwaysDo([&](protocol::BlockNumber, int32_t,
+                      std::function<void(Error::Ptr, protocol::Block::Ptr)> callback) {
+            callback(nullptr, block);
+        });
+    fakeit::When(Method(mockLedger, asyncGetBlockHashByNumber))
+        .AlwaysDo([&](protocol::BlockNumber,
+                      std::function<void(Error::Ptr, crypto::HashType)> callback) {
+            callback(nullptr, blockHeader->hash());
+        });
+    fakeit::When(Method(mockLedger, fetchAllSystemConfigs)).AlwaysDo([](protocol::BlockNumber) {
+        return emptySystemConfigsTask();
+    });
+    fakeit::When(Method(mockLedger, fetchAllFeatures)).AlwaysDo([](protocol::BlockNumber) {
+        return emptyFeaturesTask();
+    });
+    baselineScheduler.registerBlockNumberNotifier([](protocol::BlockNumber) {});
+    baselineScheduler.registerTransactionNotifier(
+        [](protocol::BlockNumber, protocol::TransactionSubmitResultsPtr,
+            std::function<void(Error::Ptr)> callback) { callback(nullptr); });
+
+    std::promise<protocol::BlockHeader::Ptr> executed;
+    baselineScheduler.executeBlock(block, false,
+        [&](bcos::Error::Ptr error, bcos::protocol::BlockHeader::Ptr gotBlockHeader,
+            bool sysBlock) {
+            BOOST_CHECK(!error);
+            executed.set_value(std::move(gotBlockHeader));
+        });
+    auto executedHeader = executed.get_future().get();
+    BOOST_REQUIRE(executedHeader);
+
+    // the next block is in the backend, but the context is only refreshed by the commit
+    writeBlock(112, 20000);
+    task::syncWait(storage2::writeOne(backendStorage,
+        StateKey{ledger::SYS_CURRENT_STATE, ledger::SYS_KEY_CURRENT_NUMBER},
+        storage::Entry{"112"}));
+    BOOST_CHECK_EQUAL(call(), 10088);
+
+    std::promise<void> committed;
+    baselineScheduler.commitBlock(
+        executedHeader, [&](Error::Ptr error, ledger::LedgerConfig::Ptr ledgerConfig) {
+            BOOST_CHECK(!error);
+            BOOST_CHECK(ledgerConfig);
+            committed.set_value();
+        });
+    committed.get_future().get();
+    BOOST_CHECK_EQUAL(call(), 20000);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file